@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+"""Generates synthetic SpanAnalyzer benchmark files.
+
+The files are synthesized from the test fixtures. The spans in the fixture
+document are repeated with varied attachment spacings, and the fixture
+weathercases are extended with synthetic weathercases. The following files are
+written to the output directory:
+  - appdata.xml
+  - benchmark.spananalyzer
+  - spananalyzer.conf
+  - cables/*.cable
+"""
+
+import argparse
+import copy
+import os
+import shutil
+import xml.etree.ElementTree as ElementTree
+
+DIR_SCRIPT = os.path.dirname(os.path.abspath(__file__))
+DIR_TEST = os.path.join(DIR_SCRIPT, '..', 'test')
+
+
+def generate_appdata(filepath, dir_cables, num_weathercases):
+    """Writes an application data file with the requested weathercase count."""
+    tree = ElementTree.parse(os.path.join(DIR_TEST, 'appdata.xml'))
+    root = tree.getroot()
+
+    # copies fixture cables and references them from the data file
+    node_cables = root.find('cables')
+    node_cables.clear()
+    dir_cables_test = os.path.join(DIR_TEST, 'cables')
+    for name in sorted(os.listdir(dir_cables_test)):
+        filepath_cable = os.path.join(dir_cables, name)
+        shutil.copyfile(os.path.join(dir_cables_test, name), filepath_cable)
+        node_file = ElementTree.SubElement(node_cables, 'file')
+        node_file.text = filepath_cable
+
+    # extends fixture weathercases with synthetic weathercases
+    # the fixture weathercases are kept because the spans and filters reference
+    # them
+    node_weathercases = root.find('weather_load_cases')
+    nodes = node_weathercases.findall('weather_load_case')
+
+    template = nodes[0]
+    for index in range(num_weathercases - len(nodes)):
+        thickness_ice = 0.25 * (index % 5)
+        pressure_wind = 2.0 * (index % 9)
+        temperature = -40.0 + (index * 7) % 253
+        density_ice = 57.3 if 0 < thickness_ice else 0
+
+        node = copy.deepcopy(template)
+        node.find('description').text = 'bench-%d' % index
+        node.find('thickness_ice').text = '%.2f' % thickness_ice
+        node.find('density_ice').text = '%.1f' % density_ice
+        node.find('pressure_wind').text = '%.1f' % pressure_wind
+        node.find('temperature_cable').text = '%.2f' % temperature
+        node_weathercases.append(node)
+
+    tree.write(filepath, encoding='UTF-8', xml_declaration=True)
+
+
+def generate_config(filepath, filepath_data):
+    """Writes a config file that references the application data file."""
+    tree = ElementTree.parse(os.path.join(DIR_TEST, 'spananalyzer.conf'))
+    root = tree.getroot()
+    root.find('filepath_data').text = filepath_data
+    tree.write(filepath, encoding='UTF-8', xml_declaration=True)
+
+
+def generate_document(filepath, num_spans):
+    """Writes a document with the requested span count."""
+    tree = ElementTree.parse(os.path.join(DIR_TEST, 'test.spananalyzer'))
+    root = tree.getroot()
+
+    node_spans = root.find('spans')
+    templates = node_spans.findall('span')
+    for node in templates:
+        node_spans.remove(node)
+
+    for index in range(num_spans):
+        node = copy.deepcopy(templates[index % len(templates)])
+        node.find('name').text = '%s #%d' % (node.find('name').text, index)
+
+        # varies the attachment spacing so every span solves differently
+        node_spacing = node.find('vector_3d[@name="spacing_attachments"]')
+        node_spacing.find('x').text = '%.3f' % (600 + (index * 37) % 1200)
+        node_spacing.find('z').text = '%.3f' % ((index * 13) % 101 - 50)
+
+        node_spans.append(node)
+
+    tree.write(filepath, encoding='UTF-8', xml_declaration=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generates synthetic SpanAnalyzer benchmark files.')
+    parser.add_argument('--spans', type=int, default=1000,
+                        help='number of spans in the document')
+    parser.add_argument('--weathercases', type=int, default=100,
+                        help='number of weathercases in the application '
+                             'data, including the fixture weathercases')
+    parser.add_argument('--output', default='.',
+                        help='output directory')
+    args = parser.parse_args()
+
+    dir_output = os.path.abspath(args.output)
+    dir_cables = os.path.join(dir_output, 'cables')
+    os.makedirs(dir_cables, exist_ok=True)
+
+    filepath_data = os.path.join(dir_output, 'appdata.xml')
+    generate_appdata(filepath_data, dir_cables, args.weathercases)
+    generate_config(os.path.join(dir_output, 'spananalyzer.conf'),
+                    filepath_data)
+    generate_document(os.path.join(dir_output, 'benchmark.spananalyzer'),
+                      args.spans)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,36 @@
+#!/bin/bash
+
+# gets script directory
+DIR="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+
+# checks arguments
+if [ $# -lt 1 ]; then
+  echo "Usage: run_benchmark.sh <path_to_spananalyzer_executable> [threads]"
+  exit 1
+fi
+
+EXECUTABLE=$1
+THREADS=$2
+
+# defines benchmark sizes as span count:weathercase count
+SIZES="100:100 1000:100 10000:100 1000:1000 10000:1000"
+
+# generates files and runs the benchmark for each size
+DIR_OUTPUT="$DIR/output"
+for SIZE in $SIZES; do
+  SPANS=${SIZE%:*}
+  WEATHERCASES=${SIZE#*:}
+  DIR_SIZE="$DIR_OUTPUT/${SPANS}_${WEATHERCASES}"
+
+  echo "Benchmarking $SPANS spans, $WEATHERCASES weathercases"
+  python3 "$DIR/generate_benchmark_files.py" --spans "$SPANS" \
+    --weathercases "$WEATHERCASES" --output "$DIR_SIZE"
+
+  OPTIONS="--config=$DIR_SIZE/spananalyzer.conf"
+  OPTIONS="$OPTIONS --benchmark=$DIR_SIZE/results.csv"
+  if [ -n "$THREADS" ]; then
+    OPTIONS="$OPTIONS --benchmark-threads=$THREADS"
+  fi
+
+  "$EXECUTABLE" $OPTIONS "$DIR_SIZE/benchmark.spananalyzer"
+done
@@ -5,14 +5,22 @@
 #define SPANANALYZER_ANALYSIS_CONTROLLER_H_
 
 #include <list>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "models/sagtension/cable_elongation_model.h"
 #include "models/sagtension/line_cable_reloader.h"
 #include "models/sagtension/line_cable_unloader.h"
 #include "wx/wx.h"
 
+#include "spananalyzer/analysis_diagnostics.h"
+#include "spananalyzer/cable_model_cache.h"
 #include "spananalyzer/sag_tension_analysis_result.h"
+#include "spananalyzer/sag_tension_result_cache.h"
+#include "spananalyzer/sag_tension_result_store.h"
 #include "spananalyzer/span.h"
+#include "spananalyzer/tension_surrogate.h"
 
 /// \par OVERVIEW
 ///
@@ -23,15 +31,62 @@ struct AnalysisJob {
   ///   The reloaded condition.
   CableConditionType condition;
 
-  /// \var result
-  ///   The sag-tension result to calculate.
-  SagTensionAnalysisResult* result;
+  /// \var index
+  ///   The job index, which is unique across all of the analysis threads.
+  int index;
+
+  /// \var index_weathercase
+  ///   The weathercase index, which is also the result case index.
+  int index_weathercase;
+
+  /// \var is_reloaded
+  ///   An indicator that tells if the reloaded result is already solved. If
+  ///   true, the reloaded result is read from the reloaded result store and
+  ///   only the unloader is solved.
+  bool is_reloaded;
 
   /// \var weathercase
   ///   The reloaded weathercase.
   const WeatherLoadCase* weathercase;
 };
 
+/// \par OVERVIEW
+///
+/// This struct is the part of an analysis that only depends on the line cable,
+/// which is shared by all spans with an identical line cable.
+struct LineCableSolution {
+  /// \var block
+  ///   The serialized reloaded results, indexed by weathercase and condition.
+  std::vector<char> block;
+
+  /// \var fingerprint
+  ///   The line cable fingerprint.
+  std::string fingerprint;
+
+  /// \var state_stretch_creep
+  ///   The stretch state for the creep condition.
+  CableStretchState state_stretch_creep;
+
+  /// \var state_stretch_load
+  ///   The stretch state for the load condition.
+  CableStretchState state_stretch_load;
+};
+
+/// \par OVERVIEW
+///
+/// This struct is a temperature sweep that is cached by the analysis
+/// controller.
+struct TemperatureSweepEntry {
+  /// \var key
+  ///   The key, which includes the line cable fingerprint, weathercase,
+  ///   condition, surrogate settings, and temperatures.
+  std::string key;
+
+  /// \var result
+  ///   The sweep result.
+  TemperatureSweepResult result;
+};
+
 /// \par OVERVIEW
 ///
 /// This class is a worker thread for an analysis.
@@ -45,11 +100,34 @@ struct AnalysisJob {
 /// \par RESULTS
 ///
 /// The results are calculated primarily using a LineCableReloader from the
-/// OTLS-Models calculation library.
+/// OTLS-Models calculation library. Each result is written to a shared result
+/// store, using the job weathercase index and condition.
+///
+/// \par DIAGNOSTICS
+///
+/// This thread publishes a diagnostic to a shared channel for any job that
+/// fails. Diagnostics are only codes and indexes, so no error strings are
+/// built by the worker threads.
 ///
-/// \par MESSAGES
+/// \par SOLVER STATISTICS
 ///
-/// This thread logs any error messages from the analysis.
+/// The reloader and unloader solve times are recorded for each job, along with
+/// a length residual that checks the solution against the cable elongation
+/// model. The residual elongation model is owned by the thread and updated for
+/// each job, as its cable state changes with every weathercase.
+///
+/// \par SHARED SOLUTIONS
+///
+/// The reloaded results of solved jobs are also written to a reloaded result
+/// store. Jobs that are flagged as reloaded read their reloaded result from
+/// this store instead of solving the reloader, and use the shared stretch
+/// states, so only the unloader is solved.
+///
+/// \par AFFINITY
+///
+/// This thread can optionally pin itself to a logical CPU when it starts. The
+/// time spent doing jobs is recorded, so the parallel efficiency of the
+/// analysis can be reported.
 class AnalysisThread : public wxThread {
  public:
   /// \brief Constructor.
@@ -61,43 +139,107 @@ class AnalysisThread : public wxThread {
   /// This must be done before the Run() method.
   void AddAnalysisJob(AnalysisJob* job);
 
+  /// \brief Gets if the thread was pinned to a logical CPU.
+  /// \return If the thread was pinned. This is only valid after the thread
+  ///   has finished.
+  bool is_pinned() const;
+
   /// \brief Gets the line cable.
   /// \return The line cable.
   const LineCable* line_cable() const;
 
-  /// \brief Gets the error messages.
-  /// \return The error messages.
-  const std::list<ErrorMessage>* messages() const;
-
   /// \brief Gets the reloader.
   /// \return The reloader.
   const LineCableReloader* reloader() const;
 
+  /// \brief Sets the diagnostic channel.
+  /// \param[in] channel
+  ///   The diagnostic channel.
+  void set_channel(AnalysisDiagnosticChannel* channel);
+
+  /// \brief Sets the logical CPU that the thread is pinned to.
+  /// \param[in] index_cpu
+  ///   The logical CPU index. If less than zero, the thread isn't pinned.
+  /// This must be done before the Run() method.
+  void set_index_cpu(const int& index_cpu);
+
   /// \brief Sets the line cable.
   /// \param[in] line_cable
   ///   The line cable.
   void set_line_cable(const LineCable* line_cable);
 
+  /// \brief Sets the result store.
+  /// \param[in] results
+  ///   The result store.
+  void set_results(SagTensionResultStore* results);
+
+  /// \brief Sets the reloaded result store.
+  /// \param[in] results_reloaded
+  ///   The reloaded result store.
+  void set_results_reloaded(SagTensionResultStore* results_reloaded);
+
   /// \brief Sets the catenary spacing.
   /// \param[in] spacing_catenary
   ///   The catenary spacing.
   void set_spacing_catenary(const Vector3d* spacing_catenary);
 
+  /// \brief Sets the shared stretch states.
+  /// \param[in] state_stretch_creep
+  ///   The creep stretch state.
+  /// \param[in] state_stretch_load
+  ///   The load stretch state.
+  /// These are required for any jobs that are flagged as reloaded.
+  void set_states_stretch(const CableStretchState* state_stretch_creep,
+                          const CableStretchState* state_stretch_load);
+
   /// \brief Gets the catenary spacing.
   /// \return The catenary spacing.
   const Vector3d* spacing_catenary() const;
 
+  /// \brief Gets the time spent doing jobs.
+  /// \return The time spent doing jobs, in seconds. This is only valid after
+  ///   the thread has finished.
+  double time_busy() const;
+
  protected:
   /// \brief Does an analysis job.
   /// \param[in] index
   ///   The job index.
   void DoAnalysisJob(const int& index);
 
+  /// \brief Calculates the relative length residual of a solution.
+  /// \param[in] result
+  ///   The sag-tension result, which must be valid.
+  /// \param[in] catenary
+  ///   The reloaded catenary.
+  /// \return The relative difference between the catenary length and the
+  ///   length predicted by the elongation model. If the model length is
+  ///   invalid, -999999 is returned.
+  double ResidualLength(const SagTensionAnalysisResult& result,
+                        const Catenary3d& catenary);
+
   /// \brief Begins the thread processing.
   /// \return The thread exit code.
   /// This function is called directly after Run().
   virtual ExitCode Entry();
 
+  /// \var cable_
+  ///   The sag-tension cable used by the elongation model.
+  SagTensionCable cable_;
+
+  /// \var channel_
+  ///   The channel that diagnostics are published to.
+  AnalysisDiagnosticChannel* channel_;
+
+  /// \var index_cpu_
+  ///   The logical CPU that the thread is pinned to. If less than zero, the
+  ///   thread isn't pinned.
+  int index_cpu_;
+
+  /// \var is_pinned_
+  ///   An indicator that tells if the thread was pinned to the logical CPU.
+  bool is_pinned_;
+
   /// \var jobs_
   ///   The analysis jobs.
   std::list<AnalysisJob*> jobs_;
@@ -106,19 +248,43 @@ class AnalysisThread : public wxThread {
   ///   The line cable to reload.
   const LineCable* line_cable_;
 
-  /// \var messages_
-  ///   Error messages encountered during the analysis.
-  mutable std::list<ErrorMessage> messages_;
+  /// \var model_
+  ///   The cable elongation model that is used to check the solution
+  ///   residuals.
+  CableElongationModel model_;
 
   /// \var reloader_
   ///   The line cable reloader that is used in the analysis. This is used solve
   ///   for the sag-tension results.
   LineCableReloader reloader_;
 
+  /// \var results_
+  ///   The result store that the job results are written to.
+  SagTensionResultStore* results_;
+
+  /// \var results_reloaded_
+  ///   The result store that the reloaded results are written to, or read from
+  ///   for reloaded jobs.
+  SagTensionResultStore* results_reloaded_;
+
   /// \var spacing_catenary_
   ///   The catenary end point spacing.
   const Vector3d* spacing_catenary_;
 
+  /// \var state_stretch_creep_
+  ///   The shared creep stretch state. If no shared state is set, this is a
+  ///   nullptr.
+  const CableStretchState* state_stretch_creep_;
+
+  /// \var state_stretch_load_
+  ///   The shared load stretch state. If no shared state is set, this is a
+  ///   nullptr.
+  const CableStretchState* state_stretch_load_;
+
+  /// \var time_busy_
+  ///   The time spent doing jobs, in seconds.
+  double time_busy_;
+
   /// \var unloader_
   ///   The line cable unloader that is used in the analysis. This is used solve
   ///   for the unloaded length result.
@@ -145,6 +311,66 @@ class AnalysisThread : public wxThread {
 /// threads depends on the available CPUs. A list of analysis jobs are generated
 /// and then split evenly among the available threads. This speeds things up so
 /// the calculations are less of a bottleneck to the main application thread.
+///
+/// The number of threads can be limited to a budget. The threads can also be
+/// pinned to the logical CPUs that the process is allowed to run on, and run
+/// at the lowest priority in a background mode. The thread count and parallel efficiency (the fraction of
+/// the thread time spent doing jobs) are logged with the analysis time.
+///
+/// \par RESULT STORAGE
+///
+/// The results are stored in a columnar result store, which has one array per
+/// result quantity, a validity bitmap, and a condition axis. Results are
+/// materialized into a SagTensionAnalysisResult when requested.
+///
+/// \par RESULT CACHE
+///
+/// When the span is changed, the results of the previous span are serialized
+/// into a memory-bounded, least-recently-used cache. If a span is reactivated
+/// while its results are still cached (in memory or in the spill file), the
+/// results are restored instead of recalculated. Cached results need to be
+/// invalidated when a span is modified or deleted, or when the application
+/// data that the analysis depends on changes.
+///
+/// \par SHARED LINE CABLE SOLUTIONS
+///
+/// Spans in a line section often have an identical line cable, and only differ
+/// by their attachment spacing. The reloaded results and stretch states only
+/// depend on the line cable, so they are solved once per line cable and kept
+/// by a fingerprint of the line cable. When a span with a known line cable is
+/// analyzed, only the unloader, which depends on the span geometry, is solved.
+/// The line cable references are fingerprinted by address, so the shared
+/// solutions need to be cleared along with the result cache when the
+/// application data changes. The solutions and the cached results draw from
+/// one memory budget. A new solution only uses the memory that the cached
+/// results don't, evicting the least recently used solutions first, and the
+/// cached results can't grow into the memory held by the solutions.
+///
+/// \par CABLE MODEL CACHE
+///
+/// The cable elongation models are compiled once per cable and state, and are
+/// shared by the line section solver and cable plot. The models are held
+/// within a fixed share of the cache memory budget. The cache is keyed by cable
+/// address, so it is also cleared when the application data changes.
+///
+/// \par DIAGNOSTICS
+///
+/// The worker threads publish failures to a preallocated, lock-free diagnostic
+/// channel. The channel is drained and logged once the threads are joined, so
+/// the main thread doesn't poll while they run. Error messages are only
+/// formatted when they are logged, and errors are reported in the status bar
+/// instead of a blocking message box.
+///
+/// \par TEMPERATURE SWEEPS
+///
+/// A temperature sweep solves the activated span line cable for a weathercase
+/// load over many temperatures. By default every temperature is solved
+/// exactly. If the surrogate is enabled, the horizontal tension is solved
+/// exactly at adaptively chosen knots and interpolated between them, and the
+/// estimated error is reported with the result. The most recently used sweeps
+/// are cached by line cable fingerprint and weathercase, so a sweep is only
+/// solved again when the line cable or the sweep inputs change. The weathercase
+/// is keyed by address, so the sweeps are cleared with the result cache.
 class AnalysisController {
  public:
   /// \brief Constructor.
@@ -153,31 +379,64 @@ class AnalysisController {
   /// \brief Destructor.
   ~AnalysisController();
 
+  /// \brief Clears the cached results of all spans, the shared line cable
+  ///   solutions, the compiled cable models, and the temperature sweeps.
+  void ClearCache();
+
   /// \brief Clears the sag-tension results.
   void ClearResults();
 
+  /// \brief Generates a fingerprint of the line cable.
+  /// \param[in] linecable
+  ///   The line cable.
+  /// \return The fingerprint, which is only valid within the same process.
+  /// The fingerprint includes everything that the reloaded results depend on,
+  /// and excludes the line structure connections.
+  static std::string Fingerprint(const LineCable& linecable);
+
+  /// \brief Invalidates the cached results of a span.
+  /// \param[in] span
+  ///   The span. This is only used as a key and is not dereferenced, so it can
+  ///   refer to a span that was already deleted.
+  void InvalidateResults(const Span* span);
+
   /// \brief Gets the sag-tension analyis result.
   /// \param[in] index_weathercase
   ///   The weathercase index.
   /// \param[in] condition
   ///   The condition.
-  /// \return The sag-tension analysis result. If the index did not match up to
-  ///   the results list, or the result is not a valid sag-tension result, a
-  ///   nullptr is returned.
-  const SagTensionAnalysisResult* Result(
-      const int& index_weathercase,
-      const CableConditionType& condition) const;
-
-  /// \brief Gets the sag-tension analysis results.
-  /// \param[in] condition
-  ///   The condition.
-  /// \return The sag-tension analysis results.
-  const std::vector<SagTensionAnalysisResult>* Results(
-      const CableConditionType& condition) const;
+  /// \param[out] result
+  ///   The sag-tension analysis result that is populated.
+  /// \return If the result is valid. If the index did not match up to the
+  ///   results, or the result is not a valid sag-tension result, false is
+  ///   returned.
+  bool Result(const int& index_weathercase,
+              const CableConditionType& condition,
+              SagTensionAnalysisResult& result) const;
+
+  /// \brief Restores the cached sag-tension results of the span.
+  /// \return If the results were restored. If false, the analysis needs to be
+  ///   run.
+  bool RestoreResults();
 
   /// \brief Runs the sag-tension analysis.
   void RunAnalysis();
 
+  /// \brief Solves a temperature sweep of the span line cable.
+  /// \param[in] weathercase
+  ///   The weathercase, which provides the load. The temperature is ignored.
+  /// \param[in] condition
+  ///   The reloaded condition.
+  /// \param[in] temperatures
+  ///   The temperatures, in any order.
+  /// \param[out] result
+  ///   The sweep result.
+  /// \return If the sweep was solved.
+  bool SolveTemperatureSweep(const WeatherLoadCase& weathercase,
+                             const CableConditionType& condition,
+                             const std::vector<double>& temperatures,
+                             TemperatureSweepResult& result) const;
+
   /// \brief Gets the analysis stretch state for the specified condition.
   /// \param[in] condition
   ///   The condition.
@@ -185,11 +444,65 @@ class AnalysisController {
   ///   state is available, a nullptr is returned.
   const CableStretchState* StretchState(const CableConditionType& condition);
 
+  /// \brief Gets the cable model cache.
+  /// \return The cable model cache.
+  CableModelCache* cache_models();
+
+  /// \brief Gets the maximum number of threads used in the analysis.
+  /// \return The maximum number of threads used in the analysis.
+  int max_threads() const;
+
+  /// \brief Gets the sag-tension analysis results.
+  /// \return The sag-tension analysis results.
+  const SagTensionResultStore* results() const;
+
+  /// \brief Sets if the analysis threads run in the background.
+  /// \param[in] is_background
+  ///   An indicator that determines if the analysis threads run at the lowest
+  ///   priority.
+  void set_is_background(const bool& is_background);
+
+  /// \brief Sets if the analysis threads are pinned to logical CPUs.
+  /// \param[in] is_pinned
+  ///   An indicator that determines if each analysis thread is pinned to a
+  ///   logical CPU.
+  void set_is_pinned(const bool& is_pinned);
+
+  /// \brief Sets if evicted cached results are spilled to disk.
+  /// \param[in] is_spilling
+  ///   An indicator that determines if evicted results are spilled to disk. If
+  ///   false, evicted results are recalculated when needed.
+  void set_is_spilling_cache(const bool& is_spilling);
+
+  /// \brief Sets if temperature sweeps are interpolated with a surrogate.
+  /// \param[in] is_surrogate
+  ///   An indicator that determines if a surrogate is used for temperature
+  ///   sweeps.
+  void set_is_surrogate(const bool& is_surrogate);
+
+  /// \brief Sets the maximum number of threads used in the analysis.
+  /// \param[in] max_threads
+  ///   The maximum number of threads. If less than one, the number of
+  ///   available CPUs is used.
+  void set_max_threads(const int& max_threads);
+
+  /// \brief Sets the memory budget of the result and cable model caches.
+  /// \param[in] size_budget
+  ///   The memory budget, in bytes, which is shared by the caches.
+  void set_size_budget_cache(const long& size_budget);
+
   /// \brief Sets the activated span.
   /// \param[in] span
   ///   The span.
+  /// If the span changes, the results of the previous span are cached. The
+  /// results of the new span are not restored or calculated.
   void set_span(const Span* span);
 
+  /// \brief Sets the relative error tolerance of the surrogate.
+  /// \param[in] tolerance
+  ///   The relative error tolerance of the horizontal tension.
+  void set_tolerance_surrogate(const double& tolerance);
+
   /// \brief Sets the weathercases.
   /// \param[in] weathercases
   ///   The reference data.
@@ -204,21 +517,92 @@ class AnalysisController {
   const std::list<WeatherLoadCase*>* weathercases() const;
 
  private:
+  /// \brief Erases a shared line cable solution.
+  /// \param[in] iter
+  ///   The solution iterator.
+  void EraseSolution(std::list<LineCableSolution>::iterator iter);
+
+  /// \brief Drains the diagnostic channel and logs any new diagnostics.
+  /// \param[in] jobs
+  ///   The analysis jobs, indexed by the job index.
+  /// \return The number of diagnostics logged.
+  int LogDiagnostics(const std::vector<AnalysisJob>& jobs);
+
+  /// \brief Logs the solver statistics of the results.
+  /// The average and slowest solve times, and the largest length residual are
+  /// logged.
+  void LogSolverStatistics() const;
+
+  /// \brief Serializes the results of the span into the cache.
+  void StashResults();
+
+  /// \brief Updates the result cache budget to the memory that isn't used by
+  ///   the shared line cable solutions.
+  void UpdateSizeBudgetResults();
+
+  /// \var cache_models_
+  ///   The compiled cable models, which are shared with the solvers and views.
+  CableModelCache cache_models_;
+
+  /// \var cache_results_
+  ///   The cache of serialized results for spans that aren't activated.
+  SagTensionResultCache cache_results_;
+
+  /// \var channel_diagnostics_
+  ///   The channel that the worker threads publish diagnostics to.
+  AnalysisDiagnosticChannel channel_diagnostics_;
+
+  /// \var is_background_
+  ///   An indicator that determines if the analysis threads run at the lowest
+  ///   priority.
+  bool is_background_;
+
+  /// \var is_pinned_
+  ///   An indicator that determines if the analysis threads are pinned to
+  ///   logical CPUs.
+  bool is_pinned_;
+
+  /// \var is_surrogate_
+  ///   An indicator that determines if temperature sweeps are interpolated.
+  bool is_surrogate_;
+
   /// \var max_threads_
   ///   The maximum number of threads that can be used in the analysis.
   int max_threads_;
 
-  /// \var results_creep_
-  ///   The analysis results for the creep condition.
-  mutable std::vector<SagTensionAnalysisResult> results_creep_;
+  /// \var results_
+  ///   The analysis results, indexed by weathercase and condition.
+  SagTensionResultStore results_;
+
+  /// \var size_budget_results_
+  ///   The memory budget that is shared by the result cache and the shared line
+  ///   cable solutions, in bytes.
+  long size_budget_results_;
 
-  /// \var results_initial_
-  ///   The analysis results for the initial condition.
-  mutable std::vector<SagTensionAnalysisResult> results_initial_;
+  /// \var size_solutions_
+  ///   The memory used by the shared line cable solutions, in bytes.
+  long size_solutions_;
 
-  /// \var results_load_
-  ///   The analysis results for the load condition.
-  mutable std::vector<SagTensionAnalysisResult> results_load_;
+  /// \var index_solutions_
+  ///   The shared line cable solutions, keyed by line cable fingerprint.
+  std::unordered_map<std::string, std::list<LineCableSolution>::iterator>
+      index_solutions_;
+
+  /// \var solutions_
+  ///   The shared line cable solutions, ordered from most to least recently
+  ///   used.
+  std::list<LineCableSolution> solutions_;
+
+  /// \var index_sweeps_
+  ///   The cached temperature sweeps, keyed by the sweep key.
+  mutable std::unordered_map<std::string,
+                             std::list<TemperatureSweepEntry>::iterator>
+      index_sweeps_;
+
+  /// \var sweeps_
+  ///   The cached temperature sweeps, ordered from most to least recently
+  ///   used.
+  mutable std::list<TemperatureSweepEntry> sweeps_;
 
   /// \var span_
   ///   The span being analyzed.
@@ -236,6 +620,10 @@ class AnalysisController {
   ///   The calculated stretch state for the load condition.
   mutable CableStretchState state_stretch_load_;
 
+  /// \var tolerance_surrogate_
+  ///   The relative error tolerance of the surrogate.
+  double tolerance_surrogate_;
+
   /// \var weathercases_
   ///   The weathercases to be analyzed.
   const std::list<WeatherLoadCase*>* weathercases_;
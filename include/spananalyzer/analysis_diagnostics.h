@@ -0,0 +1,131 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_ANALYSIS_DIAGNOSTICS_H_
+#define SPANANALYZER_ANALYSIS_DIAGNOSTICS_H_
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "models/sagtension/cable_state.h"
+
+/// \par OVERVIEW
+///
+/// This struct is a diagnostic that is generated by an analysis job. It only
+/// holds indexes and codes so it can be published without allocating. The
+/// message text is formatted later by the consumer.
+struct AnalysisDiagnostic {
+  /// This enum class contains types of diagnostic codes.
+  enum class Code {
+    kNull,
+    kReloaderNoSolution,
+    kUnloaderNoSolution
+  };
+
+  /// \var code
+  ///   The diagnostic code.
+  Code code;
+
+  /// \var condition
+  ///   The condition of the job.
+  CableConditionType condition;
+
+  /// \var index_job
+  ///   The job index.
+  int index_job;
+
+  /// \var index_weathercase
+  ///   The weathercase index.
+  int index_weathercase;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a multi-producer, single-consumer channel that passes
+/// diagnostics from the analysis worker threads to the main application thread.
+///
+/// \par PREALLOCATION
+///
+/// The channel slots are allocated before the worker threads are started. If
+/// the channel is full, any additional diagnostics are counted as dropped.
+///
+/// \par LOCK-FREE PUBLISHING
+///
+/// Workers reserve a slot with an atomic counter, write the diagnostic, and
+/// then flag the slot as published. No locks are taken, so publishing does not
+/// stall the workers.
+///
+/// \par DRAINING
+///
+/// The consumer drains published diagnostics in slot order, and can do so
+/// repeatedly while the workers are still running. Draining stops at the first
+/// slot that is reserved but not yet published, and resumes there on the next
+/// drain.
+class AnalysisDiagnosticChannel {
+ public:
+  /// \brief Constructor.
+  AnalysisDiagnosticChannel();
+
+  /// \brief Destructor.
+  ~AnalysisDiagnosticChannel();
+
+  /// \brief Drains any newly published diagnostics.
+  /// \param[out] diagnostics
+  ///   The list that the drained diagnostics are appended to.
+  /// \return The number of diagnostics drained.
+  /// This must only be called by the consumer thread.
+  int Drain(std::list<AnalysisDiagnostic>& diagnostics);
+
+  /// \brief Publishes a diagnostic.
+  /// \param[in] diagnostic
+  ///   The diagnostic.
+  /// \return If the diagnostic was published. If the channel is full, the
+  ///   diagnostic is dropped and false is returned.
+  /// This is safe to call from any thread.
+  bool Publish(const AnalysisDiagnostic& diagnostic);
+
+  /// \brief Resets the channel and allocates the slots.
+  /// \param[in] capacity
+  ///   The maximum number of diagnostics.
+  /// This must not be called while any producers are publishing.
+  void Reset(const int& capacity);
+
+  /// \brief Gets the number of dropped diagnostics.
+  /// \return The number of dropped diagnostics.
+  int num_dropped() const;
+
+  /// \brief Gets the number of published diagnostics.
+  /// \return The number of published or in-progress diagnostics.
+  int num_published() const;
+
+ private:
+  /// \var capacity_
+  ///   The number of allocated slots.
+  int capacity_;
+
+  /// \var flags_published_
+  ///   The flags that indicate if a slot has been published.
+  std::unique_ptr<std::atomic<bool>[]> flags_published_;
+
+  /// \var index_drained_
+  ///   The index of the next slot to drain. This is only accessed by the
+  ///   consumer.
+  int index_drained_;
+
+  /// \var index_reserved_
+  ///   The index of the next slot to reserve.
+  std::atomic<int> index_reserved_;
+
+  /// \var num_dropped_
+  ///   The number of diagnostics that were dropped because the channel was
+  ///   full.
+  std::atomic<int> num_dropped_;
+
+  /// \var slots_
+  ///   The diagnostic slots.
+  std::vector<AnalysisDiagnostic> slots_;
+};
+
+#endif  // SPANANALYZER_ANALYSIS_DIAGNOSTICS_H_
@@ -11,6 +11,7 @@
 #include "wx/xml/xml.h"
 
 #include "spananalyzer/span_analyzer_data.h"
+#include "spananalyzer/xml_stream_writer.h"
 
 /// \par OVERVIEW
 ///
@@ -55,6 +56,18 @@ class AnalysisFilterXmlHandler : public XmlHandler {
                         const std::list<WeatherLoadCase*>* weathercases,
                         AnalysisFilter& filter);
 
+  /// \brief Writes an analysis filter XML node to a stream.
+  /// \param[in] filter
+  ///   The filter.
+  /// \param[in] name
+  ///   The name of the XML node. This will be an attribute for the written
+  ///   node. If empty, no attribute will be written.
+  /// \param[in] writer
+  ///   The stream writer.
+  static void WriteNode(const AnalysisFilter& filter,
+                        const std::string& name,
+                        XmlStreamWriter& writer);
+
  private:
   /// \brief Parses a version 1 XML node and populates an analysis filter
   ///   object.
@@ -0,0 +1,204 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_BATCH_RUNNER_H_
+#define SPANANALYZER_BATCH_RUNNER_H_
+
+#include <list>
+#include <string>
+#include <vector>
+
+#include "wx/file.h"
+
+#include "spananalyzer/span.h"
+
+/// \par OVERVIEW
+///
+/// This struct is a shard of a batch analysis, which is a range of spans in a
+/// document.
+struct BatchShard {
+  /// \var filepath_doc
+  ///   The document filepath.
+  std::string filepath_doc;
+
+  /// \var filepath_results
+  ///   The filepath that the shard results are written to.
+  std::string filepath_results;
+
+  /// \var index_begin
+  ///   The index of the first span in the shard.
+  int index_begin;
+
+  /// \var index_end
+  ///   The index after the last span in the shard.
+  int index_end;
+
+  /// \var is_complete
+  ///   An indicator that tells if the shard results were written.
+  bool is_complete;
+
+  /// \var num_attempts
+  ///   The number of times the shard process has been started.
+  int num_attempts;
+};
+
+/// \par OVERVIEW
+///
+/// This class runs a sag-tension analysis on every span of one or more
+/// documents, and writes the results to a single comma-separated file.
+///
+/// \par SHARDS
+///
+/// The documents (a single document, or every document in a directory) are
+/// split into shards by span range. Each shard is analyzed by a separate
+/// headless process of this application, so the spans and results that each
+/// process holds only grow with its shard, and a process that crashes only
+/// loses its own shard.
+/// The processes are started up to a limit, and each one is given an equal
+/// share of the analysis thread budget.
+///
+/// \par SHARD PROCESSES
+///
+/// A shard process parses only its span range from the document, analyzes
+/// each span with an AnalysisController, and writes the results to a shard
+/// file. The document xml is still loaded whole, both to count the spans and
+/// to parse a range, so that part of the memory grows with the document. The shard file is written under a temporary name and renamed when
+/// it is complete, so a partial file is never merged. A shard that fails is
+/// restarted once.
+///
+/// \par MERGE
+///
+/// The shard files are merged in document and span order, so the merged
+/// results don't depend on the number of shards or the order that the shard
+/// processes finish in. The shard files are copied in fixed-size chunks, so
+/// the merge doesn't hold a whole shard in memory. They are the same as the results of a single process.
+///
+/// \par RESULTS
+///
+/// The results file has one line per span, weathercase, and condition, in the
+/// model unit system. Results that couldn't be solved are omitted and logged.
+class BatchRunner {
+ public:
+  /// \brief Constructor.
+  BatchRunner();
+
+  /// \brief Destructor.
+  ~BatchRunner();
+
+  /// \brief Runs the batch analysis by splitting the input into shards and
+  ///   starting a process for each shard.
+  /// \return If every shard was analyzed and the results were merged.
+  bool Run();
+
+  /// \brief Runs a single shard in this process.
+  /// \param[in] index_begin
+  ///   The index of the first span to analyze.
+  /// \param[in] index_end
+  ///   The index after the last span to analyze.
+  /// \return If the shard results were written.
+  /// The input filepath needs to be a document.
+  bool RunShard(const int& index_begin, const int& index_end);
+
+  /// \brief Gets the input filepath.
+  /// \return The input filepath.
+  std::string filepath_input() const;
+
+  /// \brief Gets the results filepath.
+  /// \return The results filepath.
+  std::string filepath_results() const;
+
+  /// \brief Gets the maximum number of shard processes.
+  /// \return The maximum number of shard processes.
+  int max_processes() const;
+
+  /// \brief Sets the config filepath that is passed to the shard processes.
+  /// \param[in] filepath_config
+  ///   The config filepath.
+  void set_filepath_config(const std::string& filepath_config);
+
+  /// \brief Sets the input filepath.
+  /// \param[in] filepath_input
+  ///   The input filepath, which is either a document or a directory of
+  ///   documents.
+  void set_filepath_input(const std::string& filepath_input);
+
+  /// \brief Sets the results filepath.
+  /// \param[in] filepath_results
+  ///   The results filepath.
+  void set_filepath_results(const std::string& filepath_results);
+
+  /// \brief Sets the maximum number of shard processes.
+  /// \param[in] max_processes
+  ///   The maximum number of shard processes that run at the same time. If
+  ///   less than one, the number of available CPUs is used.
+  void set_max_processes(const int& max_processes);
+
+  /// \brief Sets the number of spans in each shard.
+  /// \param[in] size_shard
+  ///   The maximum number of spans in each shard.
+  void set_size_shard(const int& size_shard);
+
+  /// \brief Gets the number of spans in each shard.
+  /// \return The maximum number of spans in each shard.
+  int size_shard() const;
+
+ private:
+  /// \brief Analyzes spans and writes the results.
+  /// \param[in] name_doc
+  ///   The document name, which is written with each result.
+  /// \param[in] index_begin
+  ///   The document index of the first span.
+  /// \param[in] spans
+  ///   The spans, in document order.
+  /// \param[in] file
+  ///   The file that the results are written to.
+  /// \return The number of results that couldn't be solved.
+  static int AnalyzeSpans(const std::string& name_doc,
+                          const int& index_begin,
+                          const std::list<Span>& spans,
+                          wxFile& file);
+
+  /// \brief Creates the shards for the input documents.
+  /// \param[out] shards
+  ///   The shards, in document and span order.
+  /// \return If every input document could be read.
+  bool CreateShards(std::vector<BatchShard>& shards) const;
+
+  /// \brief Merges the shard results into the results file.
+  /// \param[in] shards
+  ///   The shards, in document and span order.
+  /// \return If the results file was written successfully.
+  bool MergeShards(const std::vector<BatchShard>& shards) const;
+
+  /// \brief Runs processes for the shards.
+  /// \param[in,out] shards
+  ///   The shards, which are flagged as they complete.
+  void RunProcesses(std::vector<BatchShard>& shards) const;
+
+  /// \brief Writes the results header.
+  /// \param[in] file
+  ///   The results file.
+  static void WriteHeader(wxFile& file);
+
+  /// \var filepath_config_
+  ///   The config filepath that is passed to the shard processes.
+  std::string filepath_config_;
+
+  /// \var filepath_input_
+  ///   The input filepath, which is either a document or a directory.
+  std::string filepath_input_;
+
+  /// \var filepath_results_
+  ///   The results filepath.
+  std::string filepath_results_;
+
+  /// \var max_processes_
+  ///   The maximum number of shard processes that run at the same time.
+  int max_processes_;
+
+  /// \var size_shard_
+  ///   The maximum number of spans in each shard.
+  int size_shard_;
+};
+
+#endif  // SPANANALYZER_BATCH_RUNNER_H_
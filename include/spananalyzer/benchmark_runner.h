@@ -0,0 +1,229 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_BENCHMARK_RUNNER_H_
+#define SPANANALYZER_BENCHMARK_RUNNER_H_
+
+#include <list>
+#include <string>
+
+#include "wx/docview.h"
+
+#include "spananalyzer/polynomial_evaluator.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the measurements of a single benchmark run.
+struct BenchmarkMeasurement {
+  /// \var memory_end
+  ///   The resident memory of the process after the document is analyzed and
+  ///   saved, before it is closed, in kilobytes.
+  long memory_end;
+
+  /// \var memory_peak
+  ///   The peak resident memory of the process during the run, which includes
+  ///   the analysis and reports, in kilobytes.
+  long memory_peak;
+
+  /// \var memory_start
+  ///   The resident memory of the process before the document is opened, in
+  ///   kilobytes.
+  long memory_start;
+
+  /// \var num_spans
+  ///   The number of spans in the document.
+  int num_spans;
+
+  /// \var num_threads
+  ///   The maximum number of threads allowed in the analysis.
+  int num_threads;
+
+  /// \var num_weathercases
+  ///   The number of weathercases in the application data.
+  int num_weathercases;
+
+  /// \var time_analysis
+  ///   The time to analyze every span in the document, in seconds.
+  double time_analysis;
+
+  /// \var time_open
+  ///   The time to open the document, in seconds.
+  double time_open;
+
+  /// \var time_reports
+  ///   The time to update the views (reports and plots) for every span in the
+  ///   document, in seconds.
+  double time_reports;
+
+  /// \var time_save
+  ///   The time to save the document, in seconds.
+  double time_save;
+};
+
+/// \par OVERVIEW
+///
+/// This struct contains the measurements of a cable polynomial benchmark.
+struct BenchmarkPolynomialMeasurement {
+  /// \var degree
+  ///   The polynomial degree.
+  int degree;
+
+  /// \var form
+  ///   The evaluation form that was selected for the polynomial.
+  PolynomialEvaluator::FormType form;
+
+  /// \var name
+  ///   The cable and polynomial name.
+  std::string name;
+
+  /// \var time_compiled
+  ///   The time per evaluation with the selected evaluator, in nanoseconds.
+  double time_compiled;
+
+  /// \var time_generic
+  ///   The time per evaluation with the generic evaluator, in nanoseconds.
+  double time_generic;
+};
+
+/// \par OVERVIEW
+///
+/// This class runs an end-to-end performance benchmark on a document.
+///
+/// \par RUNS
+///
+/// The benchmark is run once for every thread count. Each run:
+///   - opens the document
+///   - activates every span, which runs a full sag-tension analysis
+///   - updates the views for every span, which generates the reports and plots
+///   - saves the document to a temporary file
+///   - closes the document
+///
+/// The application data (cables, weathercases, etc) needs to be loaded before
+/// the benchmark is run. Large documents and application data files can be
+/// synthesized with the scripts in the bench directory.
+///
+/// \par RESULTS
+///
+/// The measurements are written to a comma-separated results file. The
+/// analysis speedup and parallel efficiency are calculated relative to the
+/// first thread count, which provides a strong-scaling curve for the analysis
+/// controller.
+///
+/// \par POLYNOMIALS
+///
+/// The load-strain and creep polynomials of every loaded cable are compiled
+/// and evaluated with the evaluator that is selected for the degree, and with
+/// the generic evaluator. The times are written to a separate results file.
+/// This is a benchmark-only experiment, as the solvers evaluate the
+/// polynomials in the cable elongation model instead.
+class BenchmarkRunner {
+ public:
+  /// \brief Constructor.
+  /// \param[in] manager
+  ///   The document manager.
+  BenchmarkRunner(wxDocManager* manager);
+
+  /// \brief Destructor.
+  ~BenchmarkRunner();
+
+  /// \brief Runs the benchmark.
+  /// \return If the benchmark completed successfully.
+  bool Run();
+
+  /// \brief Gets the document filepath.
+  /// \return The document filepath.
+  std::string filepath_doc() const;
+
+  /// \brief Gets the results filepath.
+  /// \return The results filepath.
+  std::string filepath_results() const;
+
+  /// \brief Gets the measurements.
+  /// \return The measurements.
+  const std::list<BenchmarkMeasurement>& measurements() const;
+
+  /// \brief Gets the polynomial measurements.
+  /// \return The polynomial measurements.
+  const std::list<BenchmarkPolynomialMeasurement>&
+      measurements_polynomials() const;
+
+  /// \brief Sets the document filepath.
+  /// \param[in] filepath_doc
+  ///   The document filepath.
+  void set_filepath_doc(const std::string& filepath_doc);
+
+  /// \brief Sets the results filepath.
+  /// \param[in] filepath_results
+  ///   The results filepath.
+  void set_filepath_results(const std::string& filepath_results);
+
+  /// \brief Sets the thread counts to benchmark.
+  /// \param[in] threads
+  ///   The thread counts. If empty, powers of two up to the number of
+  ///   available CPUs are used.
+  void set_threads(const std::list<int>& threads);
+
+  /// \brief Gets the thread counts to benchmark.
+  /// \return The thread counts.
+  const std::list<int>& threads() const;
+
+ private:
+  /// \brief Gets the peak resident memory of the process.
+  /// \return The peak resident memory since it was last reset, in kilobytes.
+  ///   If the platform doesn't support the query, -1 is returned.
+  static long MemoryPeak();
+
+  /// \brief Gets the current resident memory of the process.
+  /// \return The resident memory, in kilobytes. If the platform doesn't
+  ///   support the query, -1 is returned.
+  static long MemoryResident();
+
+  /// \brief Resets the peak resident memory of the process to the current
+  ///   resident memory.
+  /// On Linux, the high-water mark is reset through /proc/self/clear_refs. On
+  /// Windows the peak working set can't be reset, so the working set is
+  /// trimmed and the peak carries over from previous runs.
+  static void ResetMemoryPeak();
+
+  /// \brief Benchmarks the cable polynomial evaluators.
+  /// \return If the polynomial results file was written successfully.
+  bool RunPolynomials();
+
+  /// \brief Does a single benchmark run.
+  /// \param[in] num_threads
+  ///   The maximum number of analysis threads.
+  /// \param[out] measurement
+  ///   The measurement that is populated.
+  /// \return If the run completed successfully.
+  bool RunSingle(const int& num_threads, BenchmarkMeasurement& measurement);
+
+  /// \brief Writes the measurements to the results file.
+  /// \return If the results file was written successfully.
+  bool WriteResults() const;
+
+  /// \var filepath_doc_
+  ///   The document filepath.
+  std::string filepath_doc_;
+
+  /// \var filepath_results_
+  ///   The results filepath.
+  std::string filepath_results_;
+
+  /// \var manager_
+  ///   The document manager.
+  wxDocManager* manager_;
+
+  /// \var measurements_
+  ///   The measurements, which are ordered the same as the thread counts.
+  std::list<BenchmarkMeasurement> measurements_;
+
+  /// \var measurements_polynomials_
+  ///   The polynomial measurements, which are ordered the same as the cables.
+  std::list<BenchmarkPolynomialMeasurement> measurements_polynomials_;
+
+  /// \var threads_
+  ///   The thread counts to benchmark.
+  std::list<int> threads_;
+};
+
+#endif  // SPANANALYZER_BENCHMARK_RUNNER_H_
@@ -25,7 +25,8 @@ class CableConstraintManagerDialog : public wxDialog {
   /// \param[in] weathercases
   ///   The application weathercases.
   /// \param[in] units
-  ///   The unit system.
+  ///   The display unit system, which the constraints are edited in. The
+  ///   constraints are kept in the model unit system.
   /// \param[in,out] constraints
   ///   The cable constraints to be managed.
   CableConstraintManagerDialog(wxWindow* parent,
@@ -111,9 +112,13 @@ class CableConstraintManagerDialog : public wxDialog {
   wxListCtrl* listctrl_;
 
   /// \var units_
-  ///   The unit system.
+  ///   The display unit system.
   const units::UnitSystem* units_;
 
+  /// \var units_model_
+  ///   The model unit system.
+  units::UnitSystem units_model_;
+
   /// \var weathercases_
   ///   The weathercases for reference only.
   const std::list<WeatherLoadCase*>* weathercases_;
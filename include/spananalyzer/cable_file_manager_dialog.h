@@ -24,7 +24,8 @@ class CableFileManagerDialog : public wxDialog {
   /// \param[in] parent
   ///   The parent window.
   /// \param[in] units
-  ///   The unit system.
+  ///   The display unit system, which the cables are edited in. The cables are
+  ///   kept and saved in the model unit system.
   /// \param[in,out] cablefiles
   ///   The cable files to be managed.
   CableFileManagerDialog(wxWindow* parent,
@@ -45,11 +46,11 @@ class CableFileManagerDialog : public wxDialog {
                              std::list<CableFile*>* list_master);
 
   /// \brief Determines if the cable is referenced.
-  /// \param[in] name
-  ///   The name to check.
+  /// \param[in] cable
+  ///   The cable to check.
   /// \return If the cable file is referenced by the document.
-  /// This function scans the document to see if the cable is referenced.
-  bool IsReferencedByDocument(const std::string& name) const;
+  /// This function looks up the cable in the document span index.
+  bool IsReferencedByDocument(const Cable* cable) const;
 
   /// \brief Determines if the cable name is unique.
   /// \param[in] name
@@ -136,9 +137,13 @@ class CableFileManagerDialog : public wxDialog {
   long index_selected_;
 
   /// \var units_
-  ///   The unit system.
+  ///   The display unit system.
   units::UnitSystem units_;
 
+  /// \var units_model_
+  ///   The model unit system.
+  units::UnitSystem units_model_;
+
   DECLARE_EVENT_TABLE()
 };
 
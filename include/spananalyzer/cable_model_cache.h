@@ -0,0 +1,315 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_CABLE_MODEL_CACHE_H_
+#define SPANANALYZER_CABLE_MODEL_CACHE_H_
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "models/sagtension/cable_elongation_model.h"
+
+/// \par OVERVIEW
+///
+/// This struct is a dense lookup table of a function that is sampled at evenly
+/// spaced points.
+struct CableModelTable {
+  /// \var error
+  ///   The largest interpolation error that was checked, excluding the exact
+  ///   intervals.
+  double error;
+
+  /// \var is_exact
+  ///   The intervals that aren't interpolated, because they contain a
+  ///   breakpoint or exceed the error tolerance.
+  std::vector<char> is_exact;
+
+  /// \var step
+  ///   The spacing of the sampled points.
+  double step;
+
+  /// \var values
+  ///   The sampled function values. There is one more value than intervals.
+  std::vector<double> values;
+
+  /// \var x_min
+  ///   The first sampled point.
+  double x_min;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a cable elongation model that is compiled for a cable, cable
+/// state, and stretch state, so it can be shared read-only by many threads and
+/// views.
+///
+/// \par BREAKPOINTS
+///
+/// The component curves change equations at the polynomial load limits, and
+/// where the components start carrying load. The strains at these breakpoints
+/// are solved when the model is compiled.
+///
+/// \par LOOKUP TABLES
+///
+/// Optionally, the load of each component is tabulated over the strain range
+/// that is plotted. The tables start coarse and are refined until the linear
+/// interpolation error at every interval midpoint is within a tolerance of the
+/// rated strength. Intervals that contain a breakpoint, or still exceed the
+/// tolerance when the table reaches its size limit, are flagged and solved
+/// with the elongation model instead. Loads outside of the table are also
+/// solved with the elongation model.
+///
+/// \par THREAD SAFETY
+///
+/// The elongation model is evaluated while compiling, so it is fully updated
+/// before the compiled model is shared. After compiling, all of the functions
+/// are read-only.
+class CompiledCableModel {
+ public:
+  /// \brief Constructor.
+  CompiledCableModel();
+
+  /// \brief Destructor.
+  ~CompiledCableModel();
+
+  /// \brief Compiles the model.
+  /// \param[in] cable
+  ///   The cable.
+  /// \param[in] state
+  ///   The cable state.
+  /// \param[in] state_stretch
+  ///   The cable stretch state.
+  /// \param[in] is_tabulated
+  ///   An indicator that determines if the component loads are tabulated.
+  /// \return If the elongation model is valid.
+  /// This can only be called once, as the elongation model references the
+  /// sag-tension cable member.
+  bool Compile(const Cable* cable, const CableState& state,
+               const CableStretchState& state_stretch,
+               const bool& is_tabulated);
+
+  /// \brief Gets the load of a component.
+  /// \param[in] type_component
+  ///   The component type.
+  /// \param[in] strain
+  ///   The strain.
+  /// \return The load. This is interpolated if the strain is within an
+  ///   interpolated table interval.
+  double Load(const CableElongationModel::ComponentType& type_component,
+              const double& strain) const;
+
+  /// \brief Gets the memory used by the model.
+  /// \return The memory used by the model and its lookup tables, in bytes.
+  ///   Allocations inside the elongation model aren't included.
+  long SizeMemory() const;
+
+  /// \brief Gets the strain of a component.
+  /// \param[in] type_component
+  ///   The component type.
+  /// \param[in] load
+  ///   The load.
+  /// \return The strain, which is always solved with the elongation model.
+  double Strain(const CableElongationModel::ComponentType& type_component,
+                const double& load) const;
+
+  /// \brief Gets the unloaded strain of a component.
+  /// \param[in] type_component
+  ///   The component type.
+  /// \return The unloaded strain.
+  double StrainUnloaded(
+      const CableElongationModel::ComponentType& type_component) const;
+
+  /// \brief Gets the component breakpoint strains.
+  /// \return The breakpoint strains of all components, in increasing order.
+  const std::vector<double>& breakpoints() const;
+
+  /// \brief Gets the sag-tension cable.
+  /// \return The sag-tension cable.
+  const SagTensionCable* cable() const;
+
+  /// \brief Gets the largest interpolation error of the lookup tables.
+  /// \return The largest interpolation error, in load units.
+  double error() const;
+
+  /// \brief Gets if the component loads are tabulated.
+  /// \return If the component loads are tabulated.
+  bool is_tabulated() const;
+
+  /// \brief Gets the elongation model.
+  /// \return The elongation model.
+  const CableElongationModel* model() const;
+
+ private:
+  /// \brief Gets the index of a component.
+  /// \param[in] type_component
+  ///   The component type.
+  /// \return The index of the component arrays.
+  static int IndexComponent(
+      const CableElongationModel::ComponentType& type_component);
+
+  /// \brief Builds the lookup table of a component.
+  /// \param[in] type_component
+  ///   The component type.
+  /// \param[out] table
+  ///   The lookup table.
+  void UpdateTable(const CableElongationModel::ComponentType& type_component,
+                   CableModelTable& table) const;
+
+  /// \var breakpoints_
+  ///   The component breakpoint strains, in increasing order.
+  std::vector<double> breakpoints_;
+
+  /// \var cable_
+  ///   The sag-tension cable used by the elongation model.
+  SagTensionCable cable_;
+
+  /// \var error_
+  ///   The largest interpolation error of the lookup tables.
+  double error_;
+
+  /// \var is_tabulated_
+  ///   An indicator that tells if the component loads are tabulated.
+  bool is_tabulated_;
+
+  /// \var model_
+  ///   The cable elongation model.
+  CableElongationModel model_;
+
+  /// \var strains_unloaded_
+  ///   The unloaded strain of each component.
+  double strains_unloaded_[3];
+
+  /// \var tables_
+  ///   The load lookup table of each component.
+  CableModelTable tables_[3];
+};
+
+/// \par OVERVIEW
+///
+/// This class is a cache of compiled cable elongation models, which are shared
+/// by the analysis threads, solvers, and plots.
+///
+/// \par KEYS
+///
+/// The models are keyed by the cable address, the cable state (temperature and
+/// polynomial), and the stretch state. Models for cable files are reused by
+/// every span and view that has a matching state. The cable addresses are
+/// never dereferenced after compiling, so the cache needs to be cleared when
+/// the application data changes.
+///
+/// \par MEMORY BUDGET
+///
+/// The models that are held are limited by a memory budget. When the budget is
+/// exceeded, the least recently used models are evicted.
+///
+/// \par THREAD SAFETY
+///
+/// The cache can be accessed by multiple threads. Models are compiled without
+/// the cache locked, so a thread that is compiling doesn't block the others.
+/// If two threads compile the same model at once, the first one is kept. The
+/// models are returned as shared pointers, so clearing or evicting a model
+/// doesn't invalidate it while it is still in use.
+class CableModelCache {
+ public:
+  /// \brief Constructor.
+  CableModelCache();
+
+  /// \brief Destructor.
+  ~CableModelCache();
+
+  /// \brief Clears all of the models.
+  void Clear();
+
+  /// \brief Gets a compiled model, and compiles it if it isn't cached.
+  /// \param[in] cable
+  ///   The cable.
+  /// \param[in] state
+  ///   The cable state.
+  /// \param[in] state_stretch
+  ///   The cable stretch state.
+  /// \param[in] is_tabulated
+  ///   An indicator that determines if the model needs lookup tables. A cached
+  ///   model without tables is recompiled with tables.
+  /// \return The compiled model. If the model isn't valid, a nullptr is
+  ///   returned.
+  std::shared_ptr<const CompiledCableModel> Model(
+      const Cable* cable, const CableState& state,
+      const CableStretchState& state_stretch, const bool& is_tabulated);
+
+  /// \brief Sets the memory budget.
+  /// \param[in] size_budget
+  ///   The memory budget, in bytes.
+  void set_size_budget(const long& size_budget);
+
+  /// \brief Gets the number of cached models.
+  /// \return The number of cached models.
+  int size() const;
+
+  /// \brief Gets the memory budget.
+  /// \return The memory budget, in bytes.
+  long size_budget() const;
+
+  /// \brief Gets the memory used by the cached models.
+  /// \return The memory used by the cached models, in bytes.
+  long size_memory() const;
+
+ private:
+  /// \par OVERVIEW
+  ///
+  /// This struct is a cached model.
+  struct Entry {
+    /// \var key
+    ///   The model key.
+    std::string key;
+
+    /// \var model
+    ///   The compiled model.
+    std::shared_ptr<const CompiledCableModel> model;
+
+    /// \var size
+    ///   The memory used by the model, in bytes.
+    long size;
+  };
+
+  /// \brief Evicts the least recently used models until the memory budget is
+  ///   met.
+  /// The cache must be locked.
+  void Evict();
+
+  /// \brief Generates a key for a model.
+  /// \param[in] cable
+  ///   The cable.
+  /// \param[in] state
+  ///   The cable state.
+  /// \param[in] state_stretch
+  ///   The cable stretch state.
+  /// \return The key, which is only valid within the same process.
+  static std::string Key(const Cable* cable, const CableState& state,
+                         const CableStretchState& state_stretch);
+
+  /// \var entries_
+  ///   The cached models, ordered from most to least recently used.
+  std::list<Entry> entries_;
+
+  /// \var index_
+  ///   The entry index, which is keyed by cable and state.
+  std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+
+  /// \var mutex_
+  ///   The mutex that protects the entries.
+  mutable std::mutex mutex_;
+
+  /// \var size_budget_
+  ///   The memory budget, in bytes.
+  long size_budget_;
+
+  /// \var size_memory_
+  ///   The memory used by the cached models, in bytes.
+  long size_memory_;
+};
+
+#endif  // SPANANALYZER_CABLE_MODEL_CACHE_H_
@@ -14,6 +14,7 @@
 #include "appcommon/graphics/text_data_set_2d.h"
 #include "models/sagtension/cable_elongation_model.h"
 
+#include "spananalyzer/cable_model_cache.h"
 #include "spananalyzer/sag_tension_analysis_result.h"
 #include "spananalyzer/span_analyzer_config.h"
 
@@ -67,22 +68,22 @@ class CablePlotPane : public PlotPane2d {
 
   /// \brief Updates a cable dataset.
   /// \param[in] model
-  ///   The cable elongation model used to calculate the dataset points.
+  ///   The compiled cable model used to calculate the dataset points.
   /// \param[in] type_component
   ///   The type of component to calculate data for.
   /// \param[out] dataset
   ///   The dataset to populate.
   void UpdateDataSetCable(
-      const CableElongationModel& model,
+      const CompiledCableModel& model,
       const CableElongationModel::ComponentType& type_component,
       LineDataSet2d& dataset);
 
   /// \brief Updates the circle marker dataset.
   /// \param[in] model
-  ///   The cable elongation model.
+  ///   The compiled cable model.
   /// \param[in] result
   ///   The sag-tension result.
-  void UpdateDataSetMarker(const CableElongationModel& model,
+  void UpdateDataSetMarker(const CompiledCableModel& model,
                            const SagTensionAnalysisResult* result);
 
   /// \brief Updates the plot datasets.
@@ -97,8 +98,8 @@ class CablePlotPane : public PlotPane2d {
 
   /// \brief Updates the strain values.
   /// \param[in] model
-  ///   The cable elongation model.
-  void UpdateStrains(const CableElongationModel& model);
+  ///   The compiled cable model.
+  void UpdateStrains(const CompiledCableModel& model);
 
   /// \var dataset_axis_lines_
   ///   The dataset for the axis lines.
@@ -0,0 +1,119 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_CATENARY_BATCH_H_
+#define SPANANALYZER_CATENARY_BATCH_H_
+
+#include <vector>
+
+#include "models/transmissionline/catenary.h"
+
+/// \par OVERVIEW
+///
+/// This class solves catenary quantities in batches, which is faster than
+/// solving the Catenary3d class one value at a time. It can solve:
+/// - one quantity (length, sag, support tension) for many catenaries
+/// - coordinates at many positions along one catenary
+///
+/// \par DATA LAYOUT
+///
+/// Catenaries are appended to the batch and stored as a structure of arrays,
+/// so each catenary parameter is contiguous in memory and can be loaded into
+/// vector registers.
+///
+/// \par CATENARY PLANE
+///
+/// The 3D end point spacing is projected onto the 2D catenary plane, which is
+/// aligned with the resultant unit load. The vertical spacing is scaled by the
+/// ratio of vertical to resultant unit weight, and the horizontal spacing is
+/// solved so the chord length is preserved. Coordinates are solved on the
+/// catenary plane and then rotated back to the 3D coordinate system, with the
+/// origin at the start point.
+///
+/// \par INSTRUCTION SETS
+///
+/// The equations are solved with AVX2 or SSE2 vector instructions, and with
+/// scalar instructions for the remainder. The instruction set is selected at
+/// runtime based on the processor. The results are identical for every
+/// instruction set.
+class CatenaryBatch {
+ public:
+  /// \brief These are the instruction sets that can solve the batch.
+  enum class InstructionSet {
+    kAvx2,
+    kScalar,
+    kSse2,
+  };
+
+  /// \brief Constructor.
+  CatenaryBatch();
+
+  /// \brief Destructor.
+  ~CatenaryBatch();
+
+  /// \brief Appends a catenary to the batch.
+  /// \param[in] catenary
+  ///   The catenary, which should be valid.
+  void Append(const Catenary3d& catenary);
+
+  /// \brief Clears the batch.
+  void Clear();
+
+  /// \brief Solves coordinates along a catenary.
+  /// \param[in] catenary
+  ///   The catenary, which should be valid.
+  /// \param[in] positions
+  ///   The positions, as fractions of the curve length from the start point.
+  /// \param[out] coordinates
+  ///   The coordinates, with the origin at the start point.
+  static void Coordinates(const Catenary3d& catenary,
+                          const std::vector<double>& positions,
+                          std::vector<Point3d<double>>& coordinates);
+
+  /// \brief Solves the curve lengths.
+  /// \param[out] lengths
+  ///   The lengths, in the order the catenaries were appended.
+  void Lengths(std::vector<double>& lengths) const;
+
+  /// \brief Reserves memory for catenaries.
+  /// \param[in] size
+  ///   The number of catenaries.
+  void Reserve(const int& size);
+
+  /// \brief Solves the sags.
+  /// \param[out] sags
+  ///   The sags, in the order the catenaries were appended.
+  void Sags(std::vector<double>& sags) const;
+
+  /// \brief Solves the maximum support tensions.
+  /// \param[out] tensions
+  ///   The tensions, in the order the catenaries were appended.
+  void TensionsMax(std::vector<double>& tensions) const;
+
+  /// \brief Gets the instruction set that is used.
+  /// \return The widest instruction set that the processor supports.
+  static InstructionSet instruction_set();
+
+  /// \brief Gets the number of catenaries.
+  /// \return The number of catenaries.
+  int size() const;
+
+ private:
+  /// \var spacings_horizontal_
+  ///   The horizontal end point spacings on the catenary plane.
+  std::vector<double> spacings_horizontal_;
+
+  /// \var spacings_vertical_
+  ///   The vertical end point spacings on the catenary plane.
+  std::vector<double> spacings_vertical_;
+
+  /// \var tensions_horizontal_
+  ///   The horizontal tensions.
+  std::vector<double> tensions_horizontal_;
+
+  /// \var weights_unit_
+  ///   The resultant unit weights.
+  std::vector<double> weights_unit_;
+};
+
+#endif  // SPANANALYZER_CATENARY_BATCH_H_
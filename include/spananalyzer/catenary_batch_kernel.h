@@ -0,0 +1,409 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_CATENARY_BATCH_KERNEL_H_
+#define SPANANALYZER_CATENARY_BATCH_KERNEL_H_
+
+#include <cstdint>
+
+/// \par OVERVIEW
+///
+/// This namespace has the vectorized catenary equations that are used by the
+/// CatenaryBatch class. The functions are templated on an operations struct,
+/// which wraps the instructions for a vector width. An operations struct has:
+/// - a Vector type and a kSize lane count
+/// - Load(), Store(), Set() and SetBits()
+/// - Add(), Sub(), Mul(), Div(), Sqrt(), Min() and Max()
+/// - And(), Or(), LessThan() and Select(), which work on the bit pattern
+/// - ShiftLeft52() and ShiftRight52(), which shift the bit pattern
+///
+/// \par PRECISION
+///
+/// The exponential and logarithm are evaluated with the same polynomials for
+/// every vector width, and fused multiply-add instructions are not used. The
+/// results are identical for every instruction set.
+///
+/// \par DOMAIN
+///
+/// The catenaries must have a positive horizontal spacing, horizontal tension
+/// and unit weight, which is what a validated Catenary3d has. The inputs are
+/// not checked.
+namespace catenary_batch_kernel {
+
+/// \brief These are the catenary quantities that can be solved in a batch.
+enum class QuantityType {
+  kLength,
+  kSag,
+  kTensionMax,
+};
+
+/// \par OVERVIEW
+///
+/// This struct has the constants that are needed to solve coordinates along
+/// one catenary. The coordinate system origin is the catenary lowpoint.
+struct CoordinateParameters {
+  /// \var constant
+  ///   The catenary constant (H/w).
+  double constant;
+
+  /// \var length
+  ///   The curve length between the end points.
+  double length;
+
+  /// \var length_start
+  ///   The signed curve length from the lowpoint to the start point.
+  double length_start;
+
+  /// \var x_start
+  ///   The x coordinate of the start point.
+  double x_start;
+
+  /// \var y_start
+  ///   The y coordinate of the start point.
+  double y_start;
+};
+
+/// \var kBitsMantissa
+///   The mantissa bits of a double.
+const uint64_t kBitsMantissa = 0x000FFFFFFFFFFFFFULL;
+
+/// \var kBitsOne
+///   The bit pattern of 1.0.
+const uint64_t kBitsOne = 0x3FF0000000000000ULL;
+
+/// \var kBitsSign
+///   The sign bit of a double.
+const uint64_t kBitsSign = 0x8000000000000000ULL;
+
+/// \var kBitsTwo52
+///   The bit pattern of 2^52.
+const uint64_t kBitsTwo52 = 0x4330000000000000ULL;
+
+/// \var kLn2Hi
+///   The high part of ln(2), which has enough trailing zeros that it can be
+///   multiplied by an exponent exactly.
+const double kLn2Hi = 6.93145751953125E-1;
+
+/// \var kLn2Lo
+///   The low part of ln(2).
+const double kLn2Lo = 1.42860682030941723212E-6;
+
+/// \var kLog2e
+///   The base 2 logarithm of e.
+const double kLog2e = 1.4426950408889634074;
+
+/// \var kRound
+///   A number that rounds a double to the nearest integer when it is added
+///   and subtracted (1.5 * 2^52).
+const double kRound = 6755399441055744.0;
+
+/// \var kTwo52
+///   2^52, which is used to convert between integer bits and doubles.
+const double kTwo52 = 4503599627370496.0;
+
+/// \brief Solves the exponential.
+/// \param[in] x
+///   The exponent, which is clamped to avoid overflow.
+/// \return The exponential.
+/// The exponent is reduced to r = x - k*ln(2) and e^r is evaluated with a
+/// degree 13 Taylor polynomial, which is accurate to a few ulp over the
+/// reduced range.
+template<typename Ops>
+typename Ops::Vector Exp(const typename Ops::Vector& x) {
+  typedef typename Ops::Vector V;
+
+  const V x_clamped = Ops::Min(Ops::Max(x, Ops::Set(-708)), Ops::Set(709));
+
+  // rounds the base 2 exponent to the nearest integer
+  const V k = Ops::Sub(
+      Ops::Add(Ops::Mul(x_clamped, Ops::Set(kLog2e)), Ops::Set(kRound)),
+      Ops::Set(kRound));
+
+  // reduces the range
+  V r = Ops::Sub(x_clamped, Ops::Mul(k, Ops::Set(kLn2Hi)));
+  r = Ops::Sub(r, Ops::Mul(k, Ops::Set(kLn2Lo)));
+
+  // evaluates the polynomial
+  V p = Ops::Set(1.0 / 6227020800.0);
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 479001600.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 39916800.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 3628800.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 362880.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 40320.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 5040.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 720.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 120.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 24.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0 / 6.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(0.5));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0));
+  p = Ops::Add(Ops::Mul(p, r), Ops::Set(1.0));
+
+  // scales by 2^k
+  // the integer k + 1023 is placed in the low bits of 2^52 + k + 1023, and is
+  // then shifted into the exponent field
+  const V scale = Ops::ShiftLeft52(
+      Ops::Add(k, Ops::Set(kTwo52 + 1023)));
+
+  return Ops::Mul(p, scale);
+}
+
+/// \brief Solves the natural logarithm.
+/// \param[in] x
+///   The value, which must be a normal number that is at least one.
+/// \return The natural logarithm.
+/// The value is split into x = m * 2^e, with m in [sqrt(2)/2, sqrt(2)), and
+/// ln(m) is evaluated with the series 2*atanh((m - 1) / (m + 1)).
+template<typename Ops>
+typename Ops::Vector Log(const typename Ops::Vector& x) {
+  typedef typename Ops::Vector V;
+
+  // gets the exponent field as a double
+  V e = Ops::Sub(Ops::Or(Ops::ShiftRight52(x), Ops::SetBits(kBitsTwo52)),
+                 Ops::Set(kTwo52));
+  e = Ops::Sub(e, Ops::Set(1023));
+
+  // gets the mantissa in [1, 2), and then shifts it to be centered on 1
+  V m = Ops::Or(Ops::And(x, Ops::SetBits(kBitsMantissa)),
+                Ops::SetBits(kBitsOne));
+  const V is_high = Ops::LessThan(Ops::Set(1.41421356237309504880), m);
+  m = Ops::Select(is_high, Ops::Mul(m, Ops::Set(0.5)), m);
+  e = Ops::Select(is_high, Ops::Add(e, Ops::Set(1)), e);
+
+  // evaluates the series
+  const V s = Ops::Div(Ops::Sub(m, Ops::Set(1)), Ops::Add(m, Ops::Set(1)));
+  const V z = Ops::Mul(s, s);
+  V p = Ops::Set(1.0 / 23.0);
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 21.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 19.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 17.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 15.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 13.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 11.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 9.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 7.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 5.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0 / 3.0));
+  p = Ops::Add(Ops::Mul(p, z), Ops::Set(1.0));
+  const V log_m = Ops::Mul(Ops::Mul(Ops::Set(2), s), p);
+
+  return Ops::Add(Ops::Mul(e, Ops::Set(kLn2Hi)),
+                  Ops::Add(Ops::Mul(e, Ops::Set(kLn2Lo)), log_m));
+}
+
+/// \brief Solves the inverse hyperbolic sine.
+/// \param[in] x
+///   The value.
+/// \return The inverse hyperbolic sine.
+template<typename Ops>
+typename Ops::Vector Asinh(const typename Ops::Vector& x) {
+  typedef typename Ops::Vector V;
+
+  // solves for the magnitude and restores the sign
+  // large values use ln(2t) to avoid overflowing t^2
+  const V t = Ops::And(x, Ops::SetBits(~kBitsSign));
+  const V is_large = Ops::LessThan(Ops::Set(1e8), t);
+  const V arg = Ops::Select(
+      is_large, t,
+      Ops::Add(t, Ops::Sqrt(Ops::Add(Ops::Mul(t, t), Ops::Set(1)))));
+
+  V value = Log<Ops>(arg);
+  value = Ops::Select(is_large, Ops::Add(value, Ops::Set(kLn2Hi + kLn2Lo)),
+                      value);
+
+  return Ops::Or(value, Ops::And(x, Ops::SetBits(kBitsSign)));
+}
+
+/// \brief Solves the hyperbolic cosine.
+/// \param[in] x
+///   The value.
+/// \return The hyperbolic cosine.
+template<typename Ops>
+typename Ops::Vector Cosh(const typename Ops::Vector& x) {
+  const typename Ops::Vector e = Exp<Ops>(x);
+  return Ops::Mul(Ops::Add(e, Ops::Div(Ops::Set(1), e)), Ops::Set(0.5));
+}
+
+/// \brief Solves the hyperbolic sine.
+/// \param[in] x
+///   The value.
+/// \return The hyperbolic sine.
+template<typename Ops>
+typename Ops::Vector Sinh(const typename Ops::Vector& x) {
+  const typename Ops::Vector e = Exp<Ops>(x);
+  return Ops::Mul(Ops::Sub(e, Ops::Div(Ops::Set(1), e)), Ops::Set(0.5));
+}
+
+/// \brief Solves the end point x coordinates of catenaries.
+/// \param[in] spacing_horizontal
+///   The horizontal end point spacing.
+/// \param[in] spacing_vertical
+///   The vertical end point spacing.
+/// \param[in] constant
+///   The catenary constant (H/w).
+/// \param[out] x_start
+///   The x coordinate of the start point.
+/// \param[out] x_end
+///   The x coordinate of the end point.
+template<typename Ops>
+void EndPoints(const typename Ops::Vector& spacing_horizontal,
+               const typename Ops::Vector& spacing_vertical,
+               const typename Ops::Vector& constant,
+               typename Ops::Vector& x_start,
+               typename Ops::Vector& x_end) {
+  typedef typename Ops::Vector V;
+
+  // the chord midpoint is offset from the lowpoint by
+  // c * asinh(B / (2c * sinh(A / 2c)))
+  const V half = Ops::Mul(spacing_horizontal, Ops::Set(0.5));
+  const V sinh_half = Sinh<Ops>(Ops::Div(half, constant));
+  const V x_mid = Ops::Mul(constant, Asinh<Ops>(Ops::Div(
+      spacing_vertical,
+      Ops::Mul(Ops::Mul(Ops::Set(2), constant), sinh_half))));
+
+  x_start = Ops::Sub(x_mid, half);
+  x_end = Ops::Add(x_mid, half);
+}
+
+/// \brief Solves a quantity for a batch of catenaries.
+/// \param[in] type
+///   The quantity type.
+/// \param[in] spacings_horizontal
+///   The horizontal end point spacings on the catenary plane.
+/// \param[in] spacings_vertical
+///   The vertical end point spacings on the catenary plane.
+/// \param[in] tensions_horizontal
+///   The horizontal tensions.
+/// \param[in] weights_unit
+///   The unit weight magnitudes.
+/// \param[in] size
+///   The number of catenaries.
+/// \param[out] values
+///   The quantity values.
+/// \return The number of catenaries that were solved, which is the largest
+///   multiple of the vector width. The remainder is left for a narrower
+///   vector width.
+template<typename Ops>
+int SolveQuantity(const QuantityType& type,
+                  const double* spacings_horizontal,
+                  const double* spacings_vertical,
+                  const double* tensions_horizontal,
+                  const double* weights_unit,
+                  const int& size,
+                  double* values) {
+  typedef typename Ops::Vector V;
+
+  int index = 0;
+  for (; index + Ops::kSize <= size; index += Ops::kSize) {
+    const V a = Ops::Load(spacings_horizontal + index);
+    const V b = Ops::Load(spacings_vertical + index);
+    const V h = Ops::Load(tensions_horizontal + index);
+    const V c = Ops::Div(h, Ops::Load(weights_unit + index));
+
+    V x_start;
+    V x_end;
+    EndPoints<Ops>(a, b, c, x_start, x_end);
+
+    V value;
+    if (type == QuantityType::kLength) {
+      value = Ops::Mul(c, Ops::Sub(Sinh<Ops>(Ops::Div(x_end, c)),
+                                   Sinh<Ops>(Ops::Div(x_start, c))));
+    } else if (type == QuantityType::kSag) {
+      // the sag point is where the curve slope matches the chord slope
+      const V slope = Ops::Div(b, a);
+      const V x_sag = Ops::Mul(c, Asinh<Ops>(slope));
+      const V y_sag = Ops::Mul(
+          c, Ops::Sub(Cosh<Ops>(Ops::Div(x_sag, c)), Ops::Set(1)));
+      const V y_start = Ops::Mul(
+          c, Ops::Sub(Cosh<Ops>(Ops::Div(x_start, c)), Ops::Set(1)));
+      const V y_chord = Ops::Add(
+          y_start, Ops::Mul(Ops::Sub(x_sag, x_start), slope));
+      value = Ops::Sub(y_chord, y_sag);
+    } else {
+      // the support tension is largest at the end point furthest from the
+      // lowpoint
+      value = Ops::Mul(h, Ops::Max(Cosh<Ops>(Ops::Div(x_start, c)),
+                                   Cosh<Ops>(Ops::Div(x_end, c))));
+    }
+
+    Ops::Store(values + index, value);
+  }
+
+  return index;
+}
+
+/// \brief Solves coordinates along one catenary.
+/// \param[in] parameters
+///   The catenary parameters.
+/// \param[in] positions
+///   The positions, as fractions of the curve length from the start point.
+/// \param[in] size
+///   The number of positions.
+/// \param[out] x
+///   The x coordinates, relative to the start point.
+/// \param[out] y
+///   The y coordinates, relative to the start point.
+/// \return The number of positions that were solved, which is the largest
+///   multiple of the vector width.
+template<typename Ops>
+int SolveCoordinates(const CoordinateParameters& parameters,
+                     const double* positions,
+                     const int& size,
+                     double* x,
+                     double* y) {
+  typedef typename Ops::Vector V;
+
+  const V c = Ops::Set(parameters.constant);
+  const V length = Ops::Set(parameters.length);
+  const V length_start = Ops::Set(parameters.length_start);
+  const V x_start = Ops::Set(parameters.x_start);
+  const V y_start = Ops::Set(parameters.y_start);
+
+  int index = 0;
+  for (; index + Ops::kSize <= size; index += Ops::kSize) {
+    // the curve length from the lowpoint is c * sinh(x / c)
+    const V s = Ops::Add(length_start,
+                         Ops::Mul(Ops::Load(positions + index), length));
+    const V x_point = Ops::Mul(c, Asinh<Ops>(Ops::Div(s, c)));
+    const V y_point = Ops::Mul(
+        c, Ops::Sub(Cosh<Ops>(Ops::Div(x_point, c)), Ops::Set(1)));
+
+    Ops::Store(x + index, Ops::Sub(x_point, x_start));
+    Ops::Store(y + index, Ops::Sub(y_point, y_start));
+  }
+
+  return index;
+}
+
+/// \brief Determines if the AVX2 functions were compiled with AVX2
+///   instructions.
+/// \return If the AVX2 functions are available.
+bool IsCompiledAvx2();
+
+/// \brief Solves a quantity with AVX2 instructions.
+/// \return The number of catenaries that were solved. This is zero if the
+///   application wasn't built with AVX2 support.
+/// This is defined in a separate translation unit that is compiled for AVX2,
+/// and must only be called if the processor supports AVX2.
+int SolveQuantityAvx2(const QuantityType& type,
+                      const double* spacings_horizontal,
+                      const double* spacings_vertical,
+                      const double* tensions_horizontal,
+                      const double* weights_unit,
+                      const int& size,
+                      double* values);
+
+/// \brief Solves coordinates with AVX2 instructions.
+/// \return The number of positions that were solved. This is zero if the
+///   application wasn't built with AVX2 support.
+/// This is defined in a separate translation unit that is compiled for AVX2,
+/// and must only be called if the processor supports AVX2.
+int SolveCoordinatesAvx2(const CoordinateParameters& parameters,
+                         const double* positions,
+                         const int& size,
+                         double* x,
+                         double* y);
+
+}  // namespace catenary_batch_kernel
+
+#endif  // SPANANALYZER_CATENARY_BATCH_KERNEL_H_
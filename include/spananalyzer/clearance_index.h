@@ -0,0 +1,219 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_CLEARANCE_INDEX_H_
+#define SPANANALYZER_CLEARANCE_INDEX_H_
+
+#include <vector>
+
+#include "models/transmissionline/catenary.h"
+
+#include "spananalyzer/span.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the clearance of a curve to a set of profile points.
+struct ClearanceResult {
+  /// \var clearance
+  ///   The vertical clearance at the governing point, which is the point with
+  ///   the smallest margin.
+  double clearance;
+
+  /// \var clearance_required
+  ///   The required clearance at the governing point.
+  double clearance_required;
+
+  /// \var num_points
+  ///   The number of profile points that are within the span.
+  int num_points;
+
+  /// \var num_violations
+  ///   The number of profile points that don't have the required clearance.
+  int num_violations;
+
+  /// \var station
+  ///   The station of the governing point.
+  double station;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a piecewise-linear profile of a catenary, which can be
+/// queried for the elevation at a station.
+///
+/// \par POINTS
+///
+/// The catenary is sampled at evenly spaced positions along the curve, like
+/// the profile plot. The error of the linear interpolation is approximately
+/// the sag divided by the square of the number of segments.
+///
+/// \par RANGE MINIMUMS
+///
+/// A sparse table of the point elevations is built, so the minimum elevation
+/// over a station range can be found in constant time after the range is
+/// located.
+class ClearanceCurve {
+ public:
+  /// \brief Constructor.
+  ClearanceCurve();
+
+  /// \brief Gets the elevation at a station.
+  /// \param[in] station
+  ///   The station, which must be within the curve.
+  /// \return The elevation.
+  double Elevation(const double& station) const;
+
+  /// \brief Gets the minimum elevation over a station range.
+  /// \param[in] station_begin
+  ///   The first station, which must be within the curve.
+  /// \param[in] station_end
+  ///   The last station, which must be within the curve.
+  /// \return The minimum elevation.
+  double ElevationMin(const double& station_begin,
+                      const double& station_end) const;
+
+  /// \brief Sets the catenary and samples the points.
+  /// \param[in] catenary
+  ///   The catenary, which must have a positive horizontal spacing.
+  void set_catenary(const Catenary3d& catenary);
+
+  /// \brief Gets the last station of the curve.
+  /// \return The last station of the curve.
+  double station_max() const;
+
+ private:
+  /// \brief Gets the segment that contains a station.
+  /// \param[in] station
+  ///   The station.
+  /// \return The index of the first point of the segment.
+  int IndexSegment(const double& station) const;
+
+  /// \var elevations_
+  ///   The point elevations.
+  std::vector<double> elevations_;
+
+  /// \var elevations_min_
+  ///   The sparse table of minimum point elevations. Level k contains the
+  ///   minimum elevation of the 2^k points that start at each index.
+  std::vector<std::vector<double>> elevations_min_;
+
+  /// \var stations_
+  ///   The point stations, which are increasing.
+  std::vector<double> stations_;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a spatial index of the profile points of a span, which finds
+/// the clearance of a curve without checking every point.
+///
+/// \par TREE
+///
+/// The points are sorted by station and stored in a balanced segment tree.
+/// Each node holds the station range, the highest elevation, and the largest
+/// required clearance of its points. Leaf nodes hold a small bucket of points.
+///
+/// \par QUERIES
+///
+/// The lowest curve elevation over a node station range, minus the node
+/// elevation and required clearance, is a lower bound of the clearance margin
+/// of every point in the node. Nodes are skipped when the bound can't improve
+/// the governing point and can't contain a violation, so a query typically
+/// only visits the nodes near the low point of the curve and the high points
+/// of the profile.
+///
+/// \par THREADS
+///
+/// The index isn't modified by queries, so it can be shared by threads.
+class ClearanceIndex {
+ public:
+  /// \brief Constructor.
+  ClearanceIndex();
+
+  /// \brief Builds the index.
+  /// \param[in] profile
+  ///   The profile points, in any order.
+  void Build(const std::vector<ProfilePoint>& profile);
+
+  /// \brief Clears the index.
+  void Clear();
+
+  /// \brief Finds the clearance of a curve.
+  /// \param[in] curve
+  ///   The curve.
+  /// \param[out] result
+  ///   The clearance result. Only points that are within the curve station
+  ///   range are checked.
+  void Query(const ClearanceCurve& curve, ClearanceResult& result) const;
+
+  /// \brief Gets the number of points.
+  /// \return The number of points.
+  int size() const;
+
+ private:
+  /// \par OVERVIEW
+  ///
+  /// This struct is a node in the segment tree.
+  struct Node {
+    /// \var clearance_max
+    ///   The largest required clearance of the node points.
+    double clearance_max;
+
+    /// \var elevation_max
+    ///   The highest elevation of the node points.
+    double elevation_max;
+
+    /// \var index_begin
+    ///   The first point index.
+    int index_begin;
+
+    /// \var index_end
+    ///   The point index after the last point.
+    int index_end;
+
+    /// \var index_left
+    ///   The left child node index, or -1 for a leaf node.
+    int index_left;
+
+    /// \var index_right
+    ///   The right child node index, or -1 for a leaf node.
+    int index_right;
+
+    /// \var station_max
+    ///   The largest station of the node points.
+    double station_max;
+
+    /// \var station_min
+    ///   The smallest station of the node points.
+    double station_min;
+  };
+
+  /// \brief Builds a node and its children.
+  /// \param[in] index_begin
+  ///   The first point index.
+  /// \param[in] index_end
+  ///   The point index after the last point.
+  /// \return The node index.
+  int BuildNode(const int& index_begin, const int& index_end);
+
+  /// \brief Gets the lower bound of the clearance margin of a node.
+  /// \param[in] node
+  ///   The node.
+  /// \param[in] curve
+  ///   The curve.
+  /// \param[out] bound
+  ///   The lower bound.
+  /// \return If the node overlaps the curve station range.
+  bool MarginBound(const Node& node, const ClearanceCurve& curve,
+                   double& bound) const;
+
+  /// \var nodes_
+  ///   The tree nodes. The root node is first.
+  std::vector<Node> nodes_;
+
+  /// \var points_
+  ///   The points, sorted by station.
+  std::vector<ProfilePoint> points_;
+};
+
+#endif  // SPANANALYZER_CLEARANCE_INDEX_H_
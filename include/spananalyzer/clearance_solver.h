@@ -0,0 +1,146 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_CLEARANCE_SOLVER_H_
+#define SPANANALYZER_CLEARANCE_SOLVER_H_
+
+#include <vector>
+
+#include "wx/wx.h"
+
+#include "spananalyzer/clearance_index.h"
+#include "spananalyzer/sag_tension_analysis_result.h"
+#include "spananalyzer/span.h"
+#include "spananalyzer/worker_pool.h"
+
+/// \par OVERVIEW
+///
+/// This class is a worker thread that solves the clearance of a range of
+/// analysis results.
+class ClearanceThread : public WorkerThread {
+ public:
+  /// \brief Constructor.
+  ClearanceThread();
+
+  /// \brief Solves the clearance of the analysis results.
+  virtual void Process();
+
+  /// \brief Sets the clearance index.
+  /// \param[in] index
+  ///   The clearance index, which is shared by all threads.
+  void set_index(const ClearanceIndex* index);
+
+  /// \brief Sets the result index range.
+  /// \param[in] index_begin
+  ///   The first result index.
+  /// \param[in] index_end
+  ///   The result index after the last result.
+  void set_indexes(const int& index_begin, const int& index_end);
+
+  /// \brief Sets the analysis results.
+  /// \param[in] results_analysis
+  ///   The analysis results.
+  void set_results_analysis(
+      const std::vector<SagTensionAnalysisResult>* results_analysis);
+
+  /// \brief Sets the clearance results, which are solved.
+  /// \param[out] results
+  ///   The clearance results, which must be sized to the analysis results.
+  void set_results(std::vector<ClearanceResult>* results);
+
+  /// \brief Sets the span.
+  /// \param[in] span
+  ///   The span.
+  void set_span(const Span* span);
+
+ protected:
+  /// \var index_
+  ///   The clearance index.
+  const ClearanceIndex* index_;
+
+  /// \var index_begin_
+  ///   The first result index.
+  int index_begin_;
+
+  /// \var index_end_
+  ///   The result index after the last result.
+  int index_end_;
+
+  /// \var results_
+  ///   The clearance results.
+  std::vector<ClearanceResult>* results_;
+
+  /// \var results_analysis_
+  ///   The analysis results.
+  const std::vector<SagTensionAnalysisResult>* results_analysis_;
+
+  /// \var span_
+  ///   The span.
+  const Span* span_;
+};
+
+/// \par OVERVIEW
+///
+/// This class solves the clearance from a span to its profile points for a
+/// set of analysis results.
+///
+/// \par INDEX
+///
+/// The profile points are indexed when the span is set, so the index is built
+/// once and shared by every analysis result.
+///
+/// \par THREADS
+///
+/// The analysis results are split into ranges that are solved by worker
+/// threads.
+class ClearanceSolver {
+ public:
+  /// \brief Constructor.
+  ClearanceSolver();
+
+  /// \brief Destructor.
+  ~ClearanceSolver();
+
+  /// \brief Solves the clearance.
+  /// \param[in] results_analysis
+  ///   The analysis results for the span.
+  /// \param[out] results
+  ///   The clearance results, in the same order as the analysis results.
+  /// \return If the clearance was solved.
+  bool Solve(const std::vector<SagTensionAnalysisResult>& results_analysis,
+             std::vector<ClearanceResult>& results) const;
+
+  /// \brief Gets the maximum number of threads.
+  /// \return The maximum number of threads.
+  int max_threads() const;
+
+  /// \brief Sets the maximum number of threads.
+  /// \param[in] max_threads
+  ///   The maximum number of threads. If less than one, the number of
+  ///   available CPUs is used.
+  void set_max_threads(const int& max_threads);
+
+  /// \brief Sets the span and indexes its profile points.
+  /// \param[in] span
+  ///   The span.
+  void set_span(const Span* span);
+
+  /// \brief Gets the span.
+  /// \return The span.
+  const Span* span() const;
+
+ private:
+  /// \var index_
+  ///   The index of the span profile points.
+  ClearanceIndex index_;
+
+  /// \var max_threads_
+  ///   The maximum number of threads.
+  int max_threads_;
+
+  /// \var span_
+  ///   The span.
+  const Span* span_;
+};
+
+#endif  // SPANANALYZER_CLEARANCE_SOLVER_H_
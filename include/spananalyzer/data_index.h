@@ -0,0 +1,66 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_DATA_INDEX_H_
+#define SPANANALYZER_DATA_INDEX_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "models/transmissionline/cable.h"
+#include "models/transmissionline/weather_load_case.h"
+
+#include "spananalyzer/span_analyzer_data.h"
+
+/// \par OVERVIEW
+///
+/// This class indexes the cables and weathercases of the application data by
+/// name, so references can be resolved without scanning the data.
+///
+/// \par NAMES
+///
+/// Cables are keyed by name and weathercases by description, which are the
+/// same keys that documents use to reference the application data. If more
+/// than one item has the same key, the first one in the data is indexed.
+///
+/// \par UPDATES
+///
+/// The index holds addresses into the application data, so it has to be built
+/// again whenever cables or weathercases are added, removed, or renamed.
+class DataIndex {
+ public:
+  /// \brief Constructor.
+  DataIndex();
+
+  /// \brief Builds the index.
+  /// \param[in] data
+  ///   The application data.
+  void Build(const SpanAnalyzerData& data);
+
+  /// \brief Clears the index.
+  void Clear();
+
+  /// \brief Finds a cable.
+  /// \param[in] name
+  ///   The cable name.
+  /// \return The cable. If no cable has the name, a nullptr is returned.
+  const Cable* FindCable(const std::string& name) const;
+
+  /// \brief Finds a weathercase.
+  /// \param[in] description
+  ///   The weathercase description.
+  /// \return The weathercase. If no weathercase has the description, a
+  ///   nullptr is returned.
+  const WeatherLoadCase* FindWeathercase(const std::string& description) const;
+
+ private:
+  /// \var cables_
+  ///   The cables, keyed by name.
+  std::unordered_map<std::string, const Cable*> cables_;
+
+  /// \var weathercases_
+  ///   The weathercases, keyed by description.
+  std::unordered_map<std::string, const WeatherLoadCase*> weathercases_;
+};
+
+#endif  // SPANANALYZER_DATA_INDEX_H_
@@ -0,0 +1,83 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_DISPLAY_UNIT_CONVERTER_H_
+#define SPANANALYZER_DISPLAY_UNIT_CONVERTER_H_
+
+#include "models/base/units.h"
+#include "models/transmissionline/cable_constraint.h"
+
+/// \par OVERVIEW
+///
+/// This class converts values between the model unit system and the display
+/// unit system.
+///
+/// \par MODEL UNIT SYSTEM
+///
+/// The application data and document are kept in a single unit system for the
+/// whole session, which is the unit system that was configured when the
+/// application started. Changing the unit system in the preferences only
+/// changes how values are displayed and edited, so the data is never converted
+/// and the analysis results remain valid.
+///
+/// \par BOUNDARIES
+///
+/// Values are converted to the display unit system when they are shown in a
+/// report or plot, and converted back to the model unit system when they are
+/// accepted from an editor. Only the values that are shown are converted.
+///
+/// All values are expected to be in a 'consistent' unit style.
+class DisplayUnitConverter {
+ public:
+  /// \par OVERVIEW
+  ///
+  /// This enum contains types of quantities.
+  enum class QuantityType {
+    kForce,
+    kLength,
+    kWeightUnit
+  };
+
+  /// \brief Converts a constraint between unit systems.
+  /// \param[in] system_from
+  ///   The unit system to convert from.
+  /// \param[in] system_to
+  ///   The unit system to convert to.
+  /// \param[in,out] constraint
+  ///   The constraint to be converted. Only the limit is converted.
+  static void ConvertUnitSystem(const units::UnitSystem& system_from,
+                                const units::UnitSystem& system_to,
+                                CableConstraint& constraint);
+
+  /// \brief Converts a value between unit systems.
+  /// \param[in] system_from
+  ///   The unit system to convert from.
+  /// \param[in] system_to
+  ///   The unit system to convert to.
+  /// \param[in] type
+  ///   The quantity type.
+  /// \param[in] value
+  ///   The value to be converted.
+  /// \return The converted value.
+  static double ConvertUnitSystem(const units::UnitSystem& system_from,
+                                  const units::UnitSystem& system_to,
+                                  const QuantityType& type,
+                                  const double& value);
+
+  /// \brief Gets the quantity type of a constraint limit.
+  /// \param[in] type_limit
+  ///   The constraint limit type.
+  /// \return The quantity type.
+  static QuantityType QuantityTypeLimit(
+      const CableConstraint::LimitType& type_limit);
+
+  /// \brief Converts a value from the model to the display unit system.
+  /// \param[in] type
+  ///   The quantity type.
+  /// \param[in] value
+  ///   The value, in the model unit system.
+  /// \return The value, in the display unit system.
+  static double ToDisplay(const QuantityType& type, const double& value);
+};
+
+#endif  // SPANANALYZER_DISPLAY_UNIT_CONVERTER_H_
@@ -0,0 +1,202 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_DOCUMENT_JOURNAL_H_
+#define SPANANALYZER_DOCUMENT_JOURNAL_H_
+
+#include <string>
+
+#include "models/base/units.h"
+#include "wx/ffile.h"
+
+#include "spananalyzer/span.h"
+#include "spananalyzer/span_analyzer_data.h"
+
+class SpanAnalyzerDoc;
+
+/// \par OVERVIEW
+///
+/// This class is an append-only journal of the span edits that are made to a
+/// document after it was last saved. The journal is kept in a file next to the
+/// document, and is used to recover edits if the application exits without
+/// saving.
+///
+/// \par RECORDS
+///
+/// Each span insert, modify, delete, and move is appended as a record once it
+/// has been applied to the document, so an autosave only costs as much as the
+/// edit and not the entire document. Undo and redo operations are recorded as
+/// the edits they apply. Records are flushed to the file as they are written.
+///
+/// Insert and modify records contain the span XML node, in the model unit
+/// system and a 'consistent' unit style. Cables and weathercases are referenced
+/// by name, the same as in the document file.
+///
+/// \par SAVING
+///
+/// When the document is saved, the journal is rotated to a separate file,
+/// which is removed once the document file has been written. New edits are
+/// recorded in a new journal. If the save doesn't complete, both journals are
+/// replayed in order when the document is recovered.
+///
+/// \par RECOVERY
+///
+/// Recovery loads the last saved document and replays the journal records onto
+/// it. A partially written record at the end of the journal is ignored.
+class DocumentJournal {
+ public:
+  /// \brief Constructor.
+  DocumentJournal();
+
+  /// \brief Destructor.
+  ~DocumentJournal();
+
+  /// \brief Closes the journal.
+  /// \param[in] is_removed
+  ///   An indicator that tells if the journal files are removed.
+  void Close(const bool& is_removed);
+
+  /// \brief Determines if a journal exists for a document.
+  /// \param[in] filepath_doc
+  ///   The document filepath.
+  /// \return If a journal exists for the document.
+  static bool Exists(const std::string& filepath_doc);
+
+  /// \brief Determines if the journal is open.
+  /// \return If the journal is open.
+  bool IsOpen() const;
+
+  /// \brief Determines if a rotated journal exists for the open document.
+  /// \return If a rotated journal exists, which happens when a save of the
+  ///   document hasn't completed or has failed.
+  bool IsRotated() const;
+
+  /// \brief Opens the journal for a document.
+  /// \param[in] filepath_doc
+  ///   The document filepath.
+  /// \param[in] units
+  ///   The unit system that spans are recorded in.
+  /// \return If the journal was opened.
+  /// Records are appended to any existing journal.
+  bool Open(const std::string& filepath_doc, const units::UnitSystem& units);
+
+  /// \brief Records a span delete.
+  /// \param[in] index
+  ///   The span index.
+  void RecordDelete(const int& index);
+
+  /// \brief Records a span insert.
+  /// \param[in] index
+  ///   The span index.
+  /// \param[in] span
+  ///   The span, in a 'consistent' unit style.
+  void RecordInsert(const int& index, const Span& span);
+
+  /// \brief Records a span modify.
+  /// \param[in] index
+  ///   The span index.
+  /// \param[in] span
+  ///   The span, in a 'consistent' unit style.
+  void RecordModify(const int& index, const Span& span);
+
+  /// \brief Records a span move.
+  /// \param[in] index_from
+  ///   The index of the span that is moved.
+  /// \param[in] index_to
+  ///   The index that the span is moved before.
+  void RecordMove(const int& index_from, const int& index_to);
+
+  /// \brief Removes any journal files for a document.
+  /// \param[in] filepath_doc
+  ///   The document filepath.
+  static void Remove(const std::string& filepath_doc);
+
+  /// \brief Replays the journals for a document.
+  /// \param[in] filepath_doc
+  ///   The document filepath.
+  /// \param[in] units
+  ///   The model unit system. Spans that were recorded in a different unit
+  ///   system are converted.
+  /// \param[in] data
+  ///   The application data, which the span cables and weathercases are
+  ///   matched against.
+  /// \param[in,out] doc
+  ///   The document, which must be loaded from the last saved file.
+  /// \return The number of records that were replayed, or -1 if a record
+  ///   couldn't be applied.
+  /// The document journal must not be open while it is replayed.
+  static int Replay(const std::string& filepath_doc,
+                    const units::UnitSystem& units,
+                    const SpanAnalyzerData& data,
+                    SpanAnalyzerDoc& doc);
+
+  /// \brief Rotates the journal before the document is saved.
+  /// \return The filepath of the rotated journal, which should be removed once
+  ///   the document is saved. If there isn't a journal, an empty string is
+  ///   returned.
+  /// The journal is closed. If a rotated journal already exists from a save
+  /// that didn't complete, the records are appended to it.
+  std::string Rotate();
+
+  /// \brief Gets the document filepath.
+  /// \return The document filepath. If the journal isn't open, an empty
+  ///   string is returned.
+  const std::string& filepath_doc() const;
+
+ private:
+  /// \brief Gets the journal filepath for a document.
+  /// \param[in] filepath_doc
+  ///   The document filepath.
+  /// \return The journal filepath.
+  static std::string FilepathJournal(const std::string& filepath_doc);
+
+  /// \brief Gets the rotated journal filepath for a document.
+  /// \param[in] filepath_doc
+  ///   The document filepath.
+  /// \return The rotated journal filepath.
+  static std::string FilepathRotated(const std::string& filepath_doc);
+
+  /// \brief Replays a journal file.
+  /// \param[in] filepath
+  ///   The journal filepath.
+  /// \param[in] units
+  ///   The model unit system.
+  /// \param[in] data
+  ///   The application data.
+  /// \param[in,out] doc
+  ///   The document.
+  /// \return The number of records that were replayed, or -1 if a record
+  ///   couldn't be applied.
+  static int ReplayFile(const std::string& filepath,
+                        const units::UnitSystem& units,
+                        const SpanAnalyzerData& data,
+                        SpanAnalyzerDoc& doc);
+
+  /// \brief Appends a record to the journal file.
+  /// \param[in] record
+  ///   The record.
+  void Write(const std::string& record);
+
+  /// \brief Appends a span record to the journal file.
+  /// \param[in] type
+  ///   The record type.
+  /// \param[in] index
+  ///   The span index.
+  /// \param[in] span
+  ///   The span.
+  void WriteSpan(const char& type, const int& index, const Span& span);
+
+  /// \var file_
+  ///   The journal file.
+  wxFFile file_;
+
+  /// \var filepath_doc_
+  ///   The document filepath.
+  std::string filepath_doc_;
+
+  /// \var units_
+  ///   The unit system that spans are recorded in.
+  units::UnitSystem units_;
+};
+
+#endif  // SPANANALYZER_DOCUMENT_JOURNAL_H_
@@ -8,39 +8,13 @@
 #include <string>
 
 #include "wx/docview.h"
-#include "wx/treectrl.h"
 #include "wx/wx.h"
 
 #include "spananalyzer/span.h"
+#include "spananalyzer/span_list_ctrl.h"
 
 class UpdateHint;
 
-/// \par OVERVIEW
-///
-/// This class contains the data associated with each item in the SpanTreeCtrl.
-/// The data contains a std container iterator that points to where the span is
-/// actually stored in the SpanAnalyzerDoc.
-class SpanTreeItemData : public wxTreeItemData {
- public:
-  /// \brief Sets the std container iterator for the item.
-  /// \param[in] iter
-  ///   The iterator.
-  void set_iter(std::list<Span>::const_iterator iter) {
-    iter_ = iter;
-  }
-
-  /// \brief Gets the iterator.
-  /// \return The iterator.
-  const std::list<Span>::const_iterator iter() {
-    return iter_;
-  }
-
- private:
-  /// \var iter_
-  ///   The std container iterator that points to where the span is stored.
-  std::list<Span>::const_iterator iter_;
-};
-
 /// \par OVERVIEW
 ///
 /// This class is an wxAUI pane that allows the user to edit the document.
@@ -49,6 +23,13 @@ class SpanTreeItemData : public wxTreeItemData {
 ///
 /// The span that is activated in this window is the focus of the other view
 /// panes.
+///
+/// \par SPAN LIST
+///
+/// The spans are displayed in a virtual list, which only draws the visible
+/// rows. Rows are identified by the span index. Span edits update the list
+/// row index incrementally using the update hint, so documents with many
+/// spans can be opened and edited without rebuilding the list.
 class EditPane : public wxPanel {
  public:
   /// \brief Constructor.
@@ -68,63 +49,57 @@ class EditPane : public wxPanel {
   void Update(wxObject* hint = nullptr);
 
  private:
-  /// \brief Activates a span in the treectrl.
-  /// \param[in] id
-  ///   The item ID of the selected span.
-  void ActivateSpan(const wxTreeItemId& id);
+  /// \brief Activates a span.
+  /// \param[in] index
+  ///   The index of the selected span.
+  void ActivateSpan(const int& index);
 
   /// \brief Adds a span.
   /// The span will be added to the end.
   void AddSpan();
 
   /// \brief Copies the selected span.
-  /// \param[in] id
-  ///   The item ID of the selected span.
+  /// \param[in] index
+  ///   The index of the selected span.
   /// The copied span is inserted below the selected span.
-  void CopySpan(const wxTreeItemId& id);
+  void CopySpan(const int& index);
 
-  /// \brief Deactivates the span in the treectrl.
-  /// \param[in] id
-  ///   The item ID of the selected span.
-  void DeactivateSpan(const wxTreeItemId& id);
+  /// \brief Deactivates the span.
+  /// \param[in] index
+  ///   The index of the selected span.
+  void DeactivateSpan(const int& index);
 
   /// \brief Deletes the selected span.
-  /// \param[in] id
-  ///   The item ID of the selected span.
-  void DeleteSpan(const wxTreeItemId& id);
+  /// \param[in] index
+  ///   The index of the selected span.
+  void DeleteSpan(const int& index);
 
-  /// \brief Edits the selected span.
-  /// \param[in] id
-  ///   The item ID of the selected span.
-  void EditSpan(const wxTreeItemId& id);
+  /// \brief Deletes all of the spans.
+  /// The spans are deleted with a single command, so they can be restored
+  /// with a single undo.
+  void DeleteSpansAll();
 
-  /// \brief Sets the application focus on a treectrl span item.
+  /// \brief Edits the selected span.
   /// \param[in] index
-  ///   The index of the treectrl span item.
-  /// This function will set the treectrl focus to the index and move the
-  /// application focus to the treectrl.
-  void FocusTreeCtrlSpanItem(const int& index);
-
-  /// \brief Initializes the treectrl.
-  /// This function deletes all tree items and re-populates with spans
-  /// in the document.
-  void InitializeTreeCtrl();
+  ///   The index of the selected span.
+  void EditSpan(const int& index);
 
-  /// \brief Inserts a treectrl item.
+  /// \brief Sets the application focus on a span row.
   /// \param[in] index
   ///   The span index.
-  /// \return The treectrl item.
-  wxTreeItemId InsertTreeCtrlItem(const int& index);
+  /// This function will select the row, scroll it into view, and move the
+  /// application focus to the list.
+  void FocusSpanRow(const int& index);
 
   /// \brief Moves the selected span down.
-  /// \param[in] id
-  ///   The item ID of the selected span.
-  void MoveSpanDown(const wxTreeItemId& id);
+  /// \param[in] index
+  ///   The index of the selected span.
+  void MoveSpanDown(const int& index);
 
   /// \brief Moves the selected span up.
-  /// \param[in] id
-  ///   The item ID of the selected span.
-  void MoveSpanUp(const wxTreeItemId& id);
+  /// \param[in] index
+  ///   The index of the selected span.
+  void MoveSpanUp(const int& index);
 
   /// \brief Gets a name with versioning.
   /// \param[in] name
@@ -162,6 +137,12 @@ class EditPane : public wxPanel {
   ///   The event.
   void OnButtonMoveUp(wxCommandEvent& event);
 
+  /// \brief Handles the event for a user right click, and will generate a
+  ///   context menu of options.
+  /// \param[in] event
+  ///   The event generated by the list.
+  void OnContextMenu(wxContextMenuEvent& event);
+
   /// \brief Handles a context menu selection event.
   /// \param[in] event
   ///   The event generated by the context menu. This is used to identify which
@@ -170,32 +151,25 @@ class EditPane : public wxPanel {
 
   /// \brief Handles a double click event, which will activate a span.
   /// \param[in] event
-  ///   The event generated by the treectrl.
-  void OnItemActivate(wxTreeEvent& event);
+  ///   The event generated by the list.
+  void OnItemActivate(wxListEvent& event);
 
-  /// \brief Handles the event for a user right click, and will generate a
-  ///   context menu of options.
-  /// \param[in] event
-  ///   The event generated by the treectrl.
-  void OnItemMenu(wxTreeEvent& event);
+  /// \brief Runs a reliability analysis of the selected span.
+  /// \param[in] index
+  ///   The index of the selected span, which must be the activated span.
+  void RunReliabilityAnalysis(const int& index);
 
-  /// \brief Updates the treectrl bolded item.
-  void UpdateTreeCtrlBoldItem();
+  /// \brief Updates the bold row to match the activated span.
+  void UpdateBoldRow();
 
-  /// \brief Updates the treectrl.
+  /// \brief Updates the span rows.
   /// \param[in] hint
   ///   The update hint. This is only needed for partial updates.
-  void UpdateTreeCtrlSpanItems(const UpdateHint* hint);
-
-  /// \var index_bold_
-  ///   The index for the bolded treectrl item. This is used for updating the
-  ///   treectrl after the document is modified, so it may be out of sync with
-  ///   the activated span index.
-  int index_bold_;
+  void UpdateSpanRows(const UpdateHint* hint);
 
-  /// \var treectrl_
-  ///  The treectrl that shows the document.
-  wxTreeCtrl* treectrl_;
+  /// \var listctrl_
+  ///   The list that shows the document spans.
+  SpanListCtrl* listctrl_;
 
   /// \var view_
   ///   The view.
@@ -7,21 +7,28 @@
 #include <list>
 #include <string>
 
+#include "spananalyzer/span.h"
 #include "spananalyzer/span_analyzer_config.h"
 #include "spananalyzer/span_analyzer_data.h"
 
 /// \par OVERVIEW
 ///
 /// This class handles reading and writing application files that are not
-/// document related.
+/// document related. It also writes document files for saves that run on a
+/// worker thread.
+///
+/// \par STREAMING
+///
+/// Application data and document files are streamed to the file as the XML is
+/// generated, so save time and memory scale linearly with the file contents.
 ///
 /// \par UNIT CONVERSION
 ///
 /// The functions in this class convert the file unit system and style to match
 /// the needs of the application. If the file unit system is different than the
-/// application unit system, these functions will convert to application unit
-/// system. The files will always contain information in user-friendly
-/// units, but the data is converted to consistent unit style.
+/// model unit system, these functions will convert to the model unit system.
+/// The files will always contain information in user-friendly units, but the
+/// data is converted to consistent unit style.
 class FileHandler {
  public:
   /// \brief Loads the application data file.
@@ -93,6 +100,60 @@ class FileHandler {
   ///   The application configuration settings.
   static void SaveConfigFile(const std::string& filepath,
                              const SpanAnalyzerConfig& config);
+
+  /// \brief Writes the application data file.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \param[in] data
+  ///   The application data, in a 'consistent' unit style. The data is not
+  ///   modified.
+  /// \param[in] units
+  ///   The unit system of the data, which will be labeled in the file.
+  /// \return If the file was written.
+  /// This function doesn't update the status bar, so it can be called from a
+  /// worker thread as long as the data isn't modified while it is written.
+  static bool WriteAppData(const std::string& filepath,
+                           const SpanAnalyzerData& data,
+                           const units::UnitSystem& units);
+
+  /// \brief Writes a document file.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \param[in] spans
+  ///   The document spans, in a 'consistent' unit style. The spans are not
+  ///   modified.
+  /// \param[in] units
+  ///   The unit system of the spans, which will be labeled in the file.
+  /// \return If the file was written.
+  /// This function doesn't update the status bar, so it can be called from a
+  /// worker thread as long as the spans aren't modified while they are
+  /// written.
+  static bool WriteDocument(const std::string& filepath,
+                            const std::list<Span>& spans,
+                            const units::UnitSystem& units);
+
+ private:
+  /// \brief Replaces a file with a temporary file.
+  /// \param[in] filepath_temp
+  ///   The temporary filepath.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \param[in] status
+  ///   The status of the temporary file write. If false, the temporary file is
+  ///   removed and the file isn't replaced.
+  /// \return If the file was replaced.
+  static bool ReplaceFile(const std::string& filepath_temp,
+                          const std::string& filepath,
+                          const bool& status);
+
+  /// \brief Gets a temporary filepath for a file.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \return The temporary filepath that the xml is streamed to. Any
+  ///   directories that are needed are created.
+  /// Files are streamed to a temporary file, which then replaces the file, so
+  /// an interrupted save doesn't corrupt the existing file.
+  static std::string TempFilepath(const std::string& filepath);
 };
 
 #endif  // SPANANALYZER_FILE_HANDLER_H_
@@ -0,0 +1,294 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_FILE_SAVE_CONTROLLER_H_
+#define SPANANALYZER_FILE_SAVE_CONTROLLER_H_
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "models/base/units.h"
+#include "wx/event.h"
+#include "wx/thread.h"
+
+#include "spananalyzer/span.h"
+#include "spananalyzer/span_analyzer_data.h"
+
+/// \par OVERVIEW
+///
+/// This class is an immutable snapshot of data that is saved to a file.
+///
+/// \par REFERENCES
+///
+/// The snapshot copies the application data or document spans, along with
+/// every cable and weathercase that they reference. The references in the
+/// copies are redirected to the snapshot copies, so the snapshot doesn't share
+/// any memory with the live data and can be written on a worker thread while
+/// the live data keeps changing.
+///
+/// \par UNITS
+///
+/// The copies are kept in a 'consistent' unit style. The XML handlers convert
+/// values to the 'different' unit style as they are written.
+class FileSaveSnapshot {
+ public:
+  /// \par OVERVIEW
+  ///
+  /// This enum contains types of snapshots.
+  enum class Type {
+    kNull,
+    kAppData,
+    kDocument
+  };
+
+  /// \brief Constructor.
+  FileSaveSnapshot();
+
+  /// \brief Destructor.
+  ~FileSaveSnapshot();
+
+  /// \brief Captures the application data.
+  /// \param[in] data
+  ///   The application data.
+  void CaptureData(const SpanAnalyzerData& data);
+
+  /// \brief Captures the document spans.
+  /// \param[in] spans
+  ///   The document spans.
+  /// The span connections are not captured.
+  void CaptureSpans(const std::list<Span>& spans);
+
+  /// \brief Gets the captured application data.
+  /// \return The captured application data.
+  const SpanAnalyzerData& data() const;
+
+  /// \brief Gets the captured spans.
+  /// \return The captured spans.
+  const std::list<Span>& spans() const;
+
+  /// \brief Gets the snapshot type.
+  /// \return The snapshot type.
+  Type type() const;
+
+ private:
+  /// \brief Copies a cable into the snapshot.
+  /// \param[in] cable
+  ///   The live cable.
+  /// \return The snapshot copy. Each cable is only copied once.
+  Cable* CopyCable(const Cable* cable);
+
+  /// \brief Copies a weathercase into the snapshot.
+  /// \param[in] weathercase
+  ///   The live weathercase.
+  /// \return The snapshot copy. Each weathercase is only copied once.
+  WeatherLoadCase* CopyWeathercase(const WeatherLoadCase* weathercase);
+
+  /// \var cablefiles_
+  ///   The cable file copies.
+  std::list<CableFile> cablefiles_;
+
+  /// \var cables_
+  ///   The cable copies that are referenced by the spans.
+  std::list<Cable> cables_;
+
+  /// \var data_
+  ///   The application data copy. The pointers reference the snapshot copies,
+  ///   and are not owned by this object.
+  SpanAnalyzerData data_;
+
+  /// \var map_cables_
+  ///   A map of live cables to snapshot copies.
+  std::unordered_map<const Cable*, Cable*> map_cables_;
+
+  /// \var map_weathercases_
+  ///   A map of live weathercases to snapshot copies.
+  std::unordered_map<const WeatherLoadCase*, WeatherLoadCase*>
+      map_weathercases_;
+
+  /// \var spans_
+  ///   The span copies.
+  std::list<Span> spans_;
+
+  /// \var type_
+  ///   The snapshot type.
+  Type type_;
+
+  /// \var weathercases_
+  ///   The weathercase copies.
+  std::list<WeatherLoadCase> weathercases_;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a worker thread that writes a snapshot to a file.
+///
+/// \par ERRORS
+///
+/// Errors are logged from the worker thread. wxWidgets buffers log messages
+/// from worker threads and flushes them on the main thread.
+///
+/// \par NOTIFICATION
+///
+/// If a handler is provided, a wxEVT_THREAD event is queued to it when the
+/// snapshot is written. The event int is the save status and the event string
+/// is the filepath, so the handler can react to a failed save on the main
+/// thread.
+class FileSaveThread : public wxThread {
+ public:
+  /// \brief Constructor.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \param[in] units
+  ///   The unit system of the snapshot.
+  /// \param[in] snapshot
+  ///   The snapshot, which the thread takes ownership of.
+  /// \param[in] filepath_journal
+  ///   A journal file that is removed once the snapshot is written. If empty,
+  ///   no file is removed.
+  /// \param[in] handler
+  ///   The handler that is notified when the save completes. If a nullptr,
+  ///   no notification is sent.
+  FileSaveThread(const std::string& filepath,
+                 const units::UnitSystem& units,
+                 FileSaveSnapshot* snapshot,
+                 const std::string& filepath_journal,
+                 wxEvtHandler* handler);
+
+  /// \brief Gets the file path.
+  /// \return The file path.
+  const std::string& filepath() const;
+
+  /// \brief Gets the save status.
+  /// \return If the file was written. This is only valid after the thread
+  ///   completes.
+  bool status() const;
+
+ protected:
+  /// \brief Writes the snapshot.
+  /// \return The exit code of the thread.
+  virtual ExitCode Entry();
+
+ private:
+  /// \var filepath_
+  ///   The filepath.
+  std::string filepath_;
+
+  /// \var filepath_journal_
+  ///   The journal file that is removed once the snapshot is written.
+  std::string filepath_journal_;
+
+  /// \var handler_
+  ///   The handler that is notified when the save completes. This is not
+  ///   owned by the thread.
+  wxEvtHandler* handler_;
+
+  /// \var snapshot_
+  ///   The snapshot.
+  std::unique_ptr<FileSaveSnapshot> snapshot_;
+
+  /// \var status_
+  ///   The save status.
+  bool status_;
+
+  /// \var units_
+  ///   The unit system of the snapshot.
+  units::UnitSystem units_;
+};
+
+/// \par OVERVIEW
+///
+/// This class saves application data and documents on a worker thread, so the
+/// user can keep working while large files are written.
+///
+/// \par SNAPSHOTS
+///
+/// The data is captured into an immutable snapshot on the calling thread, and
+/// the snapshot is written on the worker thread. The live data is never
+/// modified by a save.
+///
+/// \par ORDERING
+///
+/// Only one save runs at a time. Starting a save waits for any save that is
+/// still running, so saves to the same file are always written in order.
+class FileSaveController {
+ public:
+  /// \brief Constructor.
+  FileSaveController();
+
+  /// \brief Destructor.
+  /// Any running save is completed before the controller is destroyed.
+  ~FileSaveController();
+
+  /// \brief Determines if a save is running.
+  /// \return If a save is running.
+  bool IsSaving() const;
+
+  /// \brief Saves the application data on a worker thread.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \param[in] data
+  ///   The application data, in a 'consistent' unit style.
+  /// \param[in] units
+  ///   The unit system of the data.
+  /// \return If the save was started.
+  bool SaveAppData(const std::string& filepath,
+                   const SpanAnalyzerData& data,
+                   const units::UnitSystem& units);
+
+  /// \brief Saves a document on a worker thread.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \param[in] spans
+  ///   The document spans, in a 'consistent' unit style.
+  /// \param[in] units
+  ///   The unit system of the spans.
+  /// \param[in] filepath_journal
+  ///   A journal file that is removed once the document is written. If empty,
+  ///   no file is removed.
+  /// \param[in] handler
+  ///   The handler that is notified with the save status when the document
+  ///   is written. If a nullptr, no notification is sent.
+  /// \return If the save was started.
+  bool SaveDocument(const std::string& filepath,
+                    const std::list<Span>& spans,
+                    const units::UnitSystem& units,
+                    const std::string& filepath_journal,
+                    wxEvtHandler* handler);
+
+  /// \brief Waits for any running save to complete.
+  /// \return The status of the last save. If no save has been started, true
+  ///   is returned.
+  bool Wait();
+
+ private:
+  /// \brief Starts a worker thread to write a snapshot.
+  /// \param[in] filepath
+  ///   The filepath.
+  /// \param[in] units
+  ///   The unit system of the snapshot.
+  /// \param[in] snapshot
+  ///   The snapshot, which the thread takes ownership of.
+  /// \param[in] filepath_journal
+  ///   A journal file that is removed once the snapshot is written.
+  /// \param[in] handler
+  ///   The handler that is notified when the save completes.
+  /// \return If the thread was started.
+  bool Start(const std::string& filepath,
+             const units::UnitSystem& units,
+             FileSaveSnapshot* snapshot,
+             const std::string& filepath_journal,
+             wxEvtHandler* handler);
+
+  /// \var status_
+  ///   The status of the last completed save.
+  bool status_;
+
+  /// \var thread_
+  ///   The worker thread of the running save, or a nullptr if no save is
+  ///   running.
+  FileSaveThread* thread_;
+};
+
+#endif  // SPANANALYZER_FILE_SAVE_CONTROLLER_H_
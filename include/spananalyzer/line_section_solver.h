@@ -0,0 +1,331 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_LINE_SECTION_SOLVER_H_
+#define SPANANALYZER_LINE_SECTION_SOLVER_H_
+
+#include <memory>
+#include <vector>
+
+#include "models/sagtension/cable_elongation_model.h"
+#include "models/transmissionline/hardware.h"
+#include "wx/wx.h"
+
+#include "spananalyzer/cable_model_cache.h"
+#include "spananalyzer/sag_tension_analysis_result.h"
+#include "spananalyzer/span.h"
+#include "spananalyzer/worker_pool.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the loaded state that is shared by all of the spans in
+/// a line section.
+struct LineSectionState {
+  /// \var state
+  ///   The cable state.
+  CableState state;
+
+  /// \var state_stretch
+  ///   The cable stretch state.
+  CableStretchState state_stretch;
+
+  /// \var weight_unit
+  ///   The unit weight of the cable.
+  Vector3d weight_unit;
+};
+
+/// \par OVERVIEW
+///
+/// This struct contains the solution of a line section for a single
+/// weathercase and condition.
+struct LineSectionResult {
+  /// \var is_converged
+  ///   An indicator that tells if the insulator equilibrium converged.
+  bool is_converged;
+
+  /// \var iterations
+  ///   The number of equilibrium iterations.
+  int iterations;
+
+  /// \var swings
+  ///   The longitudinal displacement of each suspension insulator, in line
+  ///   order. Positive displacements are ahead on the line.
+  std::vector<double> swings;
+
+  /// \var tensions_horizontal
+  ///   The horizontal tension of each span, in line order.
+  std::vector<double> tensions_horizontal;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a worker thread that solves the horizontal tension of a range
+/// of spans in a line section.
+///
+/// \par SPAN SOLVES
+///
+/// Each span has a fixed reference length. The horizontal tension is solved so
+/// the catenary length matches the reference length, elongated by the strain
+/// of the cable elongation model at the catenary average tension. The compiled
+/// cable model is shared read-only by all of the threads.
+///
+/// \par STIFFNESS
+///
+/// The span stiffness (the change in horizontal tension per change in span
+/// spacing) is solved by a finite difference, so the line section solver can
+/// build the equilibrium jacobian.
+class LineSectionThread : public WorkerThread {
+ public:
+  /// \brief Constructor.
+  LineSectionThread();
+
+  /// \brief Solves the horizontal tension and stiffness of the spans.
+  /// If a span tension can't be solved, the span keeps its previous tension
+  /// and stiffness, and the thread is flagged as not solved.
+  virtual void Process();
+
+  /// \brief Gets if all of the span tensions were solved.
+  /// \return If all of the span tensions were solved in the last pass.
+  bool is_solved() const;
+
+  /// \brief Sets the span index range.
+  /// \param[in] index_begin
+  ///   The first span index.
+  /// \param[in] index_end
+  ///   The span index after the last span.
+  void set_indexes(const int& index_begin, const int& index_end);
+
+  /// \brief Sets the span reference lengths.
+  /// \param[in] lengths_reference
+  ///   The span reference lengths.
+  void set_lengths_reference(const std::vector<double>* lengths_reference);
+
+  /// \brief Sets the compiled cable model.
+  /// \param[in] model
+  ///   The compiled cable model, which must match the loaded state.
+  void set_model(const CompiledCableModel* model);
+
+  /// \brief Sets the span spacings.
+  /// \param[in] spacings
+  ///   The span spacings.
+  void set_spacings(const std::vector<Vector3d>* spacings);
+
+  /// \brief Sets the loaded state.
+  /// \param[in] state
+  ///   The loaded state.
+  void set_state(const LineSectionState* state);
+
+  /// \brief Sets the span stiffnesses, which are solved.
+  /// \param[out] stiffnesses
+  ///   The span stiffnesses.
+  void set_stiffnesses(std::vector<double>* stiffnesses);
+
+  /// \brief Sets the span horizontal tensions. These are used as the initial
+  ///   guess, and are replaced by the solved tensions.
+  /// \param[in,out] tensions
+  ///   The span horizontal tensions.
+  void set_tensions(std::vector<double>* tensions);
+
+ protected:
+  /// \brief Gets the length residual of a span.
+  /// \param[in] spacing
+  ///   The span spacing.
+  /// \param[in] length_reference
+  ///   The span reference length.
+  /// \param[in] tension_horizontal
+  ///   The horizontal tension.
+  /// \return The catenary length minus the elongated reference length. This
+  ///   decreases as the horizontal tension increases.
+  double LengthResidual(const Vector3d& spacing,
+                        const double& length_reference,
+                        const double& tension_horizontal);
+
+  /// \brief Solves the horizontal tension of a span.
+  /// \param[in] spacing
+  ///   The span spacing.
+  /// \param[in] length_reference
+  ///   The span reference length.
+  /// \param[in] tension_guess
+  ///   The initial horizontal tension guess.
+  /// \param[out] tension
+  ///   The horizontal tension.
+  /// \return If the tension was solved. If the solution can't be bracketed,
+  ///   the tension isn't solved.
+  bool SolveTension(const Vector3d& spacing,
+                    const double& length_reference,
+                    const double& tension_guess,
+                    double& tension);
+
+  /// \var index_begin_
+  ///   The first span index.
+  int index_begin_;
+
+  /// \var index_end_
+  ///   The span index after the last span.
+  int index_end_;
+
+  /// \var is_solved_
+  ///   An indicator that tells if all of the span tensions were solved.
+  bool is_solved_;
+
+  /// \var lengths_reference_
+  ///   The span reference lengths.
+  const std::vector<double>* lengths_reference_;
+
+  /// \var model_
+  ///   The compiled cable model.
+  const CompiledCableModel* model_;
+
+  /// \var spacings_
+  ///   The span spacings.
+  const std::vector<Vector3d>* spacings_;
+
+  /// \var state_
+  ///   The loaded state.
+  const LineSectionState* state_;
+
+  /// \var stiffnesses_
+  ///   The span stiffnesses.
+  std::vector<double>* stiffnesses_;
+
+  /// \var tensions_
+  ///   The span horizontal tensions.
+  std::vector<double>* tensions_;
+};
+
+/// \par OVERVIEW
+///
+/// This class solves a line section, which is a series of spans that are
+/// connected by suspension structures.
+///
+/// \par REFERENCE LENGTHS
+///
+/// The spans are assumed to be clipped in with plumb insulators and equal
+/// horizontal tension at the line cable constraint, which is how a ruling span
+/// is sagged. The reference length of each span is solved at the constraint
+/// when the solver is initialized.
+///
+/// \par EQUILIBRIUM
+///
+/// For other weathercases, the spans no longer have equal horizontal tension.
+/// The suspension insulators swing longitudinally towards the span with the
+/// higher tension until the tension difference is balanced by the vertical
+/// load on the insulator, which changes the span spacings. The insulator
+/// displacements are solved with a Newton iteration. The jacobian is
+/// tridiagonal, as each insulator only affects the adjacent spans.
+///
+/// \par THREADS
+///
+/// The spans are split into ranges that are solved by worker threads. The
+/// threads are started once for each solve and reused by every iteration. The
+/// dead-end structures at the ends of the line section don't move.
+class LineSectionSolver {
+ public:
+  /// \brief Constructor.
+  LineSectionSolver();
+
+  /// \brief Destructor.
+  ~LineSectionSolver();
+
+  /// \brief Initializes the span reference lengths.
+  /// \return If the reference lengths were solved.
+  /// This must be done after the spans are set, and before solving.
+  bool Initialize();
+
+  /// \brief Solves the line section.
+  /// \param[in] result_rulingspan
+  ///   The ruling span result for the weathercase and condition, which must be
+  ///   valid.
+  /// \param[in] state_stretch
+  ///   The stretch state for the condition.
+  /// \param[out] result
+  ///   The line section result.
+  /// \return If the line section was solved. If the insulator equilibrium
+  ///   doesn't converge, the last iteration is still returned. If a span
+  ///   tension can't be solved, the line section isn't solved.
+  bool Solve(const SagTensionAnalysisResult& result_rulingspan,
+             const CableStretchState& state_stretch,
+             LineSectionResult& result) const;
+
+  /// \brief Gets the suspension insulator.
+  /// \return The suspension insulator.
+  const Hardware* insulator() const;
+
+  /// \brief Gets the line cable.
+  /// \return The line cable.
+  const LineCable* line_cable() const;
+
+  /// \brief Gets the maximum number of threads.
+  /// \return The maximum number of threads.
+  int max_threads() const;
+
+  /// \brief Sets the compiled cable model cache.
+  /// \param[in] cache_models
+  ///   The compiled cable model cache. If this is a nullptr, the models are
+  ///   compiled for each solve.
+  void set_cache_models(CableModelCache* cache_models);
+
+  /// \brief Sets the suspension insulator.
+  /// \param[in] insulator
+  ///   The suspension insulator, which is used at every suspension structure.
+  void set_insulator(const Hardware* insulator);
+
+  /// \brief Sets the line cable.
+  /// \param[in] line_cable
+  ///   The line cable that is shared by all of the spans. This must be
+  ///   connected to line structures so it can be reloaded.
+  void set_line_cable(const LineCable* line_cable);
+
+  /// \brief Sets the maximum number of threads.
+  /// \param[in] max_threads
+  ///   The maximum number of threads. If less than one, the number of
+  ///   available CPUs is used.
+  void set_max_threads(const int& max_threads);
+
+  /// \brief Sets the spans.
+  /// \param[in] spans
+  ///   The spans, in line order. Only the span spacings are used, as all of
+  ///   the spans share the line cable.
+  void set_spans(const std::vector<const Span*>& spans);
+
+  /// \brief Gets the spans.
+  /// \return The spans.
+  const std::vector<const Span*>& spans() const;
+
+ private:
+  /// \brief Gets the compiled cable model for a state.
+  /// \param[in] state
+  ///   The cable state.
+  /// \param[in] state_stretch
+  ///   The cable stretch state.
+  /// \return The compiled cable model. If the model isn't valid, a nullptr is
+  ///   returned.
+  std::shared_ptr<const CompiledCableModel> Model(
+      const CableState& state, const CableStretchState& state_stretch) const;
+
+  /// \var cache_models_
+  ///   The compiled cable model cache.
+  CableModelCache* cache_models_;
+
+  /// \var insulator_
+  ///   The suspension insulator.
+  const Hardware* insulator_;
+
+  /// \var lengths_reference_
+  ///   The span reference lengths.
+  std::vector<double> lengths_reference_;
+
+  /// \var line_cable_
+  ///   The line cable that is shared by all of the spans.
+  const LineCable* line_cable_;
+
+  /// \var max_threads_
+  ///   The maximum number of threads.
+  int max_threads_;
+
+  /// \var spans_
+  ///   The spans, in line order.
+  std::vector<const Span*> spans_;
+};
+
+#endif  // SPANANALYZER_LINE_SECTION_SOLVER_H_
@@ -0,0 +1,274 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_POLYNOMIAL_EVALUATOR_H_
+#define SPANANALYZER_POLYNOMIAL_EVALUATOR_H_
+
+#include <cmath>
+#include <vector>
+
+#include "models/transmissionline/cable.h"
+
+/// \brief Multiplies and adds, with a fused multiply-add if the processor has
+///   one.
+/// \param[in] a
+///   The first factor.
+/// \param[in] b
+///   The second factor.
+/// \param[in] c
+///   The value to add.
+/// \return The value of a * b + c.
+/// The standard fma function is emulated in software when the target doesn't
+/// have a fused multiply-add instruction, which is much slower than a separate
+/// multiply and add.
+inline double MultiplyAdd(const double& a, const double& b, const double& c) {
+#ifdef FP_FAST_FMA
+  return std::fma(a, b, c);
+#else
+  return a * b + c;
+#endif
+}
+
+/// \par OVERVIEW
+///
+/// This struct evaluates a polynomial of a fixed degree with Horner's method.
+/// The degree is a template parameter, so the loop is unrolled by the compiler
+/// and each step is a multiply-add.
+template<int Degree>
+struct PolynomialHorner {
+  /// \brief Evaluates the polynomial.
+  /// \param[in] c
+  ///   The coefficients, in increasing order of power.
+  /// \param[in] x
+  ///   The value to evaluate at.
+  /// \return The polynomial value.
+  static double Value(const double* c, const double& x) {
+    return MultiplyAdd(PolynomialHorner<Degree - 1>::Value(c + 1, x), x, c[0]);
+  }
+};
+
+/// \par OVERVIEW
+///
+/// This struct ends the Horner recursion with the constant coefficient.
+template<>
+struct PolynomialHorner<0> {
+  /// \brief Evaluates the polynomial.
+  /// \param[in] c
+  ///   The coefficients.
+  /// \param[in] x
+  ///   The value to evaluate at, which isn't used.
+  /// \return The constant coefficient.
+  static double Value(const double* c, const double& x) {
+    return c[0];
+  }
+};
+
+/// \par OVERVIEW
+///
+/// This struct evaluates a 4th order polynomial with Estrin's scheme. The
+/// pairs of coefficients are evaluated independently, which shortens the
+/// dependency chain compared to Horner's method:
+///   (c0 + c1 x) + x^2 ((c2 + c3 x) + c4 x^2)
+struct PolynomialEstrin4 {
+  /// \brief Evaluates the polynomial.
+  /// \param[in] c
+  ///   The coefficients, in increasing order of power.
+  /// \param[in] x
+  ///   The value to evaluate at.
+  /// \return The polynomial value.
+  static double Value(const double* c, const double& x) {
+    const double x2 = x * x;
+    const double p01 = MultiplyAdd(c[1], x, c[0]);
+    const double p23 = MultiplyAdd(c[3], x, c[2]);
+    const double p234 = MultiplyAdd(c[4], x2, p23);
+    return MultiplyAdd(p234, x2, p01);
+  }
+};
+
+/// \par OVERVIEW
+///
+/// This class evaluates a polynomial with an evaluator that is selected once
+/// for the polynomial degree.
+///
+/// \par USAGE
+///
+/// This is only used by the benchmark, which compares the selected evaluator
+/// with the generic Horner loop. The sag-tension solvers evaluate the cable
+/// polynomials inside the cable elongation model of the Models library, which
+/// can't be given an evaluator, so no analysis uses this class.
+///
+/// \par SELECTION
+///
+/// Trailing zero coefficients are trimmed to find the degree. 4th order
+/// polynomials, which are what the cable files contain, are evaluated with
+/// Estrin's scheme. Other degrees up to kDegreeMax are evaluated with an
+/// unrolled Horner's method. Higher degrees use a generic Horner loop.
+///
+/// \par DISPATCH
+///
+/// The evaluators are selected with a switch on the degree, which is defined
+/// in this header so the selected evaluator can be inlined into the caller.
+/// The degree doesn't change after compiling, so the branch is predicted.
+///
+/// \par DERIVATIVE
+///
+/// The derivative polynomial is compiled along with the polynomial, so slopes
+/// can be evaluated the same way for Newton iterations.
+class PolynomialEvaluator {
+ public:
+  /// \brief These are the evaluation forms.
+  enum class FormType {
+    kEstrin,
+    kGeneric,
+    kHorner,
+  };
+
+  /// \var kDegreeMax
+  ///   The highest degree that has a specialized evaluator.
+  static const int kDegreeMax = 8;
+
+  /// \brief Constructor.
+  PolynomialEvaluator();
+
+  /// \brief Destructor.
+  ~PolynomialEvaluator();
+
+  /// \brief Compiles the polynomial.
+  /// \param[in] coefficients
+  ///   The coefficients, in increasing order of power.
+  void Compile(const std::vector<double>& coefficients);
+
+  /// \brief Evaluates the polynomial slope.
+  /// \param[in] x
+  ///   The value to evaluate at.
+  /// \return The slope.
+  double Slope(const double& x) const;
+
+  /// \brief Evaluates the polynomial.
+  /// \param[in] x
+  ///   The value to evaluate at.
+  /// \return The polynomial value.
+  double Value(const double& x) const;
+
+  /// \brief Evaluates the polynomial with the generic Horner loop.
+  /// \param[in] x
+  ///   The value to evaluate at.
+  /// \return The polynomial value.
+  /// This is the fallback for high degrees, and is the reference that the
+  /// specialized evaluators are benchmarked against.
+  double ValueGeneric(const double& x) const;
+
+  /// \brief Gets the degree.
+  /// \return The degree, after trailing zero coefficients are trimmed.
+  int degree() const;
+
+  /// \brief Gets the evaluation form.
+  /// \return The evaluation form.
+  FormType form() const;
+
+ private:
+  /// \brief Evaluates a polynomial with the evaluator for its degree.
+  /// \param[in] c
+  ///   The coefficients.
+  /// \param[in] degree
+  ///   The degree.
+  /// \param[in] x
+  ///   The value to evaluate at.
+  /// \return The polynomial value.
+  static double Evaluate(const double* c, const int& degree,
+                         const double& x);
+
+  /// \brief Evaluates a polynomial with the generic Horner loop.
+  /// \param[in] c
+  ///   The coefficients.
+  /// \param[in] degree
+  ///   The degree.
+  /// \param[in] x
+  ///   The value to evaluate at.
+  /// \return The polynomial value.
+  static double EvaluateGeneric(const double* c, const int& degree,
+                                const double& x);
+
+  /// \brief Selects the evaluation form for a degree.
+  /// \param[in] degree
+  ///   The degree.
+  /// \return The evaluation form.
+  static FormType Select(const int& degree);
+
+  /// \var coefficients_
+  ///   The trimmed coefficients, in increasing order of power.
+  std::vector<double> coefficients_;
+
+  /// \var coefficients_slope_
+  ///   The derivative coefficients, in increasing order of power.
+  std::vector<double> coefficients_slope_;
+
+  /// \var form_
+  ///   The evaluation form.
+  FormType form_;
+};
+
+inline double PolynomialEvaluator::Slope(const double& x) const {
+  return Evaluate(coefficients_slope_.data(),
+                  coefficients_slope_.size() - 1, x);
+}
+
+inline double PolynomialEvaluator::Value(const double& x) const {
+  return Evaluate(coefficients_.data(), coefficients_.size() - 1, x);
+}
+
+inline double PolynomialEvaluator::Evaluate(const double* c,
+                                            const int& degree,
+                                            const double& x) {
+  switch (degree) {
+    case 0:
+      return PolynomialHorner<0>::Value(c, x);
+    case 1:
+      return PolynomialHorner<1>::Value(c, x);
+    case 2:
+      return PolynomialHorner<2>::Value(c, x);
+    case 3:
+      return PolynomialHorner<3>::Value(c, x);
+    case 4:
+      return PolynomialEstrin4::Value(c, x);
+    case 5:
+      return PolynomialHorner<5>::Value(c, x);
+    case 6:
+      return PolynomialHorner<6>::Value(c, x);
+    case 7:
+      return PolynomialHorner<7>::Value(c, x);
+    case 8:
+      return PolynomialHorner<8>::Value(c, x);
+    default:
+      return EvaluateGeneric(c, degree, x);
+  }
+}
+
+/// \par OVERVIEW
+///
+/// This struct contains the compiled polynomials of a cable. The polynomials
+/// are compiled by the benchmark, and aren't kept with the loaded cables.
+struct CablePolynomials {
+  /// \brief Compiles the polynomials of a cable.
+  /// \param[in] cable
+  ///   The cable.
+  void Compile(const Cable& cable);
+
+  /// \var core_creep
+  ///   The core creep polynomial.
+  PolynomialEvaluator core_creep;
+
+  /// \var core_loadstrain
+  ///   The core load-strain polynomial.
+  PolynomialEvaluator core_loadstrain;
+
+  /// \var shell_creep
+  ///   The shell creep polynomial.
+  PolynomialEvaluator shell_creep;
+
+  /// \var shell_loadstrain
+  ///   The shell load-strain polynomial.
+  PolynomialEvaluator shell_loadstrain;
+};
+
+#endif  // SPANANALYZER_POLYNOMIAL_EVALUATOR_H_
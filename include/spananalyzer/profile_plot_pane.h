@@ -10,6 +10,7 @@
 #include "models/transmissionline/catenary.h"
 #include "wx/docview.h"
 
+#include "spananalyzer/span.h"
 #include "spananalyzer/span_analyzer_config.h"
 
 /// \par OVERVIEW
@@ -64,6 +65,12 @@ class ProfilePlotPane : public PlotPane2d {
   ///   The catenary.
   void UpdateDatasetDimensions(const Catenary3d& catenary);
 
+  /// \brief Updates the profile dataset.
+  /// \param[in] span
+  ///   The span.
+  /// The profile points within the span are connected by lines.
+  void UpdateDatasetProfile(const Span& span);
+
   /// \brief Updates the plot datasets.
   void UpdatePlotDatasets() override;
 
@@ -82,6 +89,10 @@ class ProfilePlotPane : public PlotPane2d {
   ///   The dimension text dataset.
   TextDataSet2d dataset_dimension_text_;
 
+  /// \var dataset_profile_
+  ///   The profile dataset.
+  LineDataSet2d dataset_profile_;
+
   /// \var options_
   ///   The plot options, which are stored in the application config.
   ProfilePlotOptions* options_;
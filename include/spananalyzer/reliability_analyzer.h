@@ -0,0 +1,460 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_RELIABILITY_ANALYZER_H_
+#define SPANANALYZER_RELIABILITY_ANALYZER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "models/sagtension/line_cable_reloader.h"
+#include "models/transmissionline/weather_load_case.h"
+#include "wx/wx.h"
+
+#include "spananalyzer/span.h"
+#include "spananalyzer/worker_pool.h"
+
+/// \par OVERVIEW
+///
+/// This struct is a probability distribution of a weather variable.
+///
+/// \par PARAMETERS
+///
+/// The meaning of the parameters depends on the distribution type:
+///  - constant = value, unused
+///  - Gumbel = location, scale
+///  - normal = mean, standard deviation
+///  - uniform = minimum, maximum
+struct WeatherDistribution {
+  /// \par OVERVIEW
+  ///
+  /// This enum contains types of distributions.
+  enum class Type {
+    kNull,
+    kConstant,
+    kGumbel,
+    kNormal,
+    kUniform
+  };
+
+  /// \brief Samples the distribution.
+  /// \param[in] u1
+  ///   A uniform random number in (0, 1).
+  /// \param[in] u2
+  ///   A second uniform random number in (0, 1), which is only used by the
+  ///   normal distribution.
+  /// \return The sampled value.
+  double Sample(const double& u1, const double& u2) const;
+
+  /// \var parameter_a
+  ///   The first distribution parameter.
+  double parameter_a;
+
+  /// \var parameter_b
+  ///   The second distribution parameter.
+  double parameter_b;
+
+  /// \var type
+  ///   The distribution type.
+  Type type;
+};
+
+/// \par OVERVIEW
+///
+/// This struct contains the settings for a reliability analysis.
+struct ReliabilitySettings {
+  /// \var condition
+  ///   The reloaded condition.
+  CableConditionType condition;
+
+  /// \var density_ice
+  ///   The ice density, which isn't sampled.
+  double density_ice;
+
+  /// \var distribution_ice
+  ///   The ice thickness distribution.
+  WeatherDistribution distribution_ice;
+
+  /// \var distribution_temperature
+  ///   The cable temperature distribution.
+  WeatherDistribution distribution_temperature;
+
+  /// \var distribution_wind
+  ///   The wind pressure distribution.
+  WeatherDistribution distribution_wind;
+
+  /// \var num_samples
+  ///   The number of samples.
+  long num_samples;
+
+  /// \var seed
+  ///   The random number seed.
+  uint64_t seed;
+};
+
+/// \par OVERVIEW
+///
+/// This class accumulates the distribution of a quantity without storing the
+/// samples, so exceedance probabilities can be estimated.
+///
+/// \par BINS
+///
+/// The samples are counted in evenly spaced bins from zero. If a sample is
+/// above the last bin, adjacent bins are merged and the bin width is doubled
+/// until the sample fits, so the tail of the distribution is never clipped.
+/// The mean and variance are accumulated with Welford's method.
+///
+/// \par MERGING
+///
+/// Accumulators that were reset with the same bins can be merged, so each
+/// thread can accumulate its own samples without locking. The bin counts
+/// don't depend on the merge order, but the mean and variance are rounded
+/// differently, so they have to be merged in a fixed order to be reproduced.
+/// Accumulators without bins only accumulate the mean and variance.
+class ExceedanceAccumulator {
+ public:
+  /// \brief Constructor.
+  ExceedanceAccumulator();
+
+  /// \brief Adds a sample.
+  /// \param[in] value
+  ///   The sample value.
+  void Add(const double& value);
+
+  /// \brief Merges another accumulator into this one.
+  /// \param[in] other
+  ///   The other accumulator. If it has bins, they must have been reset the
+  ///   same as this accumulator.
+  void Merge(const ExceedanceAccumulator& other);
+
+  /// \brief Merges only the bin counts of another accumulator into this one.
+  /// \param[in] other
+  ///   The other accumulator, which must have been reset with the same bins.
+  /// The samples also need to be merged with Merge() from accumulators
+  /// without bins, or the sample count won't match the bin counts.
+  void MergeBins(const ExceedanceAccumulator& other);
+
+  /// \brief Resets the accumulator.
+  /// \param[in] value_max
+  ///   The initial maximum bin value.
+  /// \param[in] num_bins
+  ///   The number of bins. If zero, no bins are counted.
+  void Reset(const double& value_max, const int& num_bins);
+
+  /// \brief Gets the standard deviation.
+  /// \return The sample standard deviation.
+  double StandardDeviation() const;
+
+  /// \brief Gets the value that is exceeded with a probability.
+  /// \param[in] probability
+  ///   The exceedance probability.
+  /// \return The value, which is interpolated within a bin and is never more
+  ///   than the largest sample.
+  double ValueExceeded(const double& probability) const;
+
+  /// \brief Gets the number of samples.
+  /// \return The number of samples.
+  long count() const;
+
+  /// \brief Gets the largest sample.
+  /// \return The largest sample.
+  double max() const;
+
+  /// \brief Gets the mean.
+  /// \return The mean.
+  double mean() const;
+
+ private:
+  /// \brief Merges adjacent bins and doubles the bin width.
+  void Grow();
+
+  /// \var count_
+  ///   The number of samples.
+  long count_;
+
+  /// \var counts_
+  ///   The bin counts.
+  std::vector<long> counts_;
+
+  /// \var max_
+  ///   The largest sample.
+  double max_;
+
+  /// \var mean_
+  ///   The running mean.
+  double mean_;
+
+  /// \var squares_
+  ///   The running sum of squared differences from the mean.
+  double squares_;
+
+  /// \var width_bin_
+  ///   The bin width.
+  double width_bin_;
+};
+
+/// \par OVERVIEW
+///
+/// This struct contains the results of a reliability analysis.
+struct ReliabilityResult {
+  /// \var num_failures
+  ///   The number of samples that couldn't be solved.
+  long num_failures;
+
+  /// \var sag
+  ///   The sag distribution of the span.
+  ExceedanceAccumulator sag;
+
+  /// \var tension
+  ///   The maximum support tension distribution of the span.
+  ExceedanceAccumulator tension;
+
+  /// \var time
+  ///   The analysis time, in seconds.
+  double time;
+};
+
+/// \par OVERVIEW
+///
+/// This struct contains the mean and variance of a batch of reliability
+/// samples. The accumulators don't have bins.
+struct ReliabilityBatch {
+  /// \var sag
+  ///   The sag accumulator.
+  ExceedanceAccumulator sag;
+
+  /// \var tension
+  ///   The tension accumulator.
+  ExceedanceAccumulator tension;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a worker thread for a reliability analysis.
+///
+/// \par BATCHES
+///
+/// The samples are split into batches. Each thread claims the next batch from
+/// a shared counter until all of the batches are claimed, so threads that
+/// solve faster samples do more batches.
+///
+/// \par RANDOM NUMBERS
+///
+/// The random numbers of a sample are generated from a counter-based hash of
+/// the seed and the sample index. The samples are the same regardless of the
+/// number of threads or the batch that a sample is solved in, so an analysis
+/// can be reproduced.
+///
+/// \par RESULTS
+///
+/// Each sample is solved as a weathercase with a LineCableReloader owned by
+/// the thread, and no sample results are stored. The bin counts are
+/// accumulated by the thread. The mean and variance are accumulated for each
+/// batch, so the analyzer can merge them in batch order regardless of which
+/// thread solved each batch.
+class ReliabilityThread : public WorkerThread {
+ public:
+  /// \brief Constructor.
+  ReliabilityThread();
+
+  /// \brief Initializes the reloader.
+  /// This must be done after the line cable and settings are set, and before
+  /// any samples are solved.
+  void Initialize();
+
+  /// \brief Initializes the reloader, and claims and solves batches until all
+  ///   of the samples are solved.
+  virtual void Process();
+
+  /// \brief Solves a sample.
+  /// \param[in] index
+  ///   The sample index.
+  /// \param[out] sag
+  ///   The span sag.
+  /// \param[out] tension
+  ///   The span maximum support tension.
+  /// \return If the sample was solved.
+  bool SolveSample(const long& index, double& sag, double& tension);
+
+  /// \brief Gets the number of samples that couldn't be solved.
+  /// \return The number of samples that couldn't be solved.
+  long num_failures() const;
+
+  /// \brief Gets the sag accumulator.
+  /// \return The sag accumulator. Only the bin counts should be merged, as
+  ///   the mean and variance depend on the batches the thread claimed.
+  const ExceedanceAccumulator& sag() const;
+
+  /// \brief Sets the accumulators.
+  /// \param[in] sag
+  ///   The sag accumulator, which the thread accumulator is copied from.
+  /// \param[in] tension
+  ///   The tension accumulator, which the thread accumulator is copied from.
+  void set_accumulators(const ExceedanceAccumulator& sag,
+                        const ExceedanceAccumulator& tension);
+
+  /// \brief Sets the batch results.
+  /// \param[in] batches
+  ///   The batch results, which are indexed by batch and sized to the number
+  ///   of batches.
+  void set_batches(std::vector<ReliabilityBatch>* batches);
+
+  /// \brief Sets the shared batch counter.
+  /// \param[in] index_batch
+  ///   The index of the next batch to claim.
+  void set_index_batch(std::atomic<long>* index_batch);
+
+  /// \brief Sets the sample index range.
+  /// \param[in] index_begin
+  ///   The first sample index of the first batch.
+  /// \param[in] index_end
+  ///   The sample index after the last sample.
+  void set_indexes(const long& index_begin, const long& index_end);
+
+  /// \brief Sets the line cable.
+  /// \param[in] line_cable
+  ///   The line cable, which must be connected to line structures.
+  void set_line_cable(const LineCable* line_cable);
+
+  /// \brief Sets the settings.
+  /// \param[in] settings
+  ///   The settings.
+  void set_settings(const ReliabilitySettings* settings);
+
+  /// \brief Sets the span spacing.
+  /// \param[in] spacing
+  ///   The span attachment spacing.
+  void set_spacing(const Vector3d* spacing);
+
+  /// \brief Gets the tension accumulator.
+  /// \return The tension accumulator. Only the bin counts should be merged,
+  ///   as the mean and variance depend on the batches the thread claimed.
+  const ExceedanceAccumulator& tension() const;
+
+ protected:
+  /// \var batches_
+  ///   The batch results.
+  std::vector<ReliabilityBatch>* batches_;
+
+  /// \var index_batch_
+  ///   The shared index of the next batch to claim.
+  std::atomic<long>* index_batch_;
+
+  /// \var index_begin_
+  ///   The first sample index of the first batch.
+  long index_begin_;
+
+  /// \var index_end_
+  ///   The sample index after the last sample.
+  long index_end_;
+
+  /// \var line_cable_
+  ///   The line cable.
+  const LineCable* line_cable_;
+
+  /// \var num_failures_
+  ///   The number of samples that couldn't be solved.
+  long num_failures_;
+
+  /// \var reloader_
+  ///   The reloader, which is only used by this thread.
+  LineCableReloader reloader_;
+
+  /// \var sag_
+  ///   The sag accumulator.
+  ExceedanceAccumulator sag_;
+
+  /// \var settings_
+  ///   The settings.
+  const ReliabilitySettings* settings_;
+
+  /// \var spacing_
+  ///   The span attachment spacing.
+  const Vector3d* spacing_;
+
+  /// \var tension_
+  ///   The tension accumulator.
+  ExceedanceAccumulator tension_;
+
+  /// \var weathercase_
+  ///   The sampled weathercase.
+  WeatherLoadCase weathercase_;
+};
+
+/// \par OVERVIEW
+///
+/// This class runs a Monte Carlo reliability analysis of a span, where the ice
+/// thickness, wind pressure and temperature are drawn from distributions.
+///
+/// \par BINS
+///
+/// A small pilot set of samples is solved first to size the initial
+/// accumulator bins, which grow if later samples exceed them. The pilot
+/// samples are the first samples of the analysis, so they are also included
+/// in the results.
+///
+/// \par THREADS
+///
+/// The remaining samples are solved by worker threads, which each have their
+/// own reloader and accumulators. The batch results are merged in batch
+/// order, so the results are the same for any number of threads.
+class ReliabilityAnalyzer {
+ public:
+  /// \brief Constructor.
+  ReliabilityAnalyzer();
+
+  /// \brief Destructor.
+  ~ReliabilityAnalyzer();
+
+  /// \brief Runs the analysis.
+  /// \param[out] result
+  ///   The result.
+  /// \return If the analysis was run. If no pilot samples can be solved, the
+  ///   analysis isn't run.
+  bool Run(ReliabilityResult& result) const;
+
+  /// \brief Gets the maximum number of threads.
+  /// \return The maximum number of threads.
+  int max_threads() const;
+
+  /// \brief Sets the maximum number of threads.
+  /// \param[in] max_threads
+  ///   The maximum number of threads. If less than one, the number of
+  ///   available CPUs is used.
+  void set_max_threads(const int& max_threads);
+
+  /// \brief Sets the settings.
+  /// \param[in] settings
+  ///   The settings.
+  void set_settings(const ReliabilitySettings& settings);
+
+  /// \brief Sets the span.
+  /// \param[in] span
+  ///   The span, which must have a line cable that is connected to line
+  ///   structures.
+  void set_span(const Span* span);
+
+  /// \brief Gets the settings.
+  /// \return The settings.
+  const ReliabilitySettings& settings() const;
+
+  /// \brief Gets the span.
+  /// \return The span.
+  const Span* span() const;
+
+ private:
+  /// \var max_threads_
+  ///   The maximum number of threads.
+  int max_threads_;
+
+  /// \var settings_
+  ///   The settings.
+  ReliabilitySettings settings_;
+
+  /// \var span_
+  ///   The span.
+  const Span* span_;
+};
+
+#endif  // SPANANALYZER_RELIABILITY_ANALYZER_H_
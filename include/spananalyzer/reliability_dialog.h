@@ -0,0 +1,125 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_RELIABILITY_DIALOG_H_
+#define SPANANALYZER_RELIABILITY_DIALOG_H_
+
+#include "models/base/units.h"
+#include "wx/listctrl.h"
+#include "wx/wx.h"
+
+#include "spananalyzer/reliability_analyzer.h"
+#include "spananalyzer/span.h"
+
+/// \par OVERVIEW
+///
+/// This class is a dialog that runs a reliability analysis of a span and
+/// displays the exceedance values of the span tension and sag.
+///
+/// \par GUI CONTROLS AND DATA TRANSFER
+///
+/// The form controls and layout are defined in the XRC file. The settings are
+/// transferred between the controls and the display unit settings via
+/// validators, and are converted to the model unit system when the analysis is
+/// run.
+///
+/// \par DISTRIBUTION PARAMETERS
+///
+/// The weather variables use the same units as a weathercase. The second
+/// parameter of the Gumbel and normal distributions is a scale, so it is
+/// converted as a difference.
+class ReliabilityDialog : public wxDialog {
+ public:
+  /// \brief Constructor.
+  /// \param[in] parent
+  ///   The parent window.
+  /// \param[in] span
+  ///   The span, which must have a line cable that is connected to line
+  ///   structures.
+  /// \param[in] units
+  ///   The unit system to display on the form.
+  /// \param[in] max_threads
+  ///   The maximum number of analysis threads.
+  ReliabilityDialog(wxWindow* parent, const Span* span,
+                    const units::UnitSystem& units, const int& max_threads);
+
+  /// \brief Destructor.
+  ~ReliabilityDialog();
+
+ private:
+  /// \brief Converts the settings to the model unit system.
+  /// \param[in,out] settings
+  ///   The settings, which are in the display unit system.
+  void ConvertSettingsToModel(ReliabilitySettings& settings) const;
+
+  /// \brief Initializes the choice controls on the form.
+  void InitChoiceControls();
+
+  /// \brief Handles the run button event.
+  /// \param[in] event
+  ///   The event.
+  void OnButtonRun(wxCommandEvent& event);
+
+  /// \brief Handles the cancel button event.
+  /// \param[in] event
+  ///   The event.
+  void OnCancel(wxCommandEvent& event);
+
+  /// \brief Handles the close event.
+  /// \param[in] event
+  ///   The event.
+  void OnClose(wxCloseEvent& event);
+
+  /// \brief Sets the static text to display the appropriate units.
+  /// \param[in] units
+  ///   The unit system to display.
+  void SetUnitsStaticText(const units::UnitSystem& units);
+
+  /// \brief Sets the control validators on the form.
+  void SetValidators();
+
+  /// \brief Transfers data that isn't tied to a validator from the window to
+  ///   the settings.
+  void TransferCustomDataFromWindow();
+
+  /// \brief Transfers data that isn't tied to a validator from the settings
+  ///   to the window.
+  void TransferCustomDataToWindow();
+
+  /// \brief Updates the listctrl with a result.
+  /// \param[in] result
+  ///   The result, which is in the model unit system.
+  void UpdateListCtrl(const ReliabilityResult& result);
+
+  /// \var analyzer_
+  ///   The analyzer.
+  ReliabilityAnalyzer analyzer_;
+
+  /// \var listctrl_
+  ///   The listctrl that displays the results.
+  wxListCtrl* listctrl_;
+
+  /// \var seed_
+  ///   The random number seed, which is transferred with a validator.
+  unsigned long seed_;
+
+  /// \var settings_
+  ///   The settings, in the display unit system.
+  ReliabilitySettings settings_;
+
+  /// \var span_
+  ///   The span.
+  const Span* span_;
+
+  /// \var units_
+  ///   The unit system displayed on the form.
+  const units::UnitSystem* units_;
+
+  /// \var units_model_
+  ///   The unit system of the model.
+  units::UnitSystem units_model_;
+
+  DECLARE_EVENT_TABLE()
+};
+
+#endif  // SPANANALYZER_RELIABILITY_DIALOG_H_
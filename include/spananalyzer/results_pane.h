@@ -22,9 +22,13 @@ class ResultsPane : public wxPanel {
   enum class ReportType {
     kCatenary,
     kCatenaryEndpoints,
+    kClearance,
     kConstraint,
     kLength,
+    kLineSection,
     kSagTension,
+    kSolverStatistics,
+    kTemperatureSweep,
     kTensionDistribution,
   };
 
@@ -62,7 +66,7 @@ class ResultsPane : public wxPanel {
 
   /// \brief Gets a list of filtered results.
   /// \return The filtered results.
-  std::list<const SagTensionAnalysisResult*> Results();
+  std::list<SagTensionAnalysisResult> Results();
 
   /// \brief Toggles the filter group controls.
   void ToggleFilterGroupControls();
@@ -85,12 +89,31 @@ class ResultsPane : public wxPanel {
   /// \brief Updates the report data with catenary endpoint results.
   void UpdateReportDataCatenaryEndpoints();
 
+  /// \brief Updates the report data with clearance results.
+  /// The activated span is checked against its profile points for each
+  /// filter.
+  void UpdateReportDataClearance();
+
   /// \brief Updates the report data with length results.
   void UpdateReportDataLength();
 
+  /// \brief Updates the line section report data.
+  /// The line section of the activated span is solved for each filter.
+  void UpdateReportDataLineSection();
+
   /// \brief Updates the report data with sag-tension results.
   void UpdateReportDataSagTension();
 
+  /// \brief Updates the report data with solver statistics.
+  void UpdateReportDataSolverStatistics();
+
+  /// \brief Updates the report data with temperature sweep results.
+  /// The activated span is solved over the temperature range of the
+  /// weathercases for each filter, in a limited number of steps. The sweeps
+  /// are cached by the analysis controller, so a refresh that doesn't change
+  /// the span line cable reuses them.
+  void UpdateReportDataTemperatureSweep();
+
   /// \brief Updates the report data with tension distribution results.
   void UpdateReportDataTensionDistribution();
 
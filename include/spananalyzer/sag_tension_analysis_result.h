@@ -15,6 +15,9 @@
 ///
 /// The sag-tension solution is fairly computationally expensive. Using these
 /// results, a catenary can be created to generate further analysis results.
+///
+/// Solver statistics (solve times and length residual) are also recorded so
+/// that slow or poorly converged solutions can be identified.
 struct SagTensionAnalysisResult {
   /// \var condition
   ///   The condition of the cable.
@@ -25,6 +28,13 @@ struct SagTensionAnalysisResult {
   ///   not the ruling span spacing.
   double length_unloaded;
 
+  /// \var residual_length
+  ///   The relative length residual of the solution. This compares the
+  ///   reloaded catenary length to the length predicted by the cable
+  ///   elongation model from the unloaded length and average tension, and
+  ///   should be near zero for a converged solution.
+  double residual_length;
+
   /// \var state
   ///   The cable state.
   CableState state;
@@ -53,6 +63,14 @@ struct SagTensionAnalysisResult {
   ///   The horizontal tension of the cable shell.
   double tension_horizontal_shell;
 
+  /// \var time_solve_reloader
+  ///   The time to solve the reloaded catenary, in seconds.
+  double time_solve_reloader;
+
+  /// \var time_solve_unloader
+  ///   The time to solve the unloaded length, in seconds.
+  double time_solve_unloader;
+
   /// \var weathercase
   ///   The weathercase used in the calculation.
   const WeatherLoadCase* weathercase;
@@ -0,0 +1,168 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_SAG_TENSION_RESULT_CACHE_H_
+#define SPANANALYZER_SAG_TENSION_RESULT_CACHE_H_
+
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "wx/file.h"
+
+/// \par OVERVIEW
+///
+/// This class is a memory-bounded, least-recently-used cache of serialized
+/// result blocks. Each block is identified by a key, which is typically the
+/// address of the span that the results were calculated for. The key is never
+/// dereferenced.
+///
+/// \par MEMORY BUDGET
+///
+/// The blocks that are held in memory are limited by a memory budget. When the
+/// budget is exceeded, the least recently used blocks are evicted.
+///
+/// \par SPILLING
+///
+/// If spilling is enabled, evicted blocks are written to a temporary spill
+/// file instead of being discarded, and are read back when they are extracted.
+/// The spill file is only appended to, and is truncated once it no longer
+/// contains any blocks. The spill file is deleted when the cache is destroyed.
+///
+/// If spilling is disabled, evicted blocks are discarded and the owner needs
+/// to recompute the results.
+class SagTensionResultCache {
+ public:
+  /// \brief Constructor.
+  SagTensionResultCache();
+
+  /// \brief Destructor.
+  ~SagTensionResultCache();
+
+  /// \brief Clears all of the blocks.
+  void Clear();
+
+  /// \brief Extracts a block from the cache.
+  /// \param[in] key
+  ///   The block key.
+  /// \param[out] block
+  ///   The block that is populated.
+  /// \return If the block was cached. If the block was spilled and could not
+  ///   be read, false is returned.
+  /// The block is removed from the cache.
+  bool Extract(const void* key, std::vector<char>& block);
+
+  /// \brief Inserts a block into the cache.
+  /// \param[in] key
+  ///   The block key. Any existing block with the same key is replaced.
+  /// \param[in,out] block
+  ///   The block, which is moved into the cache and left empty.
+  void Insert(const void* key, std::vector<char>& block);
+
+  /// \brief Removes a block from the cache.
+  /// \param[in] key
+  ///   The block key.
+  void Remove(const void* key);
+
+  /// \brief Gets if evicted blocks are spilled to disk.
+  /// \return If evicted blocks are spilled to disk.
+  bool is_spilling() const;
+
+  /// \brief Gets the number of cached blocks, including spilled blocks.
+  /// \return The number of cached blocks.
+  int num_blocks() const;
+
+  /// \brief Sets if evicted blocks are spilled to disk.
+  /// \param[in] is_spilling
+  ///   An indicator that determines if evicted blocks are spilled to disk.
+  void set_is_spilling(const bool& is_spilling);
+
+  /// \brief Sets the memory budget.
+  /// \param[in] size_budget
+  ///   The memory budget, in bytes.
+  void set_size_budget(const long& size_budget);
+
+  /// \brief Gets the memory budget.
+  /// \return The memory budget, in bytes.
+  long size_budget() const;
+
+  /// \brief Gets the memory used by the blocks that are held in memory.
+  /// \return The memory used by the blocks, in bytes.
+  long size_memory() const;
+
+ private:
+  /// \par OVERVIEW
+  ///
+  /// This struct is a cache entry.
+  struct Entry {
+    /// \var block
+    ///   The block. This is empty if the block is spilled.
+    std::vector<char> block;
+
+    /// \var is_spilled
+    ///   An indicator that tells if the block is in the spill file.
+    bool is_spilled;
+
+    /// \var key
+    ///   The block key.
+    const void* key;
+
+    /// \var offset_spill
+    ///   The spill file offset of the block.
+    wxFileOffset offset_spill;
+
+    /// \var size_spill
+    ///   The size of the spilled block.
+    size_t size_spill;
+  };
+
+  /// \brief Evicts the least recently used blocks until the memory budget is
+  ///   met.
+  void Evict();
+
+  /// \brief Erases an entry.
+  /// \param[in] iter
+  ///   The entry iterator.
+  void Erase(std::list<Entry>::iterator iter);
+
+  /// \brief Spills an entry to the spill file.
+  /// \param[in] entry
+  ///   The entry.
+  /// \return If the entry was spilled.
+  bool Spill(Entry& entry);
+
+  /// \var entries_
+  ///   The entries, ordered from most to least recently used.
+  std::list<Entry> entries_;
+
+  /// \var file_spill_
+  ///   The spill file.
+  wxFile file_spill_;
+
+  /// \var filepath_spill_
+  ///   The spill file path. This is empty until a block is spilled.
+  std::string filepath_spill_;
+
+  /// \var index_
+  ///   The entry index, which is keyed by the block key.
+  std::unordered_map<const void*, std::list<Entry>::iterator> index_;
+
+  /// \var is_spilling_
+  ///   An indicator that determines if evicted blocks are spilled to disk.
+  bool is_spilling_;
+
+  /// \var num_spilled_
+  ///   The number of blocks in the spill file.
+  int num_spilled_;
+
+  /// \var size_budget_
+  ///   The memory budget, in bytes.
+  long size_budget_;
+
+  /// \var size_memory_
+  ///   The memory used by the blocks that are held in memory, in bytes.
+  long size_memory_;
+};
+
+#endif  // SPANANALYZER_SAG_TENSION_RESULT_CACHE_H_
@@ -0,0 +1,217 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_SAG_TENSION_RESULT_STORE_H_
+#define SPANANALYZER_SAG_TENSION_RESULT_STORE_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "models/sagtension/cable_state.h"
+#include "models/transmissionline/weather_load_case.h"
+
+#include "spananalyzer/sag_tension_analysis_result.h"
+
+/// \par OVERVIEW
+///
+/// This class stores sag-tension analysis results in a columnar
+/// (structure-of-arrays) layout.
+///
+/// \par AXES
+///
+/// Results are addressed by a case index and a condition. For a single span
+/// analysis the case index is the weathercase index. The condition axis is
+/// ordered creep, initial, load, and is the outer axis of every column, so a
+/// scan of one condition across all cases reads contiguous memory.
+///
+/// \par COLUMNS
+///
+/// Each result quantity is stored in its own array. Quantities that are used
+/// to build catenaries or elongation models are stored in double precision.
+/// The cable component tensions and solver statistics are only displayed, so
+/// they are stored in single precision. The weathercase is stored once per
+/// case instead of once per result.
+///
+/// \par VALIDITY
+///
+/// A bitmap flags which results are valid, so no sentinel values are stored.
+/// The bitmap words are updated atomically so worker threads can set results
+/// for different cases and conditions concurrently. Each result slot must only
+/// be set by one thread.
+///
+/// \par ROWS
+///
+/// Results are materialized into a SagTensionAnalysisResult when requested.
+/// Invalid results are materialized with a null condition and the legacy
+/// -999999 values so existing consumers behave the same.
+///
+/// \par SERIALIZATION
+///
+/// The columns can be serialized into a single compact block, which allows
+/// the results to be cached or spilled to disk and restored without
+/// recalculating them.
+class SagTensionResultStore {
+ public:
+  /// \brief Constructor.
+  SagTensionResultStore();
+
+  /// \brief Destructor.
+  ~SagTensionResultStore();
+
+  /// \brief Clears all results and releases the column memory.
+  void Clear();
+
+  /// \brief Restores the results from a serialized block.
+  /// \param[in] block
+  ///   The block, which was generated by Serialize().
+  /// \return If the block was restored. If the block is invalid, the store is
+  ///   cleared and false is returned.
+  /// The weathercases are not serialized, and need to be set after the block
+  /// is restored.
+  bool Deserialize(const std::vector<char>& block);
+
+  /// \brief Gets if a result is valid.
+  /// \param[in] index_case
+  ///   The case index.
+  /// \param[in] condition
+  ///   The condition.
+  /// \return If the result is valid. If the index or condition are out of
+  ///   range, false is returned.
+  bool IsValid(const int& index_case,
+               const CableConditionType& condition) const;
+
+  /// \brief Resizes the store and invalidates all results.
+  /// \param[in] size_cases
+  ///   The number of cases.
+  /// This must not be called while any threads are setting results.
+  void Reset(const int& size_cases);
+
+  /// \brief Gets a result.
+  /// \param[in] index_case
+  ///   The case index.
+  /// \param[in] condition
+  ///   The condition.
+  /// \param[out] result
+  ///   The result that is populated. Invalid results are populated with a null
+  ///   condition, -999999 values, and the solver statistics.
+  /// \return If the result is valid. If the index or condition are out of
+  ///   range, the result is not populated and false is returned.
+  bool Result(const int& index_case,
+              const CableConditionType& condition,
+              SagTensionAnalysisResult& result) const;
+
+  /// \brief Serializes the results into a compact block.
+  /// \param[out] block
+  ///   The block that is populated. The columns are copied as-is, so the
+  ///   block is only valid within the same process.
+  void Serialize(std::vector<char>& block) const;
+
+  /// \brief Sets a result.
+  /// \param[in] index_case
+  ///   The case index.
+  /// \param[in] condition
+  ///   The condition.
+  /// \param[in] result
+  ///   The result. If the result condition is null, the result is flagged as
+  ///   invalid and only the solver statistics are stored.
+  /// This is safe to call from multiple threads, as long as each slot is only
+  /// set by one thread.
+  void SetResult(const int& index_case,
+                 const CableConditionType& condition,
+                 const SagTensionAnalysisResult& result);
+
+  /// \brief Sets the weathercase for a case.
+  /// \param[in] index_case
+  ///   The case index.
+  /// \param[in] weathercase
+  ///   The weathercase.
+  void SetWeathercase(const int& index_case,
+                      const WeatherLoadCase* weathercase);
+
+  /// \brief Gets the approximate memory used by the columns.
+  /// \return The memory used by the columns, in bytes.
+  long SizeMemory() const;
+
+  /// \brief Gets the number of cases.
+  /// \return The number of cases.
+  int size_cases() const;
+
+ private:
+  /// \brief Gets the column slot index.
+  /// \param[in] index_case
+  ///   The case index.
+  /// \param[in] condition
+  ///   The condition.
+  /// \return The slot index. If the index or condition are out of range, -1 is
+  ///   returned.
+  int IndexSlot(const int& index_case,
+                const CableConditionType& condition) const;
+
+  /// \var flags_valid_
+  ///   The validity bitmap, with one bit per slot.
+  std::unique_ptr<std::atomic<uint64_t>[]> flags_valid_;
+
+  /// \var lengths_unloaded_
+  ///   The unloaded lengths.
+  std::vector<double> lengths_unloaded_;
+
+  /// \var residuals_length_
+  ///   The relative length residuals.
+  std::vector<float> residuals_length_;
+
+  /// \var size_cases_
+  ///   The number of cases.
+  int size_cases_;
+
+  /// \var temperatures_
+  ///   The cable state temperatures.
+  std::vector<double> temperatures_;
+
+  /// \var tensions_average_
+  ///   The average tensions.
+  std::vector<double> tensions_average_;
+
+  /// \var tensions_average_core_
+  ///   The average tensions of the cable core.
+  std::vector<float> tensions_average_core_;
+
+  /// \var tensions_average_shell_
+  ///   The average tensions of the cable shell.
+  std::vector<float> tensions_average_shell_;
+
+  /// \var tensions_horizontal_
+  ///   The horizontal tensions.
+  std::vector<double> tensions_horizontal_;
+
+  /// \var tensions_horizontal_core_
+  ///   The horizontal tensions of the cable core.
+  std::vector<float> tensions_horizontal_core_;
+
+  /// \var tensions_horizontal_shell_
+  ///   The horizontal tensions of the cable shell.
+  std::vector<float> tensions_horizontal_shell_;
+
+  /// \var times_solve_reloader_
+  ///   The reloader solve times, in seconds.
+  std::vector<float> times_solve_reloader_;
+
+  /// \var times_solve_unloader_
+  ///   The unloader solve times, in seconds.
+  std::vector<float> times_solve_unloader_;
+
+  /// \var types_polynomial_
+  ///   The cable state polynomial types.
+  std::vector<SagTensionCableComponent::PolynomialType> types_polynomial_;
+
+  /// \var weathercases_
+  ///   The weathercases, with one per case.
+  std::vector<const WeatherLoadCase*> weathercases_;
+
+  /// \var weights_unit_
+  ///   The unit weights, with three components (x, y, z) per slot.
+  std::vector<double> weights_unit_;
+};
+
+#endif  // SPANANALYZER_SAG_TENSION_RESULT_STORE_H_
@@ -6,10 +6,29 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 #include "models/base/error_message.h"
 #include "models/transmissionline/line_cable.h"
 
+/// \par OVERVIEW
+///
+/// This struct contains a ground or crossing point below a span. The point is
+/// positioned relative to the back attachment point of the span.
+struct ProfilePoint {
+  /// \var clearance
+  ///   The required vertical clearance from the cable to the point.
+  double clearance;
+
+  /// \var elevation
+  ///   The elevation of the point, relative to the back attachment point.
+  double elevation;
+
+  /// \var station
+  ///   The horizontal distance from the back attachment point.
+  double station;
+};
+
 /// \par OVERVIEW
 ///
 /// This struct contains information for a cable in a single span. This class
@@ -50,6 +69,11 @@ struct Span {
   ///   The name.
   std::string name;
 
+  /// \var profile
+  ///   The ground and crossing points below the span, which are checked for
+  ///   clearance. Points outside of the span are ignored.
+  std::vector<ProfilePoint> profile;
+
   /// \var spacing_attachments
   ///   The attachment spacing for the span. The line cable spacing contains the
   ///   attachment spacing for the entire line section. When the span type is
@@ -4,6 +4,7 @@
 #ifndef SPANANALYZER_SPAN_ANALYZER_APP_H_
 #define SPANANALYZER_SPAN_ANALYZER_APP_H_
 
+#include <list>
 #include <string>
 
 #include "wx/cmdline.h"
@@ -11,6 +12,8 @@
 #include "wx/html/helpctrl.h"
 #include "wx/wx.h"
 
+#include "spananalyzer/data_index.h"
+#include "spananalyzer/file_save_controller.h"
 #include "spananalyzer/span_analyzer_config.h"
 #include "spananalyzer/span_analyzer_data.h"
 #include "spananalyzer/span_analyzer_doc.h"
@@ -31,6 +34,24 @@
 ///   - AUI pane layout and frame size
 ///   - data file location
 ///
+/// \par BENCHMARK
+///
+/// The application can be started in a benchmark mode from the command line.
+/// The main frame is not shown, and the document specified on the command line
+/// is repeatedly opened, analyzed, and saved for different thread counts.
+///
+/// \par BATCH
+///
+/// The application can also run a batch analysis from the command line on a
+/// document or a directory of documents. The batch is split into shards that
+/// are run by headless processes of this application, and the shard results
+/// are merged into one results file.
+///
+/// \par THREAD OPTIONS
+///
+/// The analysis thread options can be overridden from the command line. The
+/// overrides only apply to the session, and aren't saved to the config file.
+///
 /// \par DATA
 ///
 /// The application holds general data that is loaded on startup. This
@@ -50,6 +71,11 @@ class SpanAnalyzerApp : public wxApp {
   /// \return The document. If no document is open, a nullptr is returned.
   SpanAnalyzerDoc* GetDocument() const;
 
+  /// \brief Determines if the application is running without a user.
+  /// \return If a batch or benchmark is running, in which case the frame is
+  ///   never shown and no dialogs should be shown.
+  bool IsHeadless() const;
+
   /// \brief Parses the command line options provided to the application on
   ///   startup.
   /// \param[in] parser
@@ -70,10 +96,25 @@ class SpanAnalyzerApp : public wxApp {
   ///   The command line parser, which is provided by wxWidgets.
   virtual void OnInitCmdLine(wxCmdLineParser& parser);
 
+  /// \brief Runs the application main loop.
+  /// \return The application exit code.
+  /// If a batch or benchmark is specified on the command line, it is run
+  /// instead of the main loop and the application exits when it completes.
+  virtual int OnRun();
+
+  /// \brief Gets the analysis thread options.
+  /// \return The configured thread options, with any command line overrides
+  ///   applied.
+  ThreadOptions OptionsThreads() const;
+
   /// \brief Gets the application configuration settings.
   /// \return The application configuration settings.
   SpanAnalyzerConfig* config();
 
+  /// \brief Gets the file save controller.
+  /// \return The file save controller, which saves files on a worker thread.
+  FileSaveController* controller_save();
+
   /// \brief Gets the application data.
   /// \return The application data.
   SpanAnalyzerData* data();
@@ -86,10 +127,21 @@ class SpanAnalyzerApp : public wxApp {
   /// \return The help controller.
   wxHtmlHelpController* help();
 
+  /// \brief Gets the application data index.
+  /// \return The index of the application data cables and weathercases. This
+  ///   needs to be built again when the application data is edited.
+  DataIndex* index_data();
+
   /// \brief Gets the document manager.
   /// \return The document manager.
   wxDocManager* manager_doc();
 
+  /// \brief Gets the model unit system.
+  /// \return The unit system that the application data and document are kept
+  ///   in. This is fixed for the session, and the configured unit system is
+  ///   only used for display.
+  units::UnitSystem units_model() const;
+
   /// \brief Gets the application version.
   /// \return The application version.
   std::string version() const;
@@ -99,10 +151,26 @@ class SpanAnalyzerApp : public wxApp {
   ///   The application configuration settings.
   SpanAnalyzerConfig config_;
 
+  /// \var controller_save_
+  ///   The file save controller.
+  FileSaveController controller_save_;
+
   /// \var data_
   ///   The application data.
   SpanAnalyzerData data_;
 
+  /// \var filepath_batch_
+  ///   The batch results file. This is specified as a command line option,
+  ///   and if set the application will run a batch analysis (or a shard of
+  ///   one) instead of the main loop.
+  std::string filepath_batch_;
+
+  /// \var filepath_benchmark_
+  ///   The benchmark results file. This is specified as a command line option,
+  ///   and if set the application will run a benchmark instead of the main
+  ///   loop.
+  std::string filepath_benchmark_;
+
   /// \var filepath_config_
   ///   The config file that is loaded on application startup. This is specified
   ///   as a command line option.
@@ -121,10 +189,50 @@ class SpanAnalyzerApp : public wxApp {
   ///   The help controller.
   wxHtmlHelpController* help_;
 
+  /// \var index_begin_batch_
+  ///   The first span index of the batch shard. This is specified as a command
+  ///   line option, and is -1 unless this is a shard process.
+  int index_begin_batch_;
+
+  /// \var index_data_
+  ///   The index of the application data cables and weathercases.
+  DataIndex index_data_;
+
+  /// \var index_end_batch_
+  ///   The span index after the last span of the batch shard. This is
+  ///   specified as a command line option.
+  int index_end_batch_;
+
   /// \var manager_doc_
   ///   The document manager.
   wxDocManager* manager_doc_;
 
+  /// \var max_processes_batch_
+  ///   The maximum number of batch shard processes. This is specified as a
+  ///   command line option.
+  int max_processes_batch_;
+
+  /// \var options_threads_cmdline_
+  ///   The thread options that are specified as command line options. The
+  ///   maximum threads is -1 if it isn't specified, and the indicators can
+  ///   only enable the config settings.
+  ThreadOptions options_threads_cmdline_;
+
+  /// \var size_shard_batch_
+  ///   The maximum number of spans in each batch shard. This is specified as a
+  ///   command line option.
+  int size_shard_batch_;
+
+  /// \var threads_benchmark_
+  ///   The thread counts to benchmark. This is specified as a command line
+  ///   option.
+  std::list<int> threads_benchmark_;
+
+  /// \var units_model_
+  ///   The model unit system, which is set from the config when the
+  ///   application starts.
+  units::UnitSystem units_model_;
+
   /// \var version_
   ///   The app version.
   std::string version_;
@@ -136,6 +244,33 @@ static const wxCmdLineEntryDesc cmd_line_desc[] = {
       wxCMD_LINE_VAL_NONE, wxCMD_LINE_OPTION_HELP},
   {wxCMD_LINE_OPTION, nullptr, "config", "the application configuration file",
       wxCMD_LINE_VAL_STRING},
+  {wxCMD_LINE_OPTION, nullptr, "benchmark",
+      "runs a benchmark on the file and writes the results to this file",
+      wxCMD_LINE_VAL_STRING},
+  {wxCMD_LINE_OPTION, nullptr, "benchmark-threads",
+      "comma separated list of thread counts to benchmark",
+      wxCMD_LINE_VAL_STRING},
+  {wxCMD_LINE_OPTION, nullptr, "batch",
+      "runs a batch analysis on the file or directory and writes the results "
+      "to this file",
+      wxCMD_LINE_VAL_STRING},
+  {wxCMD_LINE_OPTION, nullptr, "batch-processes",
+      "the maximum number of batch shard processes (0 uses all CPUs)",
+      wxCMD_LINE_VAL_NUMBER},
+  {wxCMD_LINE_OPTION, nullptr, "batch-spans",
+      "the maximum number of spans in each batch shard",
+      wxCMD_LINE_VAL_NUMBER},
+  {wxCMD_LINE_OPTION, nullptr, "batch-shard",
+      "analyzes a span range (begin,end) of the file as a batch shard, which "
+      "is used by the batch analysis",
+      wxCMD_LINE_VAL_STRING},
+  {wxCMD_LINE_OPTION, nullptr, "threads",
+      "the maximum number of analysis threads (0 uses all CPUs)",
+      wxCMD_LINE_VAL_NUMBER},
+  {wxCMD_LINE_SWITCH, nullptr, "threads-pinned",
+      "pins the analysis threads to CPUs"},
+  {wxCMD_LINE_SWITCH, nullptr, "threads-background",
+      "runs the analysis threads at the lowest priority"},
   {wxCMD_LINE_PARAM, nullptr, nullptr, "file",
       wxCMD_LINE_VAL_STRING, wxCMD_LINE_PARAM_OPTIONAL},
 
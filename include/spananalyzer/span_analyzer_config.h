@@ -80,6 +80,57 @@ struct ProfilePlotOptions {
   int thickness_line;
 };
 
+/// \par OVERVIEW
+///
+/// This struct has the options for the analysis result cache.
+struct ResultCacheOptions {
+ public:
+  /// \var is_spilling
+  ///   An indicator that determines if evicted results are spilled to a
+  ///   temporary file. If false, evicted results are recalculated.
+  bool is_spilling;
+
+  /// \var size_memory
+  ///   The memory budget for cached results, in megabytes.
+  int size_memory;
+};
+
+/// \par OVERVIEW
+///
+/// This struct has the options for the temperature sweep surrogate.
+struct SurrogateOptions {
+ public:
+  /// \var is_enabled
+  ///   An indicator that determines if temperature sweeps are interpolated
+  ///   with a surrogate. If false, every temperature is solved exactly.
+  bool is_enabled;
+
+  /// \var tolerance
+  ///   The relative error tolerance of the surrogate horizontal tension.
+  double tolerance;
+};
+
+/// \par OVERVIEW
+///
+/// This struct has the options for the analysis worker threads.
+struct ThreadOptions {
+ public:
+  /// \var is_background
+  ///   An indicator that determines if the worker threads run at the lowest
+  ///   priority, so an analysis doesn't slow down other applications.
+  bool is_background;
+
+  /// \var is_pinned
+  ///   An indicator that determines if each worker thread is pinned to a
+  ///   logical CPU.
+  bool is_pinned;
+
+  /// \var max_threads
+  ///   The maximum number of worker threads. If less than one, the number of
+  ///   available CPUs is used.
+  int max_threads;
+};
+
 /// \par OVERVIEW
 ///
 /// This struct stores the application configuration settings.
@@ -106,6 +157,10 @@ struct SpanAnalyzerConfig {
   ///   The log level of the application.
   wxLogLevelValues level_log;
 
+  /// \var options_cache_results
+  ///   The analysis result cache options.
+  ResultCacheOptions options_cache_results;
+
   /// \var options_plot_cable
   ///   The cable elongation model plot pane options.
   CablePlotOptions options_plot_cable;
@@ -118,6 +173,14 @@ struct SpanAnalyzerConfig {
   ///   The profile plot pane options.
   ProfilePlotOptions options_plot_profile;
 
+  /// \var options_surrogate
+  ///   The temperature sweep surrogate options.
+  SurrogateOptions options_surrogate;
+
+  /// \var options_threads
+  ///   The analysis worker thread options.
+  ThreadOptions options_threads;
+
   /// \var perspective
   ///   The AUI perspective, which is based on the user layout of panes. The
   ///   perspective is loaded/saved on application startup/exit, and modified
@@ -128,6 +191,10 @@ struct SpanAnalyzerConfig {
   ///   The main application frame size.
   wxSize size_frame;
 
+  /// \var size_memory_undo
+  ///   The memory budget for the undo history, in megabytes.
+  int size_memory_undo;
+
   /// \var units
   ///   The measurement unit system.
   units::UnitSystem units;
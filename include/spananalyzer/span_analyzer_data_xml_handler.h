@@ -11,12 +11,20 @@
 #include "wx/xml/xml.h"
 
 #include "spananalyzer/span_analyzer_data.h"
+#include "spananalyzer/xml_stream_writer.h"
 
 /// \par OVERVIEW
 ///
 /// This class parses and generates a span analyzer data XML node. The data is
 /// transferred between the XML node and the data object.
 ///
+/// \par STREAMING
+///
+/// The XML is written directly to a stream instead of being generated as a
+/// node, so a complete XML document is never held in memory. Child nodes that
+/// are generated by common XML handlers are created, written, and released
+/// one at a time.
+///
 /// \par VERSION
 ///
 /// This class can parse all versions of the XML node. However, new nodes will
@@ -28,18 +36,6 @@
 /// systems and styles.
 class SpanAnalyzerDataXmlHandler : public XmlHandler {
  public:
-  /// \brief Creates an XML node for a span analyzer data object.
-  /// \param[in] data
-  ///   The data.
-  /// \param[in] system_units
-  ///   The unit system, which is used for attributing child XML nodes.
-  /// \param[in] style_units
-  ///   The unit style, which is used for attributing child XML nodes.
-  /// \return An XML node for the document.
-  static wxXmlNode* CreateNode(const SpanAnalyzerData& data,
-                               const units::UnitSystem& system_units,
-                               const units::UnitStyle& style_units);
-
   /// \brief Parses an XML node and populates a data object.
   /// \param[in] root
   ///   The XML root node for the data.
@@ -62,6 +58,23 @@ class SpanAnalyzerDataXmlHandler : public XmlHandler {
                         const units::UnitSystem& units,
                         SpanAnalyzerData& data);
 
+  /// \brief Writes a span analyzer data XML node to a stream.
+  /// \param[in] data
+  ///   The data.
+  /// \param[in] system_units
+  ///   The unit system, which is used for attributing child XML nodes.
+  /// \param[in] style_units
+  ///   The unit style, which is used for attributing child XML nodes. The data
+  ///   must be in a 'consistent' unit style. If a 'different' unit style is
+  ///   requested, copies of the weathercases are converted as they are
+  ///   written, so the data is not modified.
+  /// \param[in] writer
+  ///   The stream writer.
+  static void WriteNode(const SpanAnalyzerData& data,
+                        const units::UnitSystem& system_units,
+                        const units::UnitStyle& style_units,
+                        XmlStreamWriter& writer);
+
  private:
   /// \brief Parses a version 1 XML node and populates a data object.
   /// \param[in] root
@@ -14,8 +14,11 @@
 #include "wx/docview.h"
 
 #include "spananalyzer/analysis_controller.h"
+#include "spananalyzer/document_journal.h"
 #include "spananalyzer/span.h"
+#include "spananalyzer/span_analyzer_config.h"
 #include "spananalyzer/span_analyzer_data.h"
+#include "spananalyzer/span_index.h"
 
 /// \par OVERVIEW
 ///
@@ -138,6 +141,19 @@ class UpdateHint : public wxObject {
 /// posted with the UpdateAllViews() method. Hints should be passed along to
 /// help the view update properly.
 ///
+/// \par BATCHES
+///
+/// Several span edits can be grouped into a batch with the BeginBatch() and
+/// EndBatch() methods. While a batch is open, the analysis of the activated
+/// span is deferred, and is performed once when the batch ends.
+///
+/// \par JOURNAL
+///
+/// Once the document has a file, every span edit is appended to a journal next
+/// to the file. If the document is opened and a journal exists, the user is
+/// asked if the unsaved edits should be recovered. The journal is removed when
+/// the document is saved or closed normally.
+///
 /// \par wxWIDGETS LIBRARY BUILD NOTE
 ///
 /// This class requires that the wxWidgets library deviate from the standard
@@ -161,6 +177,11 @@ class SpanAnalyzerDoc : public wxDocument {
   /// \return Success status.
   bool AppendSpan(const Span& span);
 
+  /// \brief Begins a batch of span edits.
+  /// The activated span isn't analyzed until the batch ends. Batches can be
+  /// nested, and only the outermost batch triggers an analysis.
+  void BeginBatch();
+
   /// \brief Gets the cable constraints that apply to the active span.
   /// \return The cable constraints for the active span.
   std::list<const CableConstraint*> Constraints() const;
@@ -193,6 +214,23 @@ class SpanAnalyzerDoc : public wxDocument {
   /// This function may trigger an update if it matches the selected span.
   bool DeleteSpan(const int& index);
 
+  /// \brief Saves the document to a file.
+  /// \param[in] file
+  ///   The filepath.
+  /// \return If the save was started.
+  /// This is called by the wxWidgets framework. A snapshot of the spans is
+  /// captured and written on a worker thread, so the document can keep being
+  /// edited while it is saved. If the save fails, the document is marked as
+  /// modified again and the error is shown when the save completes. The
+  /// journal is rotated, and the rotated journal is removed once the file is
+  /// written.
+  virtual bool DoSaveDocument(const wxString& file);
+
+  /// \brief Ends a batch of span edits.
+  /// If the activated span changed or was edited during the batch, it is
+  /// analyzed once.
+  void EndBatch();
+
   /// \brief Gets the filter group for the constraints.
   /// \return The filter group for the constraints.
   const AnalysisFilterGroup* FilterGroupConstraints() const;
@@ -211,12 +249,28 @@ class SpanAnalyzerDoc : public wxDocument {
   /// \return Success status.
   bool InsertSpan(const int& index, const Span& span);
 
+  /// \brief Determines if a cable is referenced by any span.
+  /// \param[in] cable
+  ///   The cable.
+  /// \return If the cable is referenced by any span.
+  bool IsReferenced(const Cable* cable) const;
+
+  /// \brief Determines if a weathercase is referenced by any span.
+  /// \param[in] weathercase
+  ///   The weathercase.
+  /// \return If the weathercase is referenced by any span.
+  bool IsReferenced(const WeatherLoadCase* weathercase) const;
+
   /// \brief Determines if the span name is unique.
   /// \param[in] name
   ///   The name to check.
   /// \return If the span name is unique.
   bool IsUniqueName(const std::string& name) const;
 
+  /// \brief Determines if a batch of span edits is open.
+  /// \return If a batch of span edits is open.
+  bool IsBatching() const;
+
   /// \brief Determines if the index is valid.
   /// \param[in] index
   ///   The list index.
@@ -249,6 +303,19 @@ class SpanAnalyzerDoc : public wxDocument {
   /// \return Success status.
   bool MoveSpan(const int& index_from, const int& index_to);
 
+  /// \brief Closes the document.
+  /// \return If the document is closed.
+  /// This is called by the wxWidgets framework once the user has saved or
+  /// discarded any changes. The journal is removed, unless the last save
+  /// failed and the user didn't discard the changes.
+  virtual bool OnCloseDocument();
+
+  /// \brief Creates the command processor.
+  /// \return A command processor that limits the undo history to the memory
+  ///   budget in the application config.
+  /// This is called by the wxWidgets framework.
+  virtual wxCommandProcessor* OnCreateCommandProcessor();
+
   /// \brief Initializes the document.
   /// \param[in] path
   ///   The document filepath.
@@ -260,24 +327,38 @@ class SpanAnalyzerDoc : public wxDocument {
   /// initialization constructor.
   virtual bool OnCreate(const wxString& path, long flags);
 
+  /// \brief Opens the document.
+  /// \param[in] filename
+  ///   The document filepath.
+  /// \return If the document is opened.
+  /// This is called by the wxWidgets framework. If a journal exists for the
+  /// file, the user is asked if the unsaved edits should be recovered. If the
+  /// document is opened silently or the application is headless, the user
+  /// isn't asked, and the journal is left for an interactive session.
+  virtual bool OnOpenDocument(const wxString& filename);
+
+  /// \brief Prompts the user to save any changes.
+  /// \return If the document can be closed.
+  /// This is called by the wxWidgets framework, and tracks if the user chose
+  /// to discard the changes.
+  virtual bool OnSaveModified();
+
   /// \brief Gets a set of filtered results.
   /// \param[in] index_weathercase
   ///   The weathercase index.
   /// \param[in] condition
   ///   The cable condition.
-  /// \return A single sag-tension result. If no results are available, a
-  ///   nullptr is returned.
-  const SagTensionAnalysisResult* Result(
-      const int& index_weathercase,
-      const CableConditionType& condition) const;
-
-  /// \brief Gets the sag-tension results for a specific condition.
-  /// \param[in] condition
-  ///   The cable condition.
-  /// \return The sag-tension results. If no results are available, a nullptr
-  ///   is returned.
-  const std::vector<SagTensionAnalysisResult>* Results(
-      const CableConditionType& condition) const;
+  /// \param[out] result
+  ///   The sag-tension result that is populated.
+  /// \return If a valid result is available.
+  bool Result(const int& index_weathercase,
+              const CableConditionType& condition,
+              SagTensionAnalysisResult& result) const;
+
+  /// \brief Gets the sag-tension results.
+  /// \return The sag-tension results, which are indexed by weathercase and
+  ///   condition.
+  const SagTensionResultStore* Results() const;
 
   /// \brief Runs the analysis.
   void RunAnalysis() const;
@@ -286,6 +367,8 @@ class SpanAnalyzerDoc : public wxDocument {
   /// \param[out] stream
   ///   The output stream generated by wxWidgets.
   /// \return The output stream.
+  /// The document is not modified while it is saved. DoSaveDocument() is used
+  /// for saving to a file.
   wxOutputStream& SaveObject(wxOutputStream& stream);
 
   /// \brief Gets the span activated for analysis.
@@ -293,6 +376,27 @@ class SpanAnalyzerDoc : public wxDocument {
   ///   returned.
   const Span* SpanActivated() const;
 
+  /// \brief Solves a temperature sweep of the activated span.
+  /// \param[in] weathercase
+  ///   The weathercase, which provides the load. The temperature is ignored.
+  /// \param[in] condition
+  ///   The reloaded condition.
+  /// \param[in] temperatures
+  ///   The temperatures.
+  /// \param[out] result
+  ///   The sweep result.
+  /// \return If the sweep was solved.
+  bool SolveTemperatureSweep(const WeatherLoadCase& weathercase,
+                             const CableConditionType& condition,
+                             const std::vector<double>& temperatures,
+                             TemperatureSweepResult& result) const;
+
+  /// \brief Gets the spans in the line section of the activated span.
+  /// \return The consecutive ruling spans around the activated span that have
+  ///   an identical line cable, in document order. A dead-end span is its own
+  ///   line section. If no span is activated, an empty list is returned.
+  std::vector<const Span*> SpansLineSection() const;
+
   /// \brief Gets the analysis stretch state for the specified condition.
   /// \param[in] condition
   ///   The condition.
@@ -300,16 +404,56 @@ class SpanAnalyzerDoc : public wxDocument {
   ///   is available, a nullptr is returned.
   const CableStretchState* StretchState(const CableConditionType& condition);
 
+  /// \brief Gets the compiled cable model cache.
+  /// \return The compiled cable model cache, which is shared with the solvers
+  ///   and views.
+  CableModelCache* cache_models() const;
+
+  /// \brief Gets the suspension insulator that connects the spans in a line
+  ///   section.
+  /// \return The suspension insulator.
+  const Hardware* hardware_suspension() const;
+
   /// \brief Gets activated span index.
   /// \return The activated span index. If no span is activated, -1 is returned.
   int index_activated() const;
 
+  /// \brief Gets the maximum number of analysis threads.
+  /// \return The maximum number of analysis threads.
+  int max_threads_analysis() const;
+
   /// \brief Sets the index of the activated span.
   /// \param[in] index
   ///   The span index to activate. To deactivate a span, set to -1.
   /// \return If the span index has been activated/deactivated.
   bool set_index_activated(const int& index);
 
+  /// \brief Sets the maximum number of analysis threads.
+  /// \param[in] max_threads
+  ///   The maximum number of threads. If less than one, the number of
+  ///   available CPUs is used.
+  void set_max_threads_analysis(const int& max_threads);
+
+  /// \brief Sets the analysis result cache options.
+  /// \param[in] options
+  ///   The result cache options.
+  void set_options_cache_results(const ResultCacheOptions& options);
+
+  /// \brief Sets the temperature sweep surrogate options.
+  /// \param[in] options
+  ///   The surrogate options.
+  void set_options_surrogate(const SurrogateOptions& options);
+
+  /// \brief Sets the analysis thread options.
+  /// \param[in] options
+  ///   The thread options.
+  void set_options_threads(const ThreadOptions& options);
+
+  /// \brief Sets the memory budget for the undo history.
+  /// \param[in] size_memory
+  ///   The memory budget, in megabytes.
+  void set_size_memory_undo(const int& size_memory);
+
   /// \brief Gets the spans.
   /// \return The spans.
   const std::list<Span>& spans() const;
@@ -321,6 +465,11 @@ class SpanAnalyzerDoc : public wxDocument {
   /// \brief Disconnects the activated line cable from the line structures.
   void DisconnectLineCableActivated();
 
+  /// \brief Handles a completed background save.
+  /// \param[in] event
+  ///   The event, which has the save status and filepath.
+  void OnSaveComplete(wxThreadEvent& event);
+
   /// \brief Updates the analysis controller with the activated span index.
   void SyncAnalysisController();
 
@@ -331,6 +480,10 @@ class SpanAnalyzerDoc : public wxDocument {
   ///   The analysis controller, which generates sag-tension results.
   mutable AnalysisController controller_analysis_;
 
+  /// \var count_batch_
+  ///   The number of batches that are open.
+  int count_batch_;
+
   /// \var group_filters_constraint_
   ///   The analysis filters for the applicable constraints.
   mutable AnalysisFilterGroup group_filters_constraint_;
@@ -342,11 +495,41 @@ class SpanAnalyzerDoc : public wxDocument {
   ///   data.
   Hardware hardware_;
 
+  /// \var hardware_suspension_
+  ///   The suspension insulator that connects the spans in a line section.
+  ///   This is a placeholder with typical properties, and is not presented to
+  ///   the user or saved with the rest of the document data.
+  Hardware hardware_suspension_;
+
   /// \var index_activated_
   ///   The index of the span that is activated for analysis. If no span is
   ///   activated, this should be set to -1.
   int index_activated_;
 
+  /// \var index_spans_
+  ///   The index of span names and references. This is updated with every
+  ///   span edit so lookups don't have to scan the spans.
+  SpanIndex index_spans_;
+
+  /// \var is_discarded_
+  ///   An indicator that tells if the user chose to discard the changes when
+  ///   the document was closed.
+  bool is_discarded_;
+
+  /// \var is_pending_analysis_
+  ///   An indicator that tells if the activated span needs to be analyzed when
+  ///   the batch ends.
+  bool is_pending_analysis_;
+
+  /// \var is_silent_
+  ///   An indicator that tells if the document was created silently, in which
+  ///   case no dialogs are shown when it is opened.
+  bool is_silent_;
+
+  /// \var journal_
+  ///   The journal of span edits that haven't been saved.
+  DocumentJournal journal_;
+
   /// \var line_structures_
   ///   The line structures that the span connects to. These help suppress
   ///   validation errors related to the line cable not being connected to
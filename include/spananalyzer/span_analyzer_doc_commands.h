@@ -4,14 +4,103 @@
 #ifndef SPANANALYZER_SPAN_ANALYZER_DOC_COMMANDS_H_
 #define SPANANALYZER_SPAN_ANALYZER_DOC_COMMANDS_H_
 
+#include <list>
+#include <map>
 #include <string>
 
 #include "wx/cmdproc.h"
-#include "wx/xml/xml.h"
 
-#include "spananalyzer/span_analyzer_data.h"
+#include "spananalyzer/data_index.h"
+#include "spananalyzer/span.h"
 #include "spananalyzer/span_analyzer_doc.h"
 
+/// \par OVERVIEW
+///
+/// This class is a compact copy of a span that is stored by a command.
+///
+/// \par REFERENCES
+///
+/// The copy captures the names of the cable and weathercases, so a span can be
+/// restored without parsing. The application data can be edited while a
+/// command is in the undo history, and the memory of a deleted item can be
+/// reused by a new one, so the captured handles are never trusted. The
+/// references are resolved by name through the application data index when
+/// the span is restored.
+///
+/// \par CONNECTIONS
+///
+/// Line cable connections are not captured.
+class SpanState {
+ public:
+  /// \brief Constructor.
+  SpanState();
+
+  /// \brief Captures a span.
+  /// \param[in] span
+  ///   The span.
+  void Capture(const Span& span);
+
+  /// \brief Restores the span.
+  /// \param[in] index
+  ///   The application data index, which the cable and weathercase names are
+  ///   resolved with.
+  /// \param[out] span
+  ///   The span that is populated.
+  /// \return If all of the span references were resolved.
+  bool Restore(const DataIndex& index, Span& span) const;
+
+  /// \brief Gets the approximate memory used by the state.
+  /// \return The memory size, in bytes.
+  size_t Size() const;
+
+ private:
+  /// \brief Resolves a cable handle.
+  /// \param[in] index
+  ///   The application data index.
+  /// \param[in] cable
+  ///   The captured cable handle, which is only checked for a nullptr.
+  /// \param[in] name
+  ///   The captured cable name.
+  /// \return The cable. If the cable can't be resolved, a nullptr is returned.
+  static const Cable* ResolveCable(const DataIndex& index,
+                                   const Cable* cable,
+                                   const std::string& name);
+
+  /// \brief Resolves a weathercase handle.
+  /// \param[in] index
+  ///   The application data index.
+  /// \param[in] weathercase
+  ///   The captured weathercase handle, which is only checked for a nullptr.
+  /// \param[in] description
+  ///   The captured weathercase description.
+  /// \return The weathercase. If the weathercase can't be resolved, a nullptr
+  ///   is returned.
+  static const WeatherLoadCase* ResolveWeathercase(
+      const DataIndex& index,
+      const WeatherLoadCase* weathercase,
+      const std::string& description);
+
+  /// \var description_constraint_
+  ///   The description of the constraint weathercase.
+  std::string description_constraint_;
+
+  /// \var description_creep_
+  ///   The description of the stretch creep weathercase.
+  std::string description_creep_;
+
+  /// \var description_load_
+  ///   The description of the stretch load weathercase.
+  std::string description_load_;
+
+  /// \var name_cable_
+  ///   The cable name.
+  std::string name_cable_;
+
+  /// \var span_
+  ///   The span copy.
+  Span span_;
+};
+
 /// \par OVERVIEW
 ///
 /// This class is a command that modifies spans in the SpanAnalyzerDoc.
@@ -21,16 +110,18 @@
 /// The command must be initialized with one of the declared names, as it will
 /// determine what kind of action is to be performed.
 ///
-/// \par SPAN XML NODES
+/// \par SPAN STATES
 ///
-/// This command stores span xml nodes. This is done so the command can be
-/// applied even if the application data pointers become invalid. Not having
-/// to keep memory references valid removes a whole set of potential problems.
+/// This command stores compact span copies. Up to two states are stored. One
+/// of the states will be committed to the document on a 'do' method, while the
+/// other will be committed to the document on an 'undo' method. These states
+/// may not be needed for all command types, and will be left empty if not
+/// used.
 ///
-/// Up to two nodes are stored. One of the nodes will be committed to the
-/// document on a 'do' method, while the other will be committed to the document
-/// on an 'undo' method. These nodes may not be needed for all command types,
-/// and will be kept as a nullptr if not used.
+/// \par VIEW UPDATES
+///
+/// A view update is posted after the command is done or undone, unless the
+/// document has a batch open. The batch command posts a single update instead.
 class SpanCommand : public wxCommand {
  public:
   /// \var kNameDelete
@@ -61,24 +152,13 @@ class SpanCommand : public wxCommand {
   /// \brief Destructor.
   virtual ~SpanCommand();
 
-  /// \brief Creates a span from an xml node.
-  /// \param[in] node
-  ///   The xml node.
-  /// \param[out] span
-  ///   The span to populate.
-  /// \return Success status.
-  /// The span will be created with valid references to the application data.
-  static bool CreateSpanFromXml(const wxXmlNode* node, Span& span);
-
   /// \brief Does the command.
   /// \return True if the action has taken place, false otherwise.
   virtual bool Do();
 
-  /// \brief Saves the span to an xml node.
-  /// \param[in] span
-  ///   The span.
-  /// \return An xml node for the span.
-  static wxXmlNode* SaveSpanToXml(const Span& span);
+  /// \brief Gets the approximate memory used by the command.
+  /// \return The memory size, in bytes.
+  size_t Size() const;
 
   /// \brief Undoes the command.
   /// \return True if the action has taken place, false otherwise.
@@ -88,19 +168,15 @@ class SpanCommand : public wxCommand {
   /// \return The index.
   int index() const;
 
-  /// \brief Gets the span xml node.
-  /// \return The span xml node.
-  const wxXmlNode* node_span() const;
-
   /// \brief Sets the index.
   /// \param[in] index
   ///   The index.
   void set_index(const int& index);
 
-  /// \brief Sets the span xml node.
-  /// \param[in] node_span
-  ///   The span xml node.
-  void set_node_span(const wxXmlNode* node_span);
+  /// \brief Sets the span that is committed on a 'do' method.
+  /// \param[in] span
+  ///   The span, which is copied.
+  void set_span(const Span& span);
 
  private:
   /// \brief Does the delete span command.
@@ -108,16 +184,16 @@ class SpanCommand : public wxCommand {
   bool DoDelete();
 
   /// \brief Does the insert span command.
-  /// \param[in] node
-  ///   The xml node of the span.
+  /// \param[in] state
+  ///   The span state.
   /// \return The success status.
-  bool DoInsert(const wxXmlNode* node);
+  bool DoInsert(const SpanState& state);
 
   /// \brief Does the modify span command.
-  /// \param[in] node
-  ///   The xml node of the span.
+  /// \param[in] state
+  ///   The span state.
   /// \return The success status.
-  bool DoModify(const wxXmlNode* node);
+  bool DoModify(const SpanState& state);
 
   /// \brief Does the move span down command.
   /// \return The success status.
@@ -136,16 +212,144 @@ class SpanCommand : public wxCommand {
   ///   at this index.
   int index_;
 
-  /// \var node_do_
-  ///   The Span xml node that is committed to the document on a do operation.
-  ///   This command owns the node.
-  const wxXmlNode* node_do_;
+  /// \var state_do_
+  ///   The span state that is committed to the document on a do operation.
+  SpanState state_do_;
+
+  /// \var state_undo_
+  ///   The span state that is committed to the document on an undo operation.
+  ///   It contains the state of the span in the document before any edits
+  ///   occur.
+  SpanState state_undo_;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a command that applies several span commands as a single
+/// undoable unit.
+///
+/// \par TRANSACTION
+///
+/// The span commands are done in order, and undone in reverse order. If any
+/// span command fails, the commands that were already applied are reverted so
+/// the document is left unchanged.
+///
+/// \par UPDATES
+///
+/// The span commands are applied inside a document batch, so the activated
+/// span is analyzed at most once. A single view update is posted, which
+/// rebuilds the span list instead of updating it item by item.
+class SpanBatchCommand : public wxCommand {
+ public:
+  /// \brief Constructor.
+  /// \param[in] name
+  ///   The command name, which is displayed in the undo/redo menu.
+  SpanBatchCommand(const std::string& name);
+
+  /// \brief Destructor.
+  /// The span commands are deleted.
+  virtual ~SpanBatchCommand();
+
+  /// \brief Adds a span command to the end of the batch.
+  /// \param[in] command
+  ///   The span command, which the batch takes ownership of. The index of the
+  ///   command must be valid after all of the previous commands are applied.
+  void Add(SpanCommand* command);
+
+  /// \brief Does the command.
+  /// \return True if the action has taken place, false otherwise.
+  virtual bool Do();
+
+  /// \brief Determines if the batch has any span commands.
+  /// \return If the batch has any span commands.
+  bool IsEmpty() const;
+
+  /// \brief Gets the approximate memory used by the command.
+  /// \return The memory size, in bytes.
+  size_t Size() const;
+
+  /// \brief Undoes the command.
+  /// \return True if the action has taken place, false otherwise.
+  virtual bool Undo();
+
+ private:
+  /// \brief Posts a single view update for the batch.
+  void UpdateViews();
+
+  /// \var commands_
+  ///   The span commands, in the order they are done.
+  std::list<SpanCommand*> commands_;
+
+  /// \var doc_
+  ///   The document.
+  SpanAnalyzerDoc* doc_;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a command processor that limits the undo history to a memory
+/// budget.
+///
+/// \par MEMORY BUDGET
+///
+/// When a command is stored and the history exceeds the memory budget, the
+/// oldest commands are discarded. The most recent command is always kept, so
+/// it can be undone.
+///
+/// The size of each command is recorded when it is stored, and a running total
+/// is kept as commands are stored, discarded, and cleared. This keeps storing
+/// a command independent of the history length.
+class SpanCommandProcessor : public wxCommandProcessor {
+ public:
+  /// \brief Constructor.
+  /// \param[in] size_memory
+  ///   The memory budget, in megabytes.
+  SpanCommandProcessor(const int& size_memory);
+
+  /// \brief Clears all stored commands.
+  virtual void ClearCommands();
+
+  /// \brief Gets the approximate memory used by the stored commands.
+  /// \return The memory size, in bytes.
+  size_t SizeCommands() const;
+
+  /// \brief Stores a command and trims the history to the memory budget.
+  /// \param[in] command
+  ///   The command.
+  virtual void Store(wxCommand* command);
+
+  /// \brief Sets the memory budget.
+  /// \param[in] size_memory
+  ///   The memory budget, in megabytes.
+  void set_size_memory(const int& size_memory);
+
+ private:
+  /// \brief Discards the commands after the current command, which can no
+  ///   longer be redone once a new command is stored.
+  void DiscardRedo();
+
+  /// \brief Gets the approximate memory used by a command.
+  /// \param[in] command
+  ///   The command.
+  /// \return The memory size, in bytes.
+  static size_t SizeCommand(const wxCommand* command);
+
+  /// \brief Discards the oldest commands until the history fits the memory
+  ///   budget.
+  void Trim();
+
+  /// \var size_commands_
+  ///   The approximate memory used by the stored commands, in bytes.
+  size_t size_commands_;
+
+  /// \var size_memory_
+  ///   The memory budget, in bytes.
+  size_t size_memory_;
 
-  /// \var node_undo_
-  ///   The span xml node that is committed to the document on an undo
-  ///   operation. It contains the state of the span in the document before any
-  /// edits occur. This command owns the node.
-  const wxXmlNode* node_undo_;
+  /// \var sizes_
+  ///   The size of each stored command, as recorded when it was stored. This is
+  ///   kept because a command's size can change when it is redone.
+  std::map<const wxCommand*, size_t> sizes_;
 };
 
 #endif  // SPANANALYZER_SPAN_ANALYZER_DOC_COMMANDS_H_
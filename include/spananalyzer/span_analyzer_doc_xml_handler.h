@@ -12,6 +12,7 @@
 
 #include "spananalyzer/span_analyzer_data.h"
 #include "spananalyzer/span_analyzer_doc.h"
+#include "spananalyzer/xml_stream_writer.h"
 
 /// \par OVERVIEW
 ///
@@ -34,16 +35,25 @@
 ///
 /// This class supports attributing the child XML nodes for various unit
 /// systems.
+///
+/// \par STREAMING
+///
+/// The XML is written directly to a stream instead of being generated as a
+/// node, so memory use doesn't grow with the number of spans that are saved.
+///
+/// \par SPAN RANGES
+///
+/// The spans can be counted, and a range of spans can be parsed into a list
+/// without a document. Spans outside of the range aren't parsed, which allows
+/// a large document to be split into shards that are analyzed separately.
 class SpanAnalyzerDocXmlHandler : public XmlHandler {
  public:
-  /// \brief Creates an XML node for a span analyzer document.
-  /// \param[in] doc
-  ///   The document.
-  /// \param[in] units
-  ///   The unit system, which is used for attributing child XML nodes.
-  /// \return An XML node for the document.
-  static wxXmlNode* CreateNode(const SpanAnalyzerDoc& doc,
-                               const units::UnitSystem& units);
+  /// \brief Counts the spans in an XML node.
+  /// \param[in] root
+  ///   The XML root node for the document.
+  /// \return The number of spans. If the root node isn't a valid document
+  ///   node, -1 is returned.
+  static int CountSpans(const wxXmlNode* root);
 
   /// \brief Parses an XML node and populates a document.
   /// \param[in] root
@@ -77,6 +87,57 @@ class SpanAnalyzerDocXmlHandler : public XmlHandler {
                         const std::list<WeatherLoadCase*>* weathercases,
                         SpanAnalyzerDoc& doc);
 
+  /// \brief Parses a range of spans from an XML node.
+  /// \param[in] root
+  ///   The XML root node for the document.
+  /// \param[in] filepath
+  ///   The filepath that the xml node was loaded from. This is for logging
+  ///   purposes only and can be left blank.
+  /// \param[in] units
+  ///   The unit system. If no conversion is being done this will be ignored.
+  /// \param[in] convert
+  ///   A flag that determines if the unit style is converted to 'consistent'.
+  /// \param[in] cablefiles
+  ///   A list of cables files that is matched against a cable description. If
+  ///   found, a pointer will be set to the matching cable.
+  /// \param[in] weathercases
+  ///   A list of weathercases that is matched against a weathercase
+  ///   description. If found, a pointer will be set to the matching
+  ///   weathercase.
+  /// \param[in] index_begin
+  ///   The index of the first span to parse.
+  /// \param[in] index_end
+  ///   The index after the last span to parse.
+  /// \param[out] spans
+  ///   The spans that are populated, in document order.
+  /// \return The status of the xml node parse. If any errors are encountered
+  ///   false is returned.
+  /// All errors are logged to the active application log target. Critical
+  /// errors cause the parsing to abort. Non-critical errors set the object
+  /// property to an invalid state (if applicable).
+  static bool ParseSpans(const wxXmlNode* root,
+                         const std::string& filepath,
+                         const units::UnitSystem& units,
+                         const bool& convert,
+                         const std::list<CableFile*>* cablefiles,
+                         const std::list<WeatherLoadCase*>* weathercases,
+                         const int& index_begin,
+                         const int& index_end,
+                         std::list<Span>& spans);
+
+  /// \brief Writes a span analyzer document XML node to a stream.
+  /// \param[in] spans
+  ///   The document spans, in a 'consistent' unit style.
+  /// \param[in] units
+  ///   The unit system, which is used for attributing child XML nodes.
+  /// \param[in] writer
+  ///   The stream writer.
+  /// Each span is copied, disconnected, and converted to a 'different' unit
+  /// style as it is written, so the spans are not modified.
+  static void WriteNode(const std::list<Span>& spans,
+                        const units::UnitSystem& units,
+                        XmlStreamWriter& writer);
+
  private:
   /// \brief Parses a version 1 XML node and populates a document.
   /// \param[in] root
@@ -54,6 +54,12 @@ class SpanAnalyzerFrame : public wxDocParentFrame {
   /// \brief Destructor.
   virtual ~SpanAnalyzerFrame();
 
+  /// \brief Handles the idle event.
+  /// \param[in] event
+  ///   The event.
+  /// Any view updates that were posted while processing events are flushed.
+  void OnIdle(wxIdleEvent& event);
+
   /// \brief Handles the edit->analysis filters menu click event.
   /// \param[in] event
   ///   The event.
@@ -5,6 +5,9 @@
 #define SPANANALYZER_SPAN_ANALYZER_VIEW_H_
 
 #include <list>
+#include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "wx/docview.h"
 #include "wx/notebook.h"
@@ -15,11 +18,36 @@
 #include "spananalyzer/profile_plot_pane.h"
 #include "spananalyzer/results_pane.h"
 #include "spananalyzer/span_analyzer_data.h"
+#include "spananalyzer/span_analyzer_doc.h"
 
 /// \par OVERVIEW
 ///
 /// This is the SpanAnalyzer application view, which is responsible for
 /// displaying information and results from the SpanAnalyzerDoc.
+///
+/// \par UPDATES
+///
+/// The edit pane is updated as soon as an update is posted, because its span
+/// items are updated incrementally and edit actions select the new items right
+/// away.
+///
+/// Updates for the results and plot panes are accumulated, and flushed once
+/// when the application is idle. A single user action often posts several
+/// updates (ex: an analysis, a constraint filter update, and a selection
+/// change), which would otherwise rebuild the pane datasets each time. The
+/// pending update types are coalesced into the single update that covers all
+/// of them.
+///
+/// Panes that aren't shown on screen, such as hidden notebook pages and hidden
+/// AUI panes, keep their pending updates until they are shown.
+///
+/// \par WEATHERCASE INDEXES
+///
+/// Document results are stored by the index of the weathercase in the
+/// application data. The view keeps a table of weathercase indexes, which is
+/// rebuilt when the weathercases are edited, and resolves the filters of the
+/// active filter group to weathercase indexes whenever the filters may have
+/// changed. This keeps the result lookups for a filter group linear.
 class SpanAnalyzerView : public wxView {
  public:
   /// \par OVERVIEW
@@ -42,6 +70,12 @@ class SpanAnalyzerView : public wxView {
   ///   a nullptr is returned.
   const AnalysisFilter* AnalysisFilterActive() const;
 
+  /// \brief Flushes the pending pane updates.
+  /// \param[in] is_forced
+  ///   An indicator that tells if panes that aren't shown on screen are also
+  ///   updated. Otherwise they are skipped, and keep their pending updates.
+  void FlushUpdates(const bool& is_forced);
+
   /// \brief Gets the graphics plot rect.
   /// \return The graphics plot rect.
   wxRect GraphicsPlotRect() const;
@@ -49,7 +83,8 @@ class SpanAnalyzerView : public wxView {
   /// \brief Gets the weathercase index for the filter.
   /// \param[in] filter
   ///   The analysis filter.
-  /// \return The weathercase index.
+  /// \return The weathercase index. If the weathercase isn't in the
+  ///   application data, -1 is returned.
   int IndexWeathercase(const AnalysisFilter& filter) const;
 
   /// \brief Handles closing the view.
@@ -100,9 +135,15 @@ class SpanAnalyzerView : public wxView {
   /// \param[in] hint
   ///   The update hint that helps child windows optimize the update. This is
   ///   provided by the function/action that triggered the update.
-  /// This function is called by wxWidgets.
+  /// This function is called by wxWidgets. The edit pane is updated
+  /// immediately, and the other panes are updated when the application is
+  /// idle.
   virtual void OnUpdate(wxView *sender, wxObject *hint = nullptr);
 
+  /// \brief Gets the number of pane updates that were avoided by coalescing.
+  /// \return The number of pane updates that were avoided.
+  int count_updates_avoided() const;
+
   /// \brief Gets the activated analysis filter group.
   /// \return The activated analysis filter group. If no analysis filter group
   ///   is activated, a nullptr is returned.
@@ -112,6 +153,11 @@ class SpanAnalyzerView : public wxView {
   /// \return The selected filter index.
   const int index_filter() const;
 
+  /// \brief Gets the weathercase indexes for the filter group.
+  /// \return The weathercase indexes, in the same order as the filters in the
+  ///   active filter group.
+  const std::vector<int>& indexes_weathercases_filters() const;
+
   /// \brief Gets the cable model pane.
   /// \return The cable model pane.
   CablePlotPane* pane_cable();
@@ -148,6 +194,64 @@ class SpanAnalyzerView : public wxView {
   RenderTarget target_render() const;
 
  private:
+  /// \par OVERVIEW
+  ///
+  /// This struct contains the updates that are pending for a pane.
+  struct PendingUpdates {
+    /// \var count
+    ///   The number of updates that have been posted since the last flush.
+    int count;
+
+    /// \var types
+    ///   The hint types that have been posted since the last flush. A null
+    ///   hint is stored as a null type.
+    std::set<UpdateHint::Type> types;
+  };
+
+  /// \brief Coalesces pending hint types into a single hint type.
+  /// \param[in] types
+  ///   The pending hint types.
+  /// \return The hint type that covers all of the pending types.
+  static UpdateHint::Type CoalesceUpdates(
+      const std::set<UpdateHint::Type>& types);
+
+  /// \brief Flushes the pending updates for a pane.
+  /// \param[in] pane
+  ///   The pane.
+  /// \param[in,out] pending
+  ///   The pending updates, which are cleared if the pane is updated.
+  /// \param[in] is_forced
+  ///   An indicator that tells if the pane is updated even if it isn't shown
+  ///   on screen.
+  /// \return The number of updates that were avoided.
+  int FlushPane(wxWindow* pane, PendingUpdates& pending,
+                const bool& is_forced);
+
+  /// \brief Posts an update to a pane.
+  /// \param[in] hint
+  ///   The update hint.
+  /// \param[in,out] pending
+  ///   The pending updates for the pane.
+  static void PostUpdate(const wxObject* hint, PendingUpdates& pending);
+
+  /// \brief Updates a pane.
+  /// \param[in] pane
+  ///   The pane.
+  /// \param[in] hint
+  ///   The update hint.
+  void UpdatePane(wxWindow* pane, wxObject* hint);
+
+  /// \brief Updates the weathercase indexes for the active filter group.
+  void UpdateIndexesFilters();
+
+  /// \brief Updates the weathercase index table from the application data.
+  /// The filter group indexes are updated as well.
+  void UpdateIndexesWeathercases();
+
+  /// \var count_updates_avoided_
+  ///   The number of pane updates that were avoided by coalescing.
+  int count_updates_avoided_;
+
   /// \var group_filters_
   ///   The group of filters that is currently activated.
   const AnalysisFilterGroup* group_filters_;
@@ -156,6 +260,14 @@ class SpanAnalyzerView : public wxView {
   ///   The filter index that is currently selected.
   int index_filter_;
 
+  /// \var indexes_weathercases_
+  ///   The application data weathercase indexes, keyed by weathercase.
+  std::unordered_map<const WeatherLoadCase*, int> indexes_weathercases_;
+
+  /// \var indexes_weathercases_filters_
+  ///   The weathercase indexes for the active filter group, in filter order.
+  std::vector<int> indexes_weathercases_filters_;
+
   /// \var notebook_plot_
   ///   The notebook that contains the plots.
   wxNotebook* notebook_plot_;
@@ -180,6 +292,22 @@ class SpanAnalyzerView : public wxView {
   ///   The results pane.
   ResultsPane* pane_results_;
 
+  /// \var pending_cable_
+  ///   The pending updates for the cable plot pane.
+  PendingUpdates pending_cable_;
+
+  /// \var pending_plan_
+  ///   The pending updates for the plan plot pane.
+  PendingUpdates pending_plan_;
+
+  /// \var pending_profile_
+  ///   The pending updates for the profile plot pane.
+  PendingUpdates pending_profile_;
+
+  /// \var pending_results_
+  ///   The pending updates for the results pane.
+  PendingUpdates pending_results_;
+
   /// \var target_render_
   ///   The render target.
   RenderTarget target_render_;
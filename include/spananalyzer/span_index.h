@@ -0,0 +1,97 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_SPAN_INDEX_H_
+#define SPANANALYZER_SPAN_INDEX_H_
+
+#include <string>
+#include <unordered_map>
+
+#include "models/transmissionline/cable.h"
+#include "models/transmissionline/weather_load_case.h"
+
+#include "spananalyzer/span.h"
+
+/// \par OVERVIEW
+///
+/// This class indexes the names and references of a set of spans, so they can
+/// be looked up without scanning the spans.
+///
+/// \par NAMES
+///
+/// Span names are counted with a hash map. Spans aren't required to have
+/// unique names, so a name is only removed from the index when the last span
+/// with the name is removed.
+///
+/// \par REFERENCES
+///
+/// The cables and weathercases that the spans reference are counted with hash
+/// maps keyed by address. A span that references the same weathercase more
+/// than once is counted once per reference.
+///
+/// \par UPDATES
+///
+/// The index doesn't hold the spans. Every span that is added must be removed
+/// with the same names and references, so a span has to be removed before it
+/// is modified and added again afterwards.
+class SpanIndex {
+ public:
+  /// \brief Constructor.
+  SpanIndex();
+
+  /// \brief Adds a span.
+  /// \param[in] span
+  ///   The span.
+  void Add(const Span& span);
+
+  /// \brief Clears the index.
+  void Clear();
+
+  /// \brief Determines if a span name is in the index.
+  /// \param[in] name
+  ///   The span name.
+  /// \return If a span with the name is in the index.
+  bool ContainsName(const std::string& name) const;
+
+  /// \brief Gets the number of references to a cable.
+  /// \param[in] cable
+  ///   The cable.
+  /// \return The number of references to the cable.
+  int CountReferences(const Cable* cable) const;
+
+  /// \brief Gets the number of references to a weathercase.
+  /// \param[in] weathercase
+  ///   The weathercase.
+  /// \return The number of references to the weathercase.
+  int CountReferences(const WeatherLoadCase* weathercase) const;
+
+  /// \brief Removes a span.
+  /// \param[in] span
+  ///   The span, which must have been added with the same name and references.
+  void Remove(const Span& span);
+
+ private:
+  /// \brief Decrements a count, and erases the key when it reaches zero.
+  /// \param[in] key
+  ///   The key.
+  /// \param[in,out] counts
+  ///   The counts.
+  template<typename T>
+  static void Decrement(
+      const typename std::unordered_map<T, int>::key_type& key,
+      std::unordered_map<T, int>& counts);
+
+  /// \var names_
+  ///   The span name counts.
+  std::unordered_map<std::string, int> names_;
+
+  /// \var references_cables_
+  ///   The cable reference counts.
+  std::unordered_map<const Cable*, int> references_cables_;
+
+  /// \var references_weathercases_
+  ///   The weathercase reference counts.
+  std::unordered_map<const WeatherLoadCase*, int> references_weathercases_;
+};
+
+#endif  // SPANANALYZER_SPAN_INDEX_H_
@@ -0,0 +1,143 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_SPAN_LIST_CTRL_H_
+#define SPANANALYZER_SPAN_LIST_CTRL_H_
+
+#include <list>
+#include <vector>
+
+#include "wx/listctrl.h"
+
+#include "spananalyzer/span.h"
+
+/// \par OVERVIEW
+///
+/// This class is a virtual list control that displays the document spans.
+///
+/// \par VIRTUAL ROWS
+///
+/// The control doesn't create an item for each span. The text and style of a
+/// row are only requested when the row is drawn, so the cost of displaying a
+/// document depends on the number of visible rows and not the number of spans.
+///
+/// \par ROW INDEX
+///
+/// The control keeps an iterator to each span, in the same order as the
+/// document. This maps a row to a span in constant time, which the document
+/// span list doesn't provide. The row index is updated incrementally as spans
+/// are inserted, deleted, modified, and moved, and is only rebuilt when the
+/// entire document changes.
+///
+/// \par BOLD ROW
+///
+/// The row of the activated span is displayed in bold.
+class SpanListCtrl : public wxListCtrl {
+ public:
+  /// \brief Constructor.
+  /// \param[in] parent
+  ///   The parent window.
+  SpanListCtrl(wxWindow* parent);
+
+  /// \brief Destructor.
+  ~SpanListCtrl();
+
+  /// \brief Deletes a row.
+  /// \param[in] index
+  ///   The row index.
+  void DeleteRow(const int& index);
+
+  /// \brief Inserts a row for a span that was inserted into the document.
+  /// \param[in] index
+  ///   The row index, which matches the span index.
+  /// \param[in] spans
+  ///   The document spans, which already contain the inserted span.
+  void InsertRow(const int& index, const std::list<Span>& spans);
+
+  /// \brief Determines if the row index is valid.
+  /// \param[in] index
+  ///   The row index.
+  /// \return If the row index is valid.
+  bool IsValidRow(const int& index) const;
+
+  /// \brief Rebuilds all of the rows.
+  /// \param[in] spans
+  ///   The document spans.
+  void RebuildRows(const std::list<Span>& spans);
+
+  /// \brief Redraws a row.
+  /// \param[in] index
+  ///   The row index.
+  void RefreshRow(const int& index);
+
+  /// \brief Gets the selected row.
+  /// \return The selected row index. If no row is selected, -1 is returned.
+  int RowSelected() const;
+
+  /// \brief Selects and focuses a row, and scrolls it into view.
+  /// \param[in] index
+  ///   The row index.
+  void SelectRow(const int& index);
+
+  /// \brief Gets the span for a row.
+  /// \param[in] index
+  ///   The row index.
+  /// \return The span. If the row index is invalid, a nullptr is returned.
+  const Span* SpanRow(const int& index) const;
+
+  /// \brief Swaps two rows.
+  /// \param[in] index_a
+  ///   The first row index.
+  /// \param[in] index_b
+  ///   The second row index.
+  void SwapRows(const int& index_a, const int& index_b);
+
+  /// \brief Gets the bold row index.
+  /// \return The bold row index. If no row is bold, -1 is returned.
+  int index_bold() const;
+
+  /// \brief Sets the bold row index.
+  /// \param[in] index
+  ///   The bold row index. If no row is bold, -1 should be used.
+  void set_index_bold(const int& index);
+
+ protected:
+  /// \brief Gets the style for a row.
+  /// \param[in] item
+  ///   The row index.
+  /// \return The row style, or a nullptr for the default style.
+  /// This function is called by wxWidgets when a row is drawn.
+  virtual wxListItemAttr* OnGetItemAttr(long item) const;
+
+  /// \brief Gets the text for a row.
+  /// \param[in] item
+  ///   The row index.
+  /// \param[in] column
+  ///   The column index.
+  /// \return The row text.
+  /// This function is called by wxWidgets when a row is drawn.
+  virtual wxString OnGetItemText(long item, long column) const;
+
+ private:
+  /// \brief Handles the resize event.
+  /// \param[in] event
+  ///   The event.
+  /// The column is sized to fill the control.
+  void OnSize(wxSizeEvent& event);
+
+  /// \var attr_bold_
+  ///   The style for the bold row.
+  mutable wxListItemAttr attr_bold_;
+
+  /// \var index_bold_
+  ///   The bold row index.
+  int index_bold_;
+
+  /// \var rows_
+  ///   The iterators to the document spans, in row order.
+  std::vector<std::list<Span>::const_iterator> rows_;
+
+  DECLARE_EVENT_TABLE()
+};
+
+#endif  // SPANANALYZER_SPAN_LIST_CTRL_H_
@@ -55,6 +55,7 @@ class SpanUnitConverter {
   ///   The span to be converted.
   /// The 'different' style units are as follows:
   ///  - spacing_attachments = [m or ft]
+  ///  - profile = [m or ft]
   static void ConvertUnitStyleToDifferent(const units::UnitSystem& system,
                                           const bool& is_recursive,
                                           Span& span);
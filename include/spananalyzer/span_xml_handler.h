@@ -6,6 +6,7 @@
 
 #include <list>
 #include <string>
+#include <vector>
 
 #include "appcommon/xml/xml_handler.h"
 #include "models/base/units.h"
@@ -13,6 +14,7 @@
 
 #include "spananalyzer/span.h"
 #include "spananalyzer/span_analyzer_data.h"
+#include "spananalyzer/xml_stream_writer.h"
 
 /// \par OVERVIEW
 ///
@@ -85,7 +87,42 @@ class SpanXmlHandler : public XmlHandler {
                         const std::list<WeatherLoadCase*>* weathercases,
                         Span& span);
 
+  /// \brief Writes a span XML node to a stream.
+  /// \param[in] span
+  ///   The span.
+  /// \param[in] name
+  ///   The name of the XML node. This will be an attribute for the written
+  ///   node. If empty, no attribute will be written.
+  /// \param[in] system_units
+  ///   The unit system, which is used for attributing child XML nodes.
+  /// \param[in] style_units
+  ///   The unit style, which is used for attributing child XML nodes.
+  /// \param[in] writer
+  ///   The stream writer.
+  /// This writes the same XML as CreateNode(), without keeping more than the
+  /// line cable node in memory.
+  static void WriteNode(const Span& span,
+                        const std::string& name,
+                        const units::UnitSystem& system_units,
+                        const units::UnitStyle& style_units,
+                        XmlStreamWriter& writer);
+
  private:
+  /// \brief Parses a profile XML node.
+  /// \param[in] root
+  ///   The XML node for the profile.
+  /// \param[in] filepath
+  ///   The filepath that the xml node was loaded from. This is for logging
+  ///   purposes only and can be left blank.
+  /// \param[out] profile
+  ///   The profile points that are populated.
+  /// \return The status of the xml node parse. If any errors are encountered
+  ///   false is returned.
+  /// Invalid points are logged and skipped.
+  static bool ParseNodeProfile(const wxXmlNode* root,
+                               const std::string& filepath,
+                               std::vector<ProfilePoint>& profile);
+
   /// \brief Parses a version 1 XML node and populates a span.
   /// \param[in] root
   ///   The XML root node for the span.
@@ -117,6 +154,38 @@ class SpanXmlHandler : public XmlHandler {
                           const std::list<CableFile*>* cablefiles,
                           const std::list<WeatherLoadCase*>* weathercases,
                           Span& span);
+
+  /// \brief Parses a version 2 XML node and populates a span.
+  /// \param[in] root
+  ///   The XML root node for the span.
+  /// \param[in] filepath
+  ///   The filepath that the xml node was loaded from. This is for logging
+  ///   purposes only and can be left blank.
+  /// \param[in] units
+  ///   The unit system. If no conversion is being done this will be ignored.
+  /// \param[in] convert
+  ///   A flag that determines if the unit style is converted to 'consistent'.
+  /// \param[in] cablefiles
+  ///   A list of cable files that is matched against a cable description. If
+  ///   found, a pointer will be set to the matching cable.
+  /// \param[in] weathercases
+  ///   A list of weathercases that is matched against a weathercase
+  ///   description. If found, a pointer will be set to the matching
+  ///   weathercase.
+  /// \param[out] span
+  ///   The span that is populated.
+  /// \return The status of the xml node parse. If any errors are encountered
+  ///   false is returned.
+  /// All errors are logged to the active application log target. Critical
+  /// errors cause the parsing to abort. Non-critical errors set the object
+  /// property to an invalid state (if applicable).
+  static bool ParseNodeV2(const wxXmlNode* root,
+                          const std::string& filepath,
+                          const units::UnitSystem& units,
+                          const bool& convert,
+                          const std::list<CableFile*>* cablefiles,
+                          const std::list<WeatherLoadCase*>* weathercases,
+                          Span& span);
 };
 
 #endif  // SPANANALYZER_SPAN_XML_HANDLER_H_
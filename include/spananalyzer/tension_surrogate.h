@@ -0,0 +1,199 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_TENSION_SURROGATE_H_
+#define SPANANALYZER_TENSION_SURROGATE_H_
+
+#include <vector>
+
+#include "models/sagtension/line_cable_reloader.h"
+#include "models/transmissionline/weather_load_case.h"
+
+/// \par OVERVIEW
+///
+/// This struct contains the results of a temperature sweep.
+struct TemperatureSweepResult {
+  /// \var error
+  ///   The estimated maximum relative error of the horizontal tensions. This
+  ///   is zero if every temperature was solved exactly.
+  double error;
+
+  /// \var is_surrogate
+  ///   An indicator that tells if the tensions were interpolated.
+  bool is_surrogate;
+
+  /// \var num_solves
+  ///   The number of exact reloader solutions.
+  int num_solves;
+
+  /// \var tensions_horizontal
+  ///   The horizontal tensions, in the same order as the temperatures.
+  std::vector<double> tensions_horizontal;
+
+  /// \var weight_unit
+  ///   The unit weight, which doesn't vary with temperature.
+  Vector3d weight_unit;
+};
+
+/// \par OVERVIEW
+///
+/// This class is a surrogate of the reloaded horizontal tension of a line
+/// cable over a temperature range, which can be evaluated without solving the
+/// reloader.
+///
+/// \par KNOTS
+///
+/// The reloader is solved exactly at a set of knot temperatures. The tension
+/// between knots is interpolated with a monotone cubic spline (Fritsch-
+/// Carlson), so the interpolated tension never overshoots the solved
+/// tensions.
+///
+/// \par REFINEMENT
+///
+/// The knots start evenly spaced. Each interval is checked by solving its
+/// midpoint exactly and comparing it to the interpolated tension. Intervals
+/// that exceed the tolerance are split at the midpoint. Splitting changes the
+/// slopes of the adjacent knots, so the neighbors of a split interval are
+/// checked again. This repeats until every interval is within the tolerance or
+/// the knot limit is reached. The reported error is the largest midpoint error
+/// of the final spline.
+///
+/// \par UNIT WEIGHT
+///
+/// The unit weight only depends on the weathercase load, so it is the same for
+/// every temperature and isn't interpolated.
+class TensionSurrogate {
+ public:
+  /// \brief Constructor.
+  TensionSurrogate();
+
+  /// \brief Destructor.
+  ~TensionSurrogate();
+
+  /// \brief Builds the surrogate.
+  /// \return If the surrogate was built. If any exact solution fails, the
+  ///   surrogate isn't built.
+  bool Build();
+
+  /// \brief Gets the horizontal tension at a temperature.
+  /// \param[in] temperature
+  ///   The temperature, which is clamped to the surrogate range.
+  /// \return The interpolated horizontal tension.
+  double TensionHorizontal(const double& temperature) const;
+
+  /// \brief Gets the estimated maximum relative error.
+  /// \return The estimated maximum relative error.
+  double error() const;
+
+  /// \brief Gets the number of knots.
+  /// \return The number of knots.
+  int num_knots() const;
+
+  /// \brief Gets the number of exact reloader solutions.
+  /// \return The number of exact reloader solutions.
+  int num_solves() const;
+
+  /// \brief Sets the reloaded condition.
+  /// \param[in] condition
+  ///   The reloaded condition.
+  void set_condition(const CableConditionType& condition);
+
+  /// \brief Sets the line cable.
+  /// \param[in] line_cable
+  ///   The line cable.
+  void set_line_cable(const LineCable* line_cable);
+
+  /// \brief Sets the temperature range.
+  /// \param[in] temperature_min
+  ///   The minimum temperature.
+  /// \param[in] temperature_max
+  ///   The maximum temperature.
+  void set_temperatures(const double& temperature_min,
+                        const double& temperature_max);
+
+  /// \brief Sets the relative error tolerance.
+  /// \param[in] tolerance
+  ///   The relative error tolerance.
+  void set_tolerance(const double& tolerance);
+
+  /// \brief Sets the weathercase.
+  /// \param[in] weathercase
+  ///   The weathercase, which provides the load. The temperature is ignored.
+  void set_weathercase(const WeatherLoadCase& weathercase);
+
+  /// \brief Gets the unit weight.
+  /// \return The unit weight.
+  Vector3d weight_unit() const;
+
+ private:
+  /// \brief Interpolates the horizontal tension between the knots.
+  /// \param[in] temperature
+  ///   The temperature, which must be within the knots.
+  /// \return The interpolated horizontal tension.
+  double Interpolate(const double& temperature) const;
+
+  /// \brief Solves the horizontal tension exactly.
+  /// \param[in] temperature
+  ///   The temperature.
+  /// \param[out] tension
+  ///   The horizontal tension.
+  /// \return If the reloader solved.
+  bool SolveExact(const double& temperature, double& tension);
+
+  /// \brief Updates the knot slopes for the monotone spline.
+  void UpdateSlopes();
+
+  /// \var condition_
+  ///   The reloaded condition.
+  CableConditionType condition_;
+
+  /// \var error_
+  ///   The estimated maximum relative error.
+  double error_;
+
+  /// \var line_cable_
+  ///   The line cable.
+  const LineCable* line_cable_;
+
+  /// \var num_solves_
+  ///   The number of exact reloader solutions.
+  int num_solves_;
+
+  /// \var reloader_
+  ///   The reloader, which keeps the stretch state between solutions.
+  LineCableReloader reloader_;
+
+  /// \var slopes_
+  ///   The knot slopes.
+  std::vector<double> slopes_;
+
+  /// \var temperature_max_
+  ///   The maximum temperature.
+  double temperature_max_;
+
+  /// \var temperature_min_
+  ///   The minimum temperature.
+  double temperature_min_;
+
+  /// \var temperatures_
+  ///   The knot temperatures, which are increasing.
+  std::vector<double> temperatures_;
+
+  /// \var tensions_
+  ///   The knot horizontal tensions.
+  std::vector<double> tensions_;
+
+  /// \var tolerance_
+  ///   The relative error tolerance.
+  double tolerance_;
+
+  /// \var weathercase_
+  ///   The weathercase that is solved.
+  WeatherLoadCase weathercase_;
+
+  /// \var weight_unit_
+  ///   The unit weight.
+  Vector3d weight_unit_;
+};
+
+#endif  // SPANANALYZER_TENSION_SURROGATE_H_
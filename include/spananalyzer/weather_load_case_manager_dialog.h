@@ -6,6 +6,7 @@
 
 #include <list>
 #include <string>
+#include <unordered_set>
 
 #include "models/base/units.h"
 #include "wx/wx.h"
@@ -22,7 +23,8 @@ class WeatherLoadCaseManagerDialog : public wxDialog {
   /// \param[in] parent
   ///   The parent window.
   /// \param[in] units
-  ///   The unit system.
+  ///   The display unit system, which the weathercases are edited in. The
+  ///   weathercases are kept in the model unit system.
   /// \param[in,out] weathercases
   ///   The weathercases to be managed.
   WeatherLoadCaseManagerDialog(
@@ -43,18 +45,20 @@ class WeatherLoadCaseManagerDialog : public wxDialog {
   void DeleteExtraWeathercases(const std::list<WeatherLoadCase*>* list_keep,
                                std::list<WeatherLoadCase*>* list_master);
 
-  /// \brief Determines if the weathercase is referemced by analysis filters.
-  /// \param[in] name
-  ///   The name to check.
+  /// \brief Determines if the weathercase is referenced by analysis filters.
+  /// \param[in] weathercase
+  ///   The weathercase to check.
   /// \return If the weathercase is referenced by analysis filters.
-  bool IsReferencedByAnalysisFilters(const std::string& name) const;
+  /// This function looks up the weathercase in the filter references, which
+  /// are indexed when the dialog is created.
+  bool IsReferencedByAnalysisFilters(const WeatherLoadCase* weathercase) const;
 
   /// \brief Determines if the weathercase is referenced by the document.
-  /// \param[in] name
-  ///   The name to check.
+  /// \param[in] weathercase
+  ///   The weathercase to check.
   /// \return If the weathercase is referenced by the document.
-  /// This function scans the document to see if the weathercase is referenced.
-  bool IsReferencedByDocument(const std::string& name) const;
+  /// This function looks up the weathercase in the document span index.
+  bool IsReferencedByDocument(const WeatherLoadCase* weathercase) const;
 
   /// \brief Determines if the weathercase name is unique.
   /// \param[in] name
@@ -118,10 +122,19 @@ class WeatherLoadCaseManagerDialog : public wxDialog {
   ///   The listbox containing weathercases.
   wxListBox* listbox_weathercases_;
 
+  /// \var references_filters_
+  ///   The weathercases that are referenced by analysis filters. The filters
+  ///   can't be edited while the dialog is open, so this is only indexed once.
+  std::unordered_set<const WeatherLoadCase*> references_filters_;
+
   /// \var units_
-  ///   The unit system.
+  ///   The display unit system.
   const units::UnitSystem* units_;
 
+  /// \var units_model_
+  ///   The model unit system.
+  units::UnitSystem units_model_;
+
   /// \var weathercases_
   ///   The master list of weathercases allocated by the application. This list
   ///   includes the weathercases that are in the original and modified lists.
@@ -0,0 +1,154 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_WORKER_POOL_H_
+#define SPANANALYZER_WORKER_POOL_H_
+
+#include <vector>
+
+#include "wx/wx.h"
+
+class WorkerPool;
+
+/// \par OVERVIEW
+///
+/// This class is a worker thread that is run by a worker pool. Derived classes
+/// implement Process(), which does the work that is assigned to the thread.
+///
+/// \par PASSES
+///
+/// Once started, the thread waits for the pool to signal a pass, processes its
+/// work, and reports back to the pool. It keeps waiting for passes until the
+/// pool stops it, so the same thread can process several passes without being
+/// created again.
+class WorkerThread : public wxThread {
+ public:
+  /// \brief Constructor.
+  WorkerThread();
+
+  /// \brief Destructor.
+  virtual ~WorkerThread();
+
+  /// \brief Processes the work assigned to the thread.
+  /// This is called by Entry() for each pass, but is also called directly by
+  /// the pool if the thread isn't running.
+  virtual void Process() = 0;
+
+  /// \brief Sets the worker pool.
+  /// \param[in] pool
+  ///   The worker pool that signals the passes.
+  void set_pool(WorkerPool* pool);
+
+ protected:
+  /// \brief Begins the thread processing.
+  /// \return The thread exit code.
+  /// This function is called directly after Run().
+  virtual ExitCode Entry();
+
+  /// \var pool_
+  ///   The worker pool that signals the passes.
+  WorkerPool* pool_;
+};
+
+/// \par OVERVIEW
+///
+/// This class owns a set of worker threads and runs them in passes.
+///
+/// \par THREADS
+///
+/// The threads are started once by Start(), and every call to RunPass() has
+/// each thread process its work once. The calling thread blocks until the pass
+/// is complete. The threads are stopped and deleted with the pool.
+///
+/// \par FALLBACK
+///
+/// A single thread isn't started, and a thread that can't be started is
+/// logged. The work of threads that aren't running is processed on the
+/// calling thread, so a pass always processes all of the work.
+class WorkerPool {
+ public:
+  /// \brief Constructor.
+  WorkerPool();
+
+  /// \brief Destructor.
+  /// The threads are stopped and deleted.
+  ~WorkerPool();
+
+  /// \brief Adds a thread.
+  /// \param[in] thread
+  ///   The thread, which the pool takes ownership of. This must be done
+  ///   before the pool is started.
+  void Add(WorkerThread* thread);
+
+  /// \brief Gets the number of threads to use.
+  /// \param[in] max_threads
+  ///   The maximum number of threads. If less than one, the number of
+  ///   available CPUs is used.
+  /// \return The number of threads, which is at least one.
+  static int NumThreads(const int& max_threads);
+
+  /// \brief Runs a pass, where each thread processes its work once.
+  void RunPass();
+
+  /// \brief Starts the threads.
+  /// \return The number of threads that are running.
+  int Start();
+
+  /// \brief Gets the threads.
+  /// \return The threads, in the order they were added.
+  const std::vector<WorkerThread*>& threads() const;
+
+ private:
+  friend class WorkerThread;
+
+  /// \brief Reports that a thread completed a pass.
+  /// This is called by the worker threads.
+  void CompletePass();
+
+  /// \brief Stops the running threads and waits for them to exit.
+  void Stop();
+
+  /// \brief Waits for the next pass.
+  /// \param[in,out] pass
+  ///   The last pass that the thread processed, which is updated to the next
+  ///   pass.
+  /// \return If a pass was signalled. If false, the pool is stopping.
+  /// This is called by the worker threads.
+  bool WaitPass(int& pass);
+
+  /// \var mutex_
+  ///   The mutex that guards the pass state. This is declared first, as the
+  ///   conditions are constructed with it.
+  wxMutex mutex_;
+
+  /// \var condition_complete_
+  ///   The condition that is signalled when all running threads complete a
+  ///   pass.
+  wxCondition condition_complete_;
+
+  /// \var condition_pass_
+  ///   The condition that is signalled when a pass begins or the pool stops.
+  wxCondition condition_pass_;
+
+  /// \var is_stopped_
+  ///   An indicator that tells if the pool is stopping.
+  bool is_stopped_;
+
+  /// \var num_pending_
+  ///   The number of running threads that haven't completed the pass.
+  int num_pending_;
+
+  /// \var pass_
+  ///   The current pass.
+  int pass_;
+
+  /// \var threads_
+  ///   The threads.
+  std::vector<WorkerThread*> threads_;
+
+  /// \var threads_running_
+  ///   An indicator for each thread that tells if it is running.
+  std::vector<bool> threads_running_;
+};
+
+#endif  // SPANANALYZER_WORKER_POOL_H_
@@ -0,0 +1,171 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#ifndef SPANANALYZER_XML_STREAM_WRITER_H_
+#define SPANANALYZER_XML_STREAM_WRITER_H_
+
+#include <string>
+#include <vector>
+
+#include "wx/stream.h"
+#include "wx/xml/xml.h"
+
+/// \par OVERVIEW
+///
+/// This class writes XML directly to an output stream, without building an
+/// XML document in memory.
+///
+/// \par FORMAT
+///
+/// The output matches wxXmlDocument::Save() with an indent step. Elements that
+/// only contain text are written on a single line, elements without any
+/// content are closed with a short tag, and all other child elements are
+/// written on an indented line.
+///
+/// \par BUFFERING
+///
+/// Output is collected in an internal buffer and written to the stream in
+/// large blocks. The buffer is flushed when it fills, and when the document is
+/// ended.
+///
+/// \par NUMBERS
+///
+/// Numbers are formatted with a fixed precision without going through printf
+/// or wxString, which is a significant part of the save time for documents
+/// with many spans.
+class XmlStreamWriter {
+ public:
+  /// \brief Constructor.
+  /// \param[in] stream
+  ///   The output stream. The stream must outlive the writer.
+  /// \param[in] indent
+  ///   The number of spaces that each nested element is indented.
+  XmlStreamWriter(wxOutputStream& stream, const int& indent = 2);
+
+  /// \brief Destructor.
+  /// Any buffered output is flushed.
+  ~XmlStreamWriter();
+
+  /// \brief Adds an attribute to the most recently started element.
+  /// \param[in] name
+  ///   The attribute name.
+  /// \param[in] value
+  ///   The attribute value.
+  /// Attributes must be added before any content is written to the element.
+  void AddAttribute(const std::string& name, const std::string& value);
+
+  /// \brief Ends the document.
+  /// \return If all of the output was written to the stream.
+  /// Any open elements are ended and the buffer is flushed.
+  bool EndDocument();
+
+  /// \brief Ends the most recently started element.
+  void EndElement();
+
+  /// \brief Formats a number with a fixed number of decimal places.
+  /// \param[in] value
+  ///   The value.
+  /// \param[in] precision
+  ///   The number of decimal places.
+  /// \return The formatted number.
+  static std::string FormatNumber(const double& value, const int& precision);
+
+  /// \brief Starts the document.
+  /// The XML declaration is written.
+  void StartDocument();
+
+  /// \brief Starts an element.
+  /// \param[in] name
+  ///   The element name.
+  void StartElement(const std::string& name);
+
+  /// \brief Writes an element that only contains text.
+  /// \param[in] name
+  ///   The element name.
+  /// \param[in] content
+  ///   The element text.
+  void WriteElement(const std::string& name, const std::string& content);
+
+  /// \brief Writes an element that only contains a number.
+  /// \param[in] name
+  ///   The element name.
+  /// \param[in] value
+  ///   The value.
+  /// \param[in] precision
+  ///   The number of decimal places.
+  /// \param[in] units
+  ///   The units attribute value. If empty, no attribute is written.
+  void WriteElementNumber(const std::string& name, const double& value,
+                          const int& precision, const std::string& units);
+
+  /// \brief Writes an XML node and all of its children.
+  /// \param[in] node
+  ///   The XML node.
+  /// This is used for nodes that are generated by other XML handlers. Only the
+  /// node is held in memory, not the document.
+  void WriteNode(const wxXmlNode* node);
+
+  /// \brief Writes text to the most recently started element.
+  /// \param[in] text
+  ///   The text, which is escaped as it is written.
+  void WriteText(const std::string& text);
+
+ private:
+  /// \par OVERVIEW
+  ///
+  /// This struct is an element that has been started but not ended.
+  struct Element {
+    /// \var name
+    ///   The element name.
+    std::string name;
+
+    /// \var is_last_child_element
+    ///   An indicator that tells if the last child written was an element.
+    bool is_last_child_element;
+  };
+
+  /// \brief Appends escaped text to the buffer.
+  /// \param[in] text
+  ///   The text.
+  /// \param[in] is_attribute
+  ///   An indicator that tells if quotes are escaped.
+  void AppendEscaped(const std::string& text, const bool& is_attribute);
+
+  /// \brief Appends a line break and indentation to the buffer.
+  /// \param[in] depth
+  ///   The element depth.
+  void AppendIndentation(const int& depth);
+
+  /// \brief Closes the start tag of the most recently started element.
+  void CloseStartTag();
+
+  /// \brief Writes the buffer to the stream.
+  void Flush();
+
+  /// \var buffer_
+  ///   The buffered output.
+  std::string buffer_;
+
+  /// \var elements_
+  ///   The elements that have been started but not ended.
+  std::vector<Element> elements_;
+
+  /// \var indent_
+  ///   The number of spaces that each nested element is indented.
+  int indent_;
+
+  /// \var is_ok_
+  ///   An indicator that tells if all output was written to the stream.
+  bool is_ok_;
+
+  /// \var is_start_tag_open_
+  ///   An indicator that tells if the start tag of the most recently started
+  ///   element is still open for attributes.
+  bool is_start_tag_open_;
+
+  /// \var stream_
+  ///   The output stream.
+  wxOutputStream& stream_;
+};
+
+#endif  // SPANANALYZER_XML_STREAM_WRITER_H_
@@ -3,46 +3,189 @@
 
 #include "spananalyzer/analysis_controller.h"
 
+#ifdef __WXMSW__
+#include <windows.h>
+#elif defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
 #include "appcommon/widgets/status_bar_log.h"
 #include "appcommon/widgets/timer.h"
 #include "models/base/helper.h"
 #include "wx/wx.h"
 
+#include "spananalyzer/worker_pool.h"
+
+namespace {
+
+/// \brief Appends the bytes of a value to a fingerprint.
+/// \param[in] value
+///   The value.
+/// \param[in,out] fingerprint
+///   The fingerprint.
+template<typename T>
+void AppendFingerprint(const T& value, std::string& fingerprint) {
+  fingerprint.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// \brief Gets the logical CPUs that the process is allowed to run on.
+/// \return The logical CPU indexes in ascending order, from the process
+///   affinity mask. If the mask can't be determined, the list is empty.
+std::vector<int> ProcessCpus() {
+  std::vector<int> cpus;
+#ifdef __WXMSW__
+  // the affinity mask only covers the processor group of the process
+  DWORD_PTR mask_process = 0;
+  DWORD_PTR mask_system = 0;
+  if (GetProcessAffinityMask(GetCurrentProcess(), &mask_process,
+                             &mask_system) == 0) {
+    return cpus;
+  }
+
+  const int kSizeMask = static_cast<int>(sizeof(DWORD_PTR) * 8);
+  for (int i = 0; i < kSizeMask; i++) {
+    if (((mask_process >> i) & 1) == 1) {
+      cpus.push_back(i);
+    }
+  }
+#elif defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+    return cpus;
+  }
+
+  for (int i = 0; i < CPU_SETSIZE; i++) {
+    if (CPU_ISSET(i, &set) != 0) {
+      cpus.push_back(i);
+    }
+  }
+#endif
+  return cpus;
+}
+
+/// \brief Pins the calling thread to a logical CPU.
+/// \param[in] index_cpu
+///   The logical CPU index.
+/// \return If the thread was pinned. Pinning is only supported on Windows and
+///   Linux.
+bool PinThread(const int& index_cpu) {
+#ifdef __WXMSW__
+  // the affinity mask only covers the processor group of the thread
+  if (static_cast<int>(sizeof(DWORD_PTR) * 8) <= index_cpu) {
+    return false;
+  }
+
+  const DWORD_PTR mask = static_cast<DWORD_PTR>(1) << index_cpu;
+  return SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+#elif defined(__linux__)
+  if (CPU_SETSIZE <= index_cpu) {
+    return false;
+  }
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(index_cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+  return false;
+#endif
+}
+
+/// \var kFractionBudgetModels
+///   The fraction of the cache memory budget that is used by the compiled cable
+///   models.
+const double kFractionBudgetModels = 0.125;
+
+/// \var kSizeSweepCacheMax
+///   The maximum number of temperature sweeps that are cached.
+const int kSizeSweepCacheMax = 64;
+
+/// \var kSizeSweepSurrogateMin
+///   The minimum number of sweep temperatures that a surrogate is used for.
+///   Smaller sweeps are solved exactly, as the surrogate would need a similar
+///   number of solutions.
+const int kSizeSweepSurrogateMin = 32;
+
+}  // namespace
+
 AnalysisThread::AnalysisThread() : wxThread(wxTHREAD_JOINABLE) {
+  channel_ = nullptr;
+  index_cpu_ = -1;
+  is_pinned_ = false;
   line_cable_ = nullptr;
+  results_ = nullptr;
+  results_reloaded_ = nullptr;
   spacing_catenary_ = nullptr;
+  state_stretch_creep_ = nullptr;
+  state_stretch_load_ = nullptr;
+  time_busy_ = 0;
 }
 
 void AnalysisThread::AddAnalysisJob(AnalysisJob* job) {
   jobs_.push_back(job);
 }
 
-const LineCable* AnalysisThread::line_cable() const {
-  return line_cable_;
+bool AnalysisThread::is_pinned() const {
+  return is_pinned_;
 }
 
-const std::list<ErrorMessage>* AnalysisThread::messages() const {
-  return &messages_;
+const LineCable* AnalysisThread::line_cable() const {
+  return line_cable_;
 }
 
 const LineCableReloader* AnalysisThread::reloader() const {
   return &reloader_;
 }
 
+void AnalysisThread::set_channel(AnalysisDiagnosticChannel* channel) {
+  channel_ = channel;
+}
+
+void AnalysisThread::set_index_cpu(const int& index_cpu) {
+  index_cpu_ = index_cpu;
+}
+
 void AnalysisThread::set_line_cable(const LineCable* line_cable) {
   line_cable_ = line_cable;
 }
 
+void AnalysisThread::set_results(SagTensionResultStore* results) {
+  results_ = results;
+}
+
+void AnalysisThread::set_results_reloaded(
+    SagTensionResultStore* results_reloaded) {
+  results_reloaded_ = results_reloaded;
+}
+
 void AnalysisThread::set_spacing_catenary(const Vector3d* spacing_catenary) {
   spacing_catenary_ = spacing_catenary;
 }
 
+void AnalysisThread::set_states_stretch(
+    const CableStretchState* state_stretch_creep,
+    const CableStretchState* state_stretch_load) {
+  state_stretch_creep_ = state_stretch_creep;
+  state_stretch_load_ = state_stretch_load;
+}
+
 const Vector3d* AnalysisThread::spacing_catenary() const {
   return spacing_catenary_;
 }
 
+double AnalysisThread::time_busy() const {
+  return time_busy_;
+}
+
 void AnalysisThread::DoAnalysisJob(const int& index) {
-  std::string message;
   AnalysisJob* job = *std::next(jobs_.begin(), index);
 
   // sets up loaders for job
@@ -52,73 +195,35 @@ void AnalysisThread::DoAnalysisJob(const int& index) {
   unloader_.set_condition_unloaded(job->condition);
   unloader_.set_temperature_unloaded(job->weathercase->temperature_cable);
 
-  // validates reloader and logs any errors
-  std::list<ErrorMessage> messages;
-  const bool status_reloader = reloader_.Validate(false, &messages);
-  if (status_reloader == false) {
-    // errors were present
-    // adds analysis controller error message to give context
-    ErrorMessage message;
-    message.title = "ANALYSIS THREAD";
-    if (job->condition == CableConditionType::kCreep) {
-      message.description = "No reloader solution for "
-                            + job->weathercase->description
-                            + " Creep.";
-    } else if (job->condition == CableConditionType::kInitial) {
-      message.description = "No solution for "
-                            + job->weathercase->description
-                            + " Initial.";
-    } else if (job->condition == CableConditionType::kLoad) {
-      message.description = "No solution for "
-                            + job->weathercase->description
-                            + " Load.";
-    }
-
-    messages_.push_back(message);
-
-    // adds reloader error messages
-    messages_.splice(messages_.cend(), messages);
-  }
-
-  // validates unloader and logs any errors
-  const bool status_unloader = unloader_.Validate(false, &messages);
-  if (status_unloader == false) {
-    // errors were present
-    // adds analysis controller error message to give context
-    ErrorMessage message;
-    message.title = "ANALYSIS THREAD";
-    if (job->condition == CableConditionType::kCreep) {
-      message.description = "No unloader solution for "
-                            + job->weathercase->description
-                            + " Creep.";
-    } else if (job->condition == CableConditionType::kInitial) {
-      message.description = "No solution for "
-                            + job->weathercase->description
-                            + " Initial.";
-    } else if (job->condition == CableConditionType::kLoad) {
-      message.description = "No solution for "
-                            + job->weathercase->description
-                            + " Load.";
-    }
-
-    messages_.push_back(message);
-
-    // adds unloader error messages
-    messages_.splice(messages_.cend(), messages);
-  }
-
   // populates result
-  SagTensionAnalysisResult& result = *job->result;
+  SagTensionAnalysisResult result;
   result.weathercase = job->weathercase;
 
-  if ((status_reloader == true) && (status_unloader == true)) {
-    // no errors were present
-    result.condition = job->condition;
-
-    // gets reloaded catenary and populates sag-tension result
-    Catenary3d catenary = reloader_.CatenaryReloaded();
-
-    result.length_unloaded = unloader_.LengthUnloaded();
+  // validates reloader and publishes any errors
+  // the reloader is timed through extracting the solution because the solve
+  // may be deferred until the results are requested
+  // error messages aren't requested, as they are expensive to build and are
+  // formatted later by the controller
+  // reloaded jobs read the result that was solved for an identical line
+  // cable, and only rebuild the catenary for the residual check
+  Catenary3d catenary;
+
+  std::chrono::steady_clock::time_point time_start =
+      std::chrono::steady_clock::now();
+  bool status_reloader = false;
+  if (job->is_reloaded == true) {
+    status_reloader = results_reloaded_->Result(job->index_weathercase,
+                                                job->condition, result);
+    result.weathercase = job->weathercase;
+    if (status_reloader == true) {
+      catenary.set_spacing_endpoints(
+          line_cable_->spacing_attachments_ruling_span());
+      catenary.set_tension_horizontal(result.tension_horizontal);
+      catenary.set_weight_unit(result.weight_unit);
+    }
+  } else if (reloader_.Validate(false, nullptr) == true) {
+    status_reloader = true;
+    catenary = reloader_.CatenaryReloaded();
 
     result.state = reloader_.StateReloaded();
 
@@ -135,30 +240,112 @@ void AnalysisThread::DoAnalysisJob(const int& index) {
         CableElongationModel::ComponentType::kShell);
 
     result.weight_unit = catenary.weight_unit();
+
+    // shares the reloaded result with identical line cables
+    SagTensionAnalysisResult result_reloaded = result;
+    result_reloaded.condition = job->condition;
+    results_reloaded_->SetResult(job->index_weathercase, job->condition,
+                                 result_reloaded);
+  }
+
+  if (status_reloader == false) {
+    AnalysisDiagnostic diagnostic;
+    diagnostic.code = AnalysisDiagnostic::Code::kReloaderNoSolution;
+    diagnostic.condition = job->condition;
+    diagnostic.index_job = job->index;
+    diagnostic.index_weathercase = job->index_weathercase;
+    channel_->Publish(diagnostic);
+  }
+  result.time_solve_reloader = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - time_start).count();
+
+  // validates unloader and publishes any errors
+  time_start = std::chrono::steady_clock::now();
+  const bool status_unloader = unloader_.Validate(false, nullptr);
+  if (status_unloader == true) {
+    result.length_unloaded = unloader_.LengthUnloaded();
+  } else {
+    AnalysisDiagnostic diagnostic;
+    diagnostic.code = AnalysisDiagnostic::Code::kUnloaderNoSolution;
+    diagnostic.condition = job->condition;
+    diagnostic.index_job = job->index;
+    diagnostic.index_weathercase = job->index_weathercase;
+    channel_->Publish(diagnostic);
+  }
+  result.time_solve_unloader = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - time_start).count();
+
+  if ((status_reloader == true) && (status_unloader == true)) {
+    // no errors were present
+    result.condition = job->condition;
+    result.residual_length = ResidualLength(result, catenary);
   } else {
     // flags this as an invalid result
+    // the store only keeps the solver statistics for invalid results
     result.condition = CableConditionType::kNull;
+  }
 
-    result.length_unloaded = -999999;
-
-    result.state = CableStretchState();
-
-    result.tension_average = -999999;
-    result.tension_average_core = -999999;
-    result.tension_average_shell = -999999;
+  results_->SetResult(job->index_weathercase, job->condition, result);
+}
 
-    result.tension_horizontal = -999999;
-    result.tension_horizontal_core = -999999;
-    result.tension_horizontal_shell = -999999;
+double AnalysisThread::ResidualLength(const SagTensionAnalysisResult& result,
+                                      const Catenary3d& catenary) {
+  // gets the stretch state for the result condition
+  // the shared stretch states are used if set, so the reloader doesn't solve
+  // them again
+  CableStretchState state_stretch;
+  if ((result.condition == CableConditionType::kCreep)
+      && (state_stretch_creep_ != nullptr)) {
+    state_stretch = *state_stretch_creep_;
+  } else if (result.condition == CableConditionType::kCreep) {
+    state_stretch = reloader_.StretchStateCreep();
+  } else if ((result.condition == CableConditionType::kLoad)
+             && (state_stretch_load_ != nullptr)) {
+    state_stretch = *state_stretch_load_;
+  } else if (result.condition == CableConditionType::kLoad) {
+    state_stretch = reloader_.StretchStateLoad();
+  } else {
+    state_stretch.load = 0;
+    state_stretch.temperature = 0;
+    state_stretch.type_polynomial =
+        SagTensionCableComponent::PolynomialType::kLoadStrain;
+  }
 
-    result.weight_unit = Vector3d();
+  // the cable state includes the weathercase temperature, so the model is
+  // updated for each job instead of being shared through the model cache
+  model_.set_state(result.state);
+  model_.set_state_stretch(state_stretch);
+
+  // calculates the loaded length predicted by the model
+  const double strain_unloaded = model_.Strain(
+      CableElongationModel::ComponentType::kCombined, 0);
+  const double strain_loaded = model_.Strain(
+      CableElongationModel::ComponentType::kCombined, result.tension_average);
+  const double length_model = result.length_unloaded
+                              * (1 + strain_loaded) / (1 + strain_unloaded);
+  if (length_model <= 0) {
+    return -999999;
   }
+
+  return catenary.Length() / length_model - 1;
 }
 
 wxThread::ExitCode AnalysisThread::Entry() {
+  const auto time_start = std::chrono::steady_clock::now();
+
+  // pins to the logical cpu before any work is done, so the thread memory is
+  // allocated near the cpu
+  if (0 <= index_cpu_) {
+    is_pinned_ = PinThread(index_cpu_);
+  }
+
   // initializes loaders
   reloader_.set_line_cable(line_cable_);
 
+  // initializes the elongation model used to check solution residuals
+  cable_.set_cable_base(line_cable_->cable());
+  model_.set_cable(&cable_);
+
   unloader_.set_line_cable(line_cable_);
   unloader_.set_spacing_attachments(*spacing_catenary_);
 
@@ -168,19 +355,25 @@ wxThread::ExitCode AnalysisThread::Entry() {
     DoAnalysisJob(i);
   }
 
+  time_busy_ = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - time_start).count();
+
   // exits
   return (wxThread::ExitCode)0;
 }
 
 
 AnalysisController::AnalysisController() {
+  is_background_ = false;
+  is_pinned_ = false;
+  is_surrogate_ = false;
+  size_budget_results_ = 0;
+  size_solutions_ = 0;
   span_ = nullptr;
+  tolerance_surrogate_ = 0.001;
   weathercases_ = nullptr;
 
-  max_threads_ = wxThread::GetCPUCount();
-  if (max_threads_ == -1) {
-    max_threads_ = 1;
-  }
+  max_threads_ = WorkerPool::NumThreads(0);
 
   state_stretch_initial_.load = 0;
   state_stretch_initial_.temperature = 0;
@@ -191,56 +384,84 @@ AnalysisController::AnalysisController() {
 AnalysisController::~AnalysisController() {
 }
 
+void AnalysisController::ClearCache() {
+  cache_models_.Clear();
+  cache_results_.Clear();
+
+  index_solutions_.clear();
+  solutions_.clear();
+  size_solutions_ = 0;
+  UpdateSizeBudgetResults();
+
+  index_sweeps_.clear();
+  sweeps_.clear();
+}
+
 void AnalysisController::ClearResults() {
-  results_creep_.clear();
-  results_initial_.clear();
-  results_load_.clear();
+  results_.Clear();
   state_stretch_creep_ = CableStretchState();
   state_stretch_load_ = CableStretchState();
 
   status_bar_log::SetText("Ready", 0);
 }
 
-const SagTensionAnalysisResult* AnalysisController::Result(
-    const int& index_weathercase,
-    const CableConditionType& condition) const {
-  // checks index
-  const int kSizeResults = results_creep_.size();
-  if ((index_weathercase < 0) || (kSizeResults <= index_weathercase)) {
-    return nullptr;
+void AnalysisController::InvalidateResults(const Span* span) {
+  cache_results_.Remove(span);
+}
+
+bool AnalysisController::Result(const int& index_weathercase,
+                                const CableConditionType& condition,
+                                SagTensionAnalysisResult& result) const {
+  return results_.Result(index_weathercase, condition, result);
+}
+
+bool AnalysisController::RestoreResults() {
+  if (span_ == nullptr) {
+    return false;
   }
 
-  // gets the results container to pull from
-  const std::vector<SagTensionAnalysisResult>* results = nullptr;
-  if (condition == CableConditionType::kCreep) {
-    results = &results_creep_;
-  } else if (condition == CableConditionType::kInitial) {
-    results = &results_initial_;
-  } else if (condition == CableConditionType::kLoad) {
-    results = &results_load_;
-  } else {
-    return nullptr;
+  // extracts the block from the cache
+  std::vector<char> block;
+  if (cache_results_.Extract(span_, block) == false) {
+    return false;
   }
 
-  // checks if result is valid before returning pointer
-  if (results->at(index_weathercase).condition == CableConditionType::kNull) {
-    return nullptr;
-  } else {
-    return &results->at(index_weathercase);
+  // gets the stretch states from the end of the block
+  const size_t kSizeStates = sizeof(CableStretchState) * 2;
+  if (block.size() < kSizeStates) {
+    return false;
   }
-}
 
-const std::vector<SagTensionAnalysisResult>* AnalysisController::Results(
-    const CableConditionType& condition) const {
-  if (condition == CableConditionType::kCreep) {
-    return &results_creep_;;
-  } else if (condition == CableConditionType::kInitial) {
-    return &results_initial_;
-  } else if (condition == CableConditionType::kLoad) {
-    return &results_load_;
-  } else {
-    return nullptr;
+  const size_t kSizeResults = block.size() - kSizeStates;
+  std::memcpy(&state_stretch_creep_, block.data() + kSizeResults,
+              sizeof(CableStretchState));
+  std::memcpy(&state_stretch_load_,
+              block.data() + kSizeResults + sizeof(CableStretchState),
+              sizeof(CableStretchState));
+  block.resize(kSizeResults);
+
+  // restores the results and checks that the weathercases still match
+  if (results_.Deserialize(block) == false) {
+    ClearResults();
+    return false;
   }
+
+  if (results_.size_cases() != static_cast<int>(weathercases_->size())) {
+    ClearResults();
+    return false;
+  }
+
+  int index = 0;
+  for (auto iter = weathercases_->cbegin(); iter != weathercases_->cend();
+       iter++) {
+    results_.SetWeathercase(index, *iter);
+    index++;
+  }
+
+  wxLogVerbose("Restored cached analysis results.");
+  status_bar_log::SetText("Ready", 0);
+
+  return true;
 }
 
 void AnalysisController::RunAnalysis() {
@@ -277,32 +498,66 @@ void AnalysisController::RunAnalysis() {
   timer.Start();
 
   // creates empty set of results that will be populated by worker threads
-  results_creep_.resize(weathercases_->size(), SagTensionAnalysisResult());
-  results_initial_.resize(weathercases_->size(), SagTensionAnalysisResult());
-  results_load_.resize(weathercases_->size(), SagTensionAnalysisResult());
+  results_.Reset(weathercases_->size());
+
+  // gets the shared solution for the line cable, if it was already solved for
+  // another span
+  const std::string fingerprint = Fingerprint(span_->linecable);
+  const LineCableSolution* solution = nullptr;
+  SagTensionResultStore results_reloaded;
+
+  auto iter_solution = index_solutions_.find(fingerprint);
+  if (iter_solution != index_solutions_.end()) {
+    // moves the solution to the front, as it is the most recently used
+    solutions_.splice(solutions_.begin(), solutions_, iter_solution->second);
+  }
+
+  if ((iter_solution != index_solutions_.end())
+      && (results_reloaded.Deserialize(solutions_.front().block) == true)
+      && (results_reloaded.size_cases()
+          == static_cast<int>(weathercases_->size()))) {
+    solution = &solutions_.front();
+
+    wxLogVerbose("Line cable was already solved. Only the span geometry is "
+                 "solved.");
+  } else {
+    results_reloaded.Reset(weathercases_->size());
+  }
 
   // creates a job list
-  std::list<AnalysisJob> jobs;
+  // the jobs are stored in a vector so diagnostics can reference them by index
+  std::vector<AnalysisJob> jobs;
+  jobs.reserve(weathercases_->size() * 3);
+  int index = 0;
   for (auto iter = weathercases_->cbegin(); iter != weathercases_->cend();
        iter++) {
-    const int index = std::distance(weathercases_->cbegin(), iter);
+    results_.SetWeathercase(index, *iter);
+    results_reloaded.SetWeathercase(index, *iter);
 
     AnalysisJob job;
+    job.index_weathercase = index;
+    job.is_reloaded = solution != nullptr;
     job.weathercase = *iter;
 
     job.condition = CableConditionType::kCreep;
-    job.result = &results_creep_[index];
+    job.index = jobs.size();
     jobs.push_back(job);
 
     job.condition = CableConditionType::kInitial;
-    job.result = &results_initial_[index];
+    job.index = jobs.size();
     jobs.push_back(job);
 
     job.condition = CableConditionType::kLoad;
-    job.result = &results_load_[index];
+    job.index = jobs.size();
     jobs.push_back(job);
+
+    index++;
   }
 
+  // preallocates the diagnostic channel
+  // each job can publish a reloader and unloader diagnostic
+  channel_diagnostics_.Reset(jobs.size() * 2);
+
   // determines the number of analysis threads to use
   int num_threads = -1;
   const int num_jobs = jobs.size();
@@ -313,12 +568,32 @@ void AnalysisController::RunAnalysis() {
     num_threads = max_threads_;
   }
 
+  // gets the logical cpus that the threads are pinned to
+  // only cpus in the process affinity mask are used, so a process that is
+  // restricted to a subset of cpus (e.g. a batch shard) stays within it
+  std::vector<int> cpus;
+  if (is_pinned_ == true) {
+    cpus = ProcessCpus();
+  }
+
   // creates analysis threads
+  // the threads are pinned to the allowed cpus in order, and wrap around if
+  // the thread budget exceeds the cpu count
   std::list<AnalysisThread*> threads;
   for (int i = 0; i < num_threads; i++) {
     AnalysisThread* thread = new AnalysisThread();
+    thread->set_channel(&channel_diagnostics_);
+    if (cpus.empty() == false) {
+      thread->set_index_cpu(cpus[i % cpus.size()]);
+    }
     thread->set_line_cable(&span_->linecable);
+    thread->set_results(&results_);
+    thread->set_results_reloaded(&results_reloaded);
     thread->set_spacing_catenary(&span_->spacing_attachments);
+    if (solution != nullptr) {
+      thread->set_states_stretch(&solution->state_stretch_creep,
+                                 &solution->state_stretch_load);
+    }
     threads.push_back(thread);
   }
 
@@ -347,8 +622,14 @@ void AnalysisController::RunAnalysis() {
   status_bar_log::PushText("Running sag-tension analysis...", 0);
 
   // starts threads
+  // the parallel time starts when the first thread is started
+  const auto time_start = std::chrono::steady_clock::now();
   for (auto iter = threads.begin(); iter != threads.end(); iter++) {
     AnalysisThread* thread = *iter;
+    if (is_background_ == true) {
+      thread->SetPriority(wxPRIORITY_MIN);
+    }
+
     wxThreadError status = thread->Run();
     if (status != wxTHREAD_NO_ERROR) {
       wxLogError("Couldn't start analysis thread");
@@ -356,28 +637,91 @@ void AnalysisController::RunAnalysis() {
   }
 
   // waits for threads to complete (i.e. joins worker threads back into main)
-  bool is_errors = false;
-  for (auto iter_thread = threads.begin(); iter_thread != threads.end();
-       iter_thread++) {
-    AnalysisThread* thread = *iter_thread;
+  for (auto iter = threads.begin(); iter != threads.end(); iter++) {
+    AnalysisThread* thread = *iter;
     thread->Wait();
+  }
 
-    // collects any thread errors and logs
-    const std::list<ErrorMessage>* messages = thread->messages();
-    for (auto iter_message = messages->cbegin();
-         iter_message != messages->cend(); iter_message++) {
-      is_errors = true;
-      const ErrorMessage& message_error = *iter_message;
-      std::string str = message_error.title + " - " + message_error.description;
-      wxLogError(str.c_str());
+  const double time_parallel = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - time_start).count();
+
+  // solves the parallel efficiency, which is the fraction of the available
+  // thread time that was spent doing jobs
+  double time_busy = 0;
+  int num_pinned = 0;
+  for (auto iter = threads.cbegin(); iter != threads.cend(); iter++) {
+    const AnalysisThread* thread = *iter;
+    time_busy += thread->time_busy();
+    if (thread->is_pinned() == true) {
+      num_pinned++;
     }
   }
 
+  double efficiency = 1;
+  if (0 < time_parallel) {
+    efficiency = std::min(1.0, time_busy / (time_parallel * num_threads));
+  }
+
+  if ((is_pinned_ == true) && (num_pinned < num_threads)) {
+    message = "Only " + std::to_string(num_pinned) + " of "
+              + std::to_string(num_threads)
+              + " analysis threads were pinned to a CPU.";
+    wxLogVerbose(message.c_str());
+  }
+
+  // drains and logs the diagnostics once the threads are joined
+  // the channel has a slot for every diagnostic a job can publish, so nothing
+  // is dropped by waiting, and the main thread doesn't poll while they run
+  const int num_errors = LogDiagnostics(jobs);
+  if (0 < channel_diagnostics_.num_dropped()) {
+    message = std::to_string(channel_diagnostics_.num_dropped())
+              + " analysis diagnostic(s) were dropped.";
+    wxLogError(message.c_str());
+  }
+
   // updates stretch states
   // the stretch states are similar for all threads, so it grabs from first one
-  AnalysisThread* thread = *threads.cbegin();
-  state_stretch_creep_ = thread->reloader()->StretchStateCreep();
-  state_stretch_load_ = thread->reloader()->StretchStateLoad();
+  if (solution != nullptr) {
+    state_stretch_creep_ = solution->state_stretch_creep;
+    state_stretch_load_ = solution->state_stretch_load;
+  } else {
+    AnalysisThread* thread = *threads.cbegin();
+    state_stretch_creep_ = thread->reloader()->StretchStateCreep();
+    state_stretch_load_ = thread->reloader()->StretchStateLoad();
+
+    // shares the solution with spans that have an identical line cable
+    // a stale solution with the same fingerprint is replaced
+    auto iter_stale = index_solutions_.find(fingerprint);
+    if (iter_stale != index_solutions_.end()) {
+      EraseSolution(iter_stale->second);
+    }
+
+    LineCableSolution solution_new;
+    results_reloaded.Serialize(solution_new.block);
+    solution_new.fingerprint = fingerprint;
+    solution_new.state_stretch_creep = state_stretch_creep_;
+    solution_new.state_stretch_load = state_stretch_load_;
+
+    // evicts the least recently used solutions until the new solution fits
+    // the budget that isn't used by the cached results, as they can be
+    // recalculated
+    const long size_block = solution_new.block.size();
+    const long size_available =
+        size_budget_results_ - cache_results_.size_memory();
+    while ((solutions_.empty() == false)
+        && (size_available < size_solutions_ + size_block)) {
+      EraseSolution(std::prev(solutions_.end()));
+    }
+
+    if (size_solutions_ + size_block <= size_available) {
+      size_solutions_ += size_block;
+      solutions_.push_front(std::move(solution_new));
+      index_solutions_[fingerprint] = solutions_.begin();
+    }
+
+    // the cached results can't grow into the memory used by the solutions
+    UpdateSizeBudgetResults();
+  }
 
   // deletes threads
   for (auto iter = threads.begin(); iter != threads.end(); iter++) {
@@ -388,25 +732,343 @@ void AnalysisController::RunAnalysis() {
   // stops timer and logs
   timer.Stop();
   message = "Analysis time = "
-            + helper::DoubleToString(timer.Duration(), 3, true) + "s.";
+            + helper::DoubleToString(timer.Duration(), 3, true) + "s using "
+            + std::to_string(num_threads) + " threads (parallel efficiency = "
+            + helper::DoubleToString(efficiency * 100, 0, true) + "%).";
   wxLogVerbose(message.c_str());
 
-  // notifies user of any errors
-  if (is_errors == true) {
-    // notifies user of error
-    message = "Analysis encountered error(s). Check logs.";
-    wxMessageBox(message);
-  }
+  message = "Result storage = "
+            + std::to_string(results_.SizeMemory() / 1024) + "kB.";
+  wxLogVerbose(message.c_str());
+
+  LogSolverStatistics();
 
   // clears status bar
   status_bar_log::PopText(0);
-  status_bar_log::SetText("Ready", 0);
+
+  // notifies user of any errors
+  // a message box isn't used so batch runs aren't interrupted
+  if (0 < num_errors) {
+    message = "Analysis encountered " + std::to_string(num_errors)
+              + " error(s).";
+    wxLogError(message.c_str());
+    status_bar_log::SetText("Analysis error(s) present, see logs", 0);
+  } else {
+    status_bar_log::SetText("Ready", 0);
+  }
+}
+
+std::string AnalysisController::Fingerprint(const LineCable& linecable) {
+  std::string fingerprint;
+
+  // the cable and weathercases are referenced from the application data, so
+  // they are compared by address
+  AppendFingerprint(linecable.cable(), fingerprint);
+  AppendFingerprint(linecable.weathercase_stretch_creep(), fingerprint);
+  AppendFingerprint(linecable.weathercase_stretch_load(), fingerprint);
+
+  const CableConstraint& constraint = linecable.constraint();
+  AppendFingerprint(constraint.case_weather, fingerprint);
+  AppendFingerprint(constraint.condition, fingerprint);
+  AppendFingerprint(constraint.limit, fingerprint);
+  AppendFingerprint(constraint.type_limit, fingerprint);
+
+  const Vector3d& spacing = linecable.spacing_attachments_ruling_span();
+  AppendFingerprint(spacing.x(), fingerprint);
+  AppendFingerprint(spacing.y(), fingerprint);
+  AppendFingerprint(spacing.z(), fingerprint);
+
+  return fingerprint;
+}
+
+void AnalysisController::EraseSolution(
+    std::list<LineCableSolution>::iterator iter) {
+  size_solutions_ -= iter->block.size();
+  index_solutions_.erase(iter->fingerprint);
+  solutions_.erase(iter);
+}
+
+int AnalysisController::LogDiagnostics(const std::vector<AnalysisJob>& jobs) {
+  // drains any new diagnostics from the channel
+  std::list<AnalysisDiagnostic> diagnostics;
+  const int num_drained = channel_diagnostics_.Drain(diagnostics);
+  if (num_drained == 0) {
+    return 0;
+  }
+
+  // formats and logs each diagnostic
+  const bool is_verbose = wxLog::GetVerbose();
+  for (auto iter = diagnostics.cbegin(); iter != diagnostics.cend(); iter++) {
+    const AnalysisDiagnostic& diagnostic = *iter;
+    const AnalysisJob& job = jobs.at(diagnostic.index_job);
+
+    std::string str_condition;
+    if (diagnostic.condition == CableConditionType::kCreep) {
+      str_condition = "Creep";
+    } else if (diagnostic.condition == CableConditionType::kInitial) {
+      str_condition = "Initial";
+    } else if (diagnostic.condition == CableConditionType::kLoad) {
+      str_condition = "Load";
+    }
+
+    std::string str_solver;
+    if (diagnostic.code == AnalysisDiagnostic::Code::kReloaderNoSolution) {
+      str_solver = "reloader";
+    } else if (diagnostic.code
+        == AnalysisDiagnostic::Code::kUnloaderNoSolution) {
+      str_solver = "unloader";
+    }
+
+    std::string message = "ANALYSIS THREAD - No " + str_solver
+                          + " solution for " + job.weathercase->description
+                          + " " + str_condition + ".";
+    wxLogError(message.c_str());
+
+    // the detailed solver messages are only generated if verbose logging is
+    // enabled, as the job needs to be re-validated to generate them
+    if (is_verbose == false) {
+      continue;
+    }
+
+    std::list<ErrorMessage> messages;
+    if (diagnostic.code == AnalysisDiagnostic::Code::kReloaderNoSolution) {
+      LineCableReloader reloader;
+      reloader.set_line_cable(&span_->linecable);
+      reloader.set_condition_reloaded(job.condition);
+      reloader.set_weathercase_reloaded(job.weathercase);
+      reloader.Validate(false, &messages);
+    } else if (diagnostic.code
+        == AnalysisDiagnostic::Code::kUnloaderNoSolution) {
+      LineCableUnloader unloader;
+      unloader.set_line_cable(&span_->linecable);
+      unloader.set_spacing_attachments(span_->spacing_attachments);
+      unloader.set_condition_unloaded(job.condition);
+      unloader.set_temperature_unloaded(job.weathercase->temperature_cable);
+      unloader.Validate(false, &messages);
+    }
+
+    for (auto iter_message = messages.cbegin();
+         iter_message != messages.cend(); iter_message++) {
+      const ErrorMessage& message_error = *iter_message;
+      message = message_error.title + " - " + message_error.description;
+      wxLogVerbose(message.c_str());
+    }
+  }
+
+  return num_drained;
+}
+
+void AnalysisController::LogSolverStatistics() const {
+  std::string message;
+
+  // searches all results for the slowest and least converged solutions
+  const WeatherLoadCase* weathercase_slowest = nullptr;
+  const WeatherLoadCase* weathercase_residual = nullptr;
+  double time_slowest = -1;
+  double time_total = 0;
+  double residual_max = -1;
+  int num_results = 0;
+
+  const CableConditionType conditions[] = {CableConditionType::kCreep,
+                                           CableConditionType::kInitial,
+                                           CableConditionType::kLoad};
+  SagTensionAnalysisResult result;
+  for (const CableConditionType& condition : conditions) {
+    for (int i = 0; i < results_.size_cases(); i++) {
+      const bool is_valid = results_.Result(i, condition, result);
+
+      const double time = result.time_solve_reloader
+                          + result.time_solve_unloader;
+      time_total += time;
+      num_results++;
+      if (time_slowest < time) {
+        time_slowest = time;
+        weathercase_slowest = result.weathercase;
+      }
+
+      if (is_valid == false) {
+        continue;
+      }
+
+      const double residual = std::abs(result.residual_length);
+      if (residual_max < residual) {
+        residual_max = residual;
+        weathercase_residual = result.weathercase;
+      }
+    }
+  }
+
+  if (num_results == 0) {
+    return;
+  }
+
+  message = "Average solve time = "
+            + helper::DoubleToString(time_total / num_results * 1000, 3, true)
+            + "ms.";
+  wxLogVerbose(message.c_str());
+
+  if (weathercase_slowest != nullptr) {
+    message = "Slowest solution = " + weathercase_slowest->description
+              + " ("
+              + helper::DoubleToString(time_slowest * 1000, 3, true)
+              + "ms).";
+    wxLogVerbose(message.c_str());
+  }
+
+  if (weathercase_residual != nullptr) {
+    message = "Maximum length residual = "
+              + weathercase_residual->description + " ("
+              + helper::DoubleToString(residual_max, 9, true) + ").";
+    wxLogVerbose(message.c_str());
+  }
+}
+
+void AnalysisController::StashResults() {
+  // checks if there are results to stash
+  if ((span_ == nullptr) || (results_.size_cases() == 0)) {
+    return;
+  }
+
+  // serializes the results and appends the stretch states
+  std::vector<char> block;
+  results_.Serialize(block);
+
+  const size_t kSizeResults = block.size();
+  block.resize(kSizeResults + sizeof(CableStretchState) * 2);
+  std::memcpy(block.data() + kSizeResults, &state_stretch_creep_,
+              sizeof(CableStretchState));
+  std::memcpy(block.data() + kSizeResults + sizeof(CableStretchState),
+              &state_stretch_load_, sizeof(CableStretchState));
+
+  cache_results_.Insert(span_, block);
+}
+
+void AnalysisController::UpdateSizeBudgetResults() {
+  cache_results_.set_size_budget(
+      std::max(size_budget_results_ - size_solutions_, 0L));
+}
+
+bool AnalysisController::SolveTemperatureSweep(
+    const WeatherLoadCase& weathercase,
+    const CableConditionType& condition,
+    const std::vector<double>& temperatures,
+    TemperatureSweepResult& result) const {
+  result.error = 0;
+  result.is_surrogate = false;
+  result.num_solves = 0;
+  result.tensions_horizontal.clear();
+
+  if ((span_ == nullptr) || (temperatures.empty() == true)) {
+    return false;
+  }
+
+  // generates the sweep key
+  // the weathercase is referenced from the application data, so it is
+  // compared by address
+  std::string key = Fingerprint(span_->linecable);
+  AppendFingerprint(&weathercase, key);
+  AppendFingerprint(condition, key);
+  AppendFingerprint(is_surrogate_, key);
+  AppendFingerprint(tolerance_surrogate_, key);
+  for (auto iter = temperatures.cbegin(); iter != temperatures.cend();
+       iter++) {
+    AppendFingerprint(*iter, key);
+  }
+
+  // reuses a cached sweep
+  auto iter_sweep = index_sweeps_.find(key);
+  if (iter_sweep != index_sweeps_.end()) {
+    sweeps_.splice(sweeps_.begin(), sweeps_, iter_sweep->second);
+    result = iter_sweep->second->result;
+    return true;
+  }
+
+  const int kSizeTemperatures = temperatures.size();
+  result.tensions_horizontal.resize(kSizeTemperatures);
+
+  if ((is_surrogate_ == true)
+      && (kSizeSweepSurrogateMin <= kSizeTemperatures)) {
+    // builds a surrogate over the sweep range and interpolates
+    TensionSurrogate surrogate;
+    surrogate.set_condition(condition);
+    surrogate.set_line_cable(&span_->linecable);
+    surrogate.set_temperatures(
+        *std::min_element(temperatures.cbegin(), temperatures.cend()),
+        *std::max_element(temperatures.cbegin(), temperatures.cend()));
+    surrogate.set_tolerance(tolerance_surrogate_);
+    surrogate.set_weathercase(weathercase);
+
+    const bool status = surrogate.Build();
+    result.num_solves = surrogate.num_solves();
+    if (status == false) {
+      result.tensions_horizontal.clear();
+      return false;
+    }
+
+    for (int i = 0; i < kSizeTemperatures; i++) {
+      result.tensions_horizontal[i] =
+          surrogate.TensionHorizontal(temperatures[i]);
+    }
+
+    result.error = surrogate.error();
+    result.is_surrogate = true;
+    result.weight_unit = surrogate.weight_unit();
+  } else {
+    // solves every temperature exactly
+    // a single reloader is used so the stretch state is only solved once
+    WeatherLoadCase weathercase_sweep = weathercase;
+
+    LineCableReloader reloader;
+    reloader.set_line_cable(&span_->linecable);
+    reloader.set_condition_reloaded(condition);
+
+    for (int i = 0; i < kSizeTemperatures; i++) {
+      weathercase_sweep.temperature_cable = temperatures[i];
+      reloader.set_weathercase_reloaded(&weathercase_sweep);
+
+      result.num_solves++;
+      if (reloader.Validate(false, nullptr) == false) {
+        result.tensions_horizontal.clear();
+        return false;
+      }
+
+      const Catenary3d catenary = reloader.CatenaryReloaded();
+      result.tensions_horizontal[i] = catenary.tension_horizontal();
+      result.weight_unit = catenary.weight_unit();
+    }
+  }
+
+  // logs the sweep
+  std::string message = "Solved a temperature sweep of "
+                        + std::to_string(kSizeTemperatures)
+                        + " points with "
+                        + std::to_string(result.num_solves)
+                        + " reloader solutions.";
+  if (result.is_surrogate == true) {
+    message += " Surrogate error: "
+               + helper::DoubleToString(result.error * 100, 4, true) + "%.";
+  }
+  wxLogVerbose(message.c_str());
+
+  // caches the sweep, evicting the least recently used sweep
+  TemperatureSweepEntry entry;
+  entry.key = key;
+  entry.result = result;
+  sweeps_.push_front(entry);
+  index_sweeps_[key] = sweeps_.begin();
+
+  if (kSizeSweepCacheMax < static_cast<int>(sweeps_.size())) {
+    index_sweeps_.erase(sweeps_.back().key);
+    sweeps_.pop_back();
+  }
+
+  return true;
 }
 
 const CableStretchState* AnalysisController::StretchState(
     const CableConditionType& condition) {
   // checks if analysis has been ran
-  if (weathercases_->size() != results_creep_.size()) {
+  if (static_cast<int>(weathercases_->size()) != results_.size_cases()) {
     return nullptr;
   }
 
@@ -421,10 +1083,69 @@ const CableStretchState* AnalysisController::StretchState(
   }
 }
 
+CableModelCache* AnalysisController::cache_models() {
+  return &cache_models_;
+}
+
+int AnalysisController::max_threads() const {
+  return max_threads_;
+}
+
+const SagTensionResultStore* AnalysisController::results() const {
+  return &results_;
+}
+
+void AnalysisController::set_is_background(const bool& is_background) {
+  is_background_ = is_background;
+}
+
+void AnalysisController::set_is_pinned(const bool& is_pinned) {
+  is_pinned_ = is_pinned;
+}
+
+void AnalysisController::set_is_spilling_cache(const bool& is_spilling) {
+  cache_results_.set_is_spilling(is_spilling);
+}
+
+void AnalysisController::set_is_surrogate(const bool& is_surrogate) {
+  is_surrogate_ = is_surrogate;
+}
+
+void AnalysisController::set_max_threads(const int& max_threads) {
+  max_threads_ = WorkerPool::NumThreads(max_threads);
+}
+
+void AnalysisController::set_size_budget_cache(const long& size_budget) {
+  // the compiled models get a fixed share, and the results get the rest
+  const long size_budget_models =
+      static_cast<long>(size_budget * kFractionBudgetModels);
+  cache_models_.set_size_budget(size_budget_models);
+
+  // the results and shared solutions draw from the rest, so the solutions
+  // that no longer fit are evicted
+  size_budget_results_ = size_budget - size_budget_models;
+  while ((solutions_.empty() == false)
+         && (size_budget_results_ < size_solutions_)) {
+    EraseSolution(std::prev(solutions_.end()));
+  }
+  UpdateSizeBudgetResults();
+}
+
 void AnalysisController::set_span(const Span* span) {
+  if (span == span_) {
+    return;
+  }
+
+  // caches the results of the previous span
+  StashResults();
+
   span_ = span;
 }
 
+void AnalysisController::set_tolerance_surrogate(const double& tolerance) {
+  tolerance_surrogate_ = tolerance;
+}
+
 void AnalysisController::set_weathercases(
     const std::list<WeatherLoadCase*>* weathercases) {
   weathercases_ = weathercases;
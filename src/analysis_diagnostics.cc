@@ -0,0 +1,83 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/analysis_diagnostics.h"
+
+AnalysisDiagnosticChannel::AnalysisDiagnosticChannel() {
+  capacity_ = 0;
+  index_drained_ = 0;
+  index_reserved_ = 0;
+  num_dropped_ = 0;
+}
+
+AnalysisDiagnosticChannel::~AnalysisDiagnosticChannel() {
+}
+
+int AnalysisDiagnosticChannel::Drain(
+    std::list<AnalysisDiagnostic>& diagnostics) {
+  int num_drained = 0;
+
+  // gets the reserved slot limit
+  int index_end = index_reserved_.load(std::memory_order_acquire);
+  if (capacity_ < index_end) {
+    index_end = capacity_;
+  }
+
+  // drains slots in order until an unpublished slot is encountered
+  while (index_drained_ < index_end) {
+    if (flags_published_[index_drained_].load(std::memory_order_acquire)
+        == false) {
+      break;
+    }
+
+    diagnostics.push_back(slots_[index_drained_]);
+    index_drained_++;
+    num_drained++;
+  }
+
+  return num_drained;
+}
+
+bool AnalysisDiagnosticChannel::Publish(const AnalysisDiagnostic& diagnostic) {
+  // reserves a slot
+  const int index = index_reserved_.fetch_add(1, std::memory_order_relaxed);
+  if (capacity_ <= index) {
+    num_dropped_.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  // writes the slot and then flags it as published
+  slots_[index] = diagnostic;
+  flags_published_[index].store(true, std::memory_order_release);
+
+  return true;
+}
+
+void AnalysisDiagnosticChannel::Reset(const int& capacity) {
+  if (capacity_ != capacity) {
+    capacity_ = capacity;
+    slots_.resize(capacity_);
+    flags_published_.reset(new std::atomic<bool>[capacity_]);
+  }
+
+  for (int i = 0; i < capacity_; i++) {
+    flags_published_[i].store(false, std::memory_order_relaxed);
+  }
+
+  index_drained_ = 0;
+  index_reserved_.store(0, std::memory_order_release);
+  num_dropped_.store(0, std::memory_order_release);
+}
+
+int AnalysisDiagnosticChannel::num_dropped() const {
+  return num_dropped_.load(std::memory_order_acquire);
+}
+
+int AnalysisDiagnosticChannel::num_published() const {
+  const int index = index_reserved_.load(std::memory_order_acquire);
+  if (capacity_ < index) {
+    return capacity_;
+  } else {
+    return index;
+  }
+}
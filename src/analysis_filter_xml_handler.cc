@@ -136,3 +136,32 @@ bool AnalysisFilterXmlHandler::ParseNodeV1(
 
   return status;
 }
+
+void AnalysisFilterXmlHandler::WriteNode(const AnalysisFilter& filter,
+                                         const std::string& name,
+                                         XmlStreamWriter& writer) {
+  // writes the root
+  writer.StartElement("analysis_filter");
+  writer.AddAttribute("version", "1");
+
+  if (name != "") {
+    writer.AddAttribute("name", name);
+  }
+
+  // writes condition node
+  std::string content;
+  if (filter.condition == CableConditionType::kCreep) {
+    content = "Creep";
+  } else if (filter.condition == CableConditionType::kInitial) {
+    content = "Initial";
+  } else if (filter.condition == CableConditionType::kLoad) {
+    content = "Load";
+  }
+  writer.WriteElement("condition", content);
+
+  // writes weathercase node
+  writer.WriteElement("weather_load_case", filter.weathercase->description);
+
+  // ends the root
+  writer.EndElement();
+}
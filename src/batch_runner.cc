@@ -0,0 +1,616 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/batch_runner.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "models/base/helper.h"
+#include "wx/dir.h"
+#include "wx/evtloop.h"
+#include "wx/filename.h"
+#include "wx/process.h"
+#include "wx/stdpaths.h"
+#include "wx/xml/xml.h"
+
+#include "spananalyzer/analysis_controller.h"
+#include "spananalyzer/span_analyzer_app.h"
+#include "spananalyzer/span_analyzer_doc_xml_handler.h"
+#include "spananalyzer/span_unit_converter.h"
+#include "spananalyzer/worker_pool.h"
+
+namespace {
+
+/// \par OVERVIEW
+///
+/// This class is a shard process, which records the exit status when the
+/// process terminates.
+class BatchProcess : public wxProcess {
+ public:
+  /// \brief Constructor.
+  /// \param[in] index_shard
+  ///   The shard index.
+  BatchProcess(const int& index_shard) {
+    index_shard_ = index_shard;
+    is_terminated_ = false;
+    status_ = -1;
+  }
+
+  /// \brief Handles the process termination.
+  /// \param[in] pid
+  ///   The process id.
+  /// \param[in] status
+  ///   The process exit status.
+  virtual void OnTerminate(int pid, int status) {
+    is_terminated_ = true;
+    status_ = status;
+  }
+
+  /// \brief Gets the shard index.
+  /// \return The shard index.
+  int index_shard() const {
+    return index_shard_;
+  }
+
+  /// \brief Gets if the process has terminated.
+  /// \return If the process has terminated.
+  bool is_terminated() const {
+    return is_terminated_;
+  }
+
+  /// \brief Gets the exit status.
+  /// \return The exit status. This is only valid once the process has
+  ///   terminated.
+  int status() const {
+    return status_;
+  }
+
+ private:
+  /// \var index_shard_
+  ///   The shard index.
+  int index_shard_;
+
+  /// \var is_terminated_
+  ///   An indicator that tells if the process has terminated.
+  bool is_terminated_;
+
+  /// \var status_
+  ///   The exit status.
+  int status_;
+};
+
+/// \brief Quotes a comma-separated field if needed.
+/// \param[in] str
+///   The field.
+/// \return The field, which is quoted if it contains a comma or quote.
+std::string QuoteField(const std::string& str) {
+  if (str.find_first_of(",\"\n") == std::string::npos) {
+    return str;
+  }
+
+  std::string quoted = "\"";
+  for (auto iter = str.cbegin(); iter != str.cend(); iter++) {
+    if (*iter == '"') {
+      quoted += "\"\"";
+    } else {
+      quoted += *iter;
+    }
+  }
+  quoted += "\"";
+
+  return quoted;
+}
+
+/// \var kAttemptsMax
+///   The maximum number of times a shard process is started.
+const int kAttemptsMax = 2;
+
+/// \var kConditions
+///   The conditions that results are written for, in results file order.
+const CableConditionType kConditions[3] = {CableConditionType::kCreep,
+                                           CableConditionType::kInitial,
+                                           CableConditionType::kLoad};
+
+/// \var kNamesConditions
+///   The condition names, which match the condition order.
+const char* const kNamesConditions[3] = {"Creep", "Initial", "Load"};
+
+/// \var kSizeChunkMerge
+///   The number of bytes that are copied at once when merging shard results.
+const size_t kSizeChunkMerge = 1 << 16;
+
+}  // namespace
+
+BatchRunner::BatchRunner() {
+  size_shard_ = 1000;
+  set_max_processes(0);
+}
+
+BatchRunner::~BatchRunner() {
+}
+
+bool BatchRunner::Run() {
+  std::string message;
+
+  // splits the input into shards
+  std::vector<BatchShard> shards;
+  if (CreateShards(shards) == false) {
+    return false;
+  }
+
+  if (shards.empty() == true) {
+    message = filepath_input_ + "  --  Batch input doesn't have any spans.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  message = "Running batch analysis with " + std::to_string(shards.size())
+            + " shard(s) and up to " + std::to_string(max_processes_)
+            + " process(es).";
+  wxLogMessage(message.c_str());
+
+  // runs the shard processes
+  RunProcesses(shards);
+
+  // merges the results, including any shards that failed so the completed
+  // results aren't lost
+  const bool status_merge = MergeShards(shards);
+
+  int num_failed = 0;
+  for (auto iter = shards.cbegin(); iter != shards.cend(); iter++) {
+    const BatchShard& shard = *iter;
+    if (shard.is_complete == false) {
+      message = shard.filepath_doc + "  --  Spans "
+                + std::to_string(shard.index_begin) + " to "
+                + std::to_string(shard.index_end - 1)
+                + " couldn't be analyzed.";
+      wxLogError(message.c_str());
+      num_failed++;
+    }
+  }
+
+  return (status_merge == true) && (num_failed == 0);
+}
+
+bool BatchRunner::RunShard(const int& index_begin, const int& index_end) {
+  std::string message;
+
+  // loads the document xml
+  wxXmlDocument doc_xml;
+  if (doc_xml.Load(filepath_input_) == false) {
+    message = filepath_input_ + "  --  "
+              "Document file contains an invalid xml structure. Aborting.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  // gets unit system attribute from file
+  const wxXmlNode* root = doc_xml.GetRoot();
+  wxString str_units;
+  units::UnitSystem units_file;
+  root->GetAttribute("units", &str_units);
+  if (str_units == "Imperial") {
+    units_file = units::UnitSystem::kImperial;
+  } else if (str_units == "Metric") {
+    units_file = units::UnitSystem::kMetric;
+  } else {
+    message = filepath_input_ + "  --  "
+              "Document file contains an invalid units attribute. Aborting.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  // parses the shard spans
+  const SpanAnalyzerData* data = wxGetApp().data();
+
+  std::list<Span> spans;
+  if (SpanAnalyzerDocXmlHandler::ParseSpans(
+          root, filepath_input_, units_file, true, &data->cablefiles,
+          &data->weathercases, index_begin, index_end, spans) == false) {
+    message = filepath_input_ + "  --  "
+              "Document file contains parsing error(s). Check logs.";
+    wxLogError(message.c_str());
+  }
+
+  // converts the spans the same way as the document does when it is loaded
+  const units::UnitSystem units_model = wxGetApp().units_model();
+  for (auto iter = spans.begin(); iter != spans.end(); iter++) {
+    Span& span = *iter;
+    SpanUnitConverter::ConvertUnitStyleToConsistent(0, units_file, true, span);
+    if (units_file != units_model) {
+      SpanUnitConverter::ConvertUnitSystem(units_file, units_model, true,
+                                           span);
+    }
+  }
+
+  // writes to a temporary file, which is renamed once it is complete
+  const std::string filepath_temp = filepath_results_ + ".tmp";
+  wxFile file;
+  if (file.Create(filepath_temp, true) == false) {
+    message = filepath_temp + "  --  Couldn't create shard results file.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  WriteHeader(file);
+
+  const wxFileName filename_doc(filepath_input_);
+  const std::string name_doc = filename_doc.GetFullName().ToStdString();
+  const int num_invalid = AnalyzeSpans(name_doc, index_begin, spans, file);
+  if (0 < num_invalid) {
+    message = filepath_input_ + "  --  " + std::to_string(num_invalid)
+              + " result(s) couldn't be solved.";
+    wxLogWarning(message.c_str());
+  }
+
+  file.Close();
+
+  return wxRenameFile(filepath_temp, filepath_results_, true);
+}
+
+std::string BatchRunner::filepath_input() const {
+  return filepath_input_;
+}
+
+std::string BatchRunner::filepath_results() const {
+  return filepath_results_;
+}
+
+int BatchRunner::max_processes() const {
+  return max_processes_;
+}
+
+void BatchRunner::set_filepath_config(const std::string& filepath_config) {
+  filepath_config_ = filepath_config;
+}
+
+void BatchRunner::set_filepath_input(const std::string& filepath_input) {
+  filepath_input_ = filepath_input;
+}
+
+void BatchRunner::set_filepath_results(const std::string& filepath_results) {
+  filepath_results_ = filepath_results;
+}
+
+void BatchRunner::set_max_processes(const int& max_processes) {
+  max_processes_ = WorkerPool::NumThreads(max_processes);
+}
+
+void BatchRunner::set_size_shard(const int& size_shard) {
+  size_shard_ = std::max(1, size_shard);
+}
+
+int BatchRunner::size_shard() const {
+  return size_shard_;
+}
+
+int BatchRunner::AnalyzeSpans(const std::string& name_doc,
+                              const int& index_begin,
+                              const std::list<Span>& spans,
+                              wxFile& file) {
+  const SpanAnalyzerConfig* config = wxGetApp().config();
+  const std::list<WeatherLoadCase*>& weathercases =
+      wxGetApp().data()->weathercases;
+
+  // sets up the analysis controller the same way as a document
+  const ThreadOptions options = wxGetApp().OptionsThreads();
+
+  AnalysisController controller;
+  controller.set_is_background(options.is_background);
+  controller.set_is_pinned(options.is_pinned);
+  controller.set_max_threads(options.max_threads);
+  controller.set_size_budget_cache(
+      static_cast<long>(config->options_cache_results.size_memory)
+      * 1024 * 1024);
+  controller.set_weathercases(&weathercases);
+
+  int num_invalid = 0;
+  int index = index_begin;
+  for (auto iter = spans.cbegin(); iter != spans.cend(); iter++) {
+    const Span& span = *iter;
+
+    controller.set_span(&span);
+    controller.RunAnalysis();
+
+    // writes a line for each weathercase and condition
+    std::string line;
+    int index_weathercase = 0;
+    for (auto it = weathercases.cbegin(); it != weathercases.cend(); it++) {
+      const WeatherLoadCase* weathercase = *it;
+
+      for (int i = 0; i < 3; i++) {
+        SagTensionAnalysisResult result;
+        if (controller.Result(index_weathercase, kConditions[i],
+                              result) == false) {
+          num_invalid++;
+          continue;
+        }
+
+        line += QuoteField(name_doc) + ","
+                + std::to_string(index) + ","
+                + QuoteField(span.name) + ","
+                + QuoteField(weathercase->description) + ","
+                + kNamesConditions[i] + ","
+                + helper::DoubleToString(result.tension_horizontal, 6, true)
+                + ","
+                + helper::DoubleToString(result.tension_horizontal_core, 6,
+                                         true) + ","
+                + helper::DoubleToString(result.tension_horizontal_shell, 6,
+                                         true) + ","
+                + helper::DoubleToString(result.tension_average, 6, true)
+                + ","
+                + helper::DoubleToString(result.length_unloaded, 6, true)
+                + "\n";
+      }
+
+      index_weathercase++;
+    }
+
+    file.Write(line);
+
+    // clears the results so they aren't stashed in the result cache, as the
+    // span is never analyzed again
+    controller.ClearResults();
+
+    index++;
+  }
+
+  return num_invalid;
+}
+
+bool BatchRunner::CreateShards(std::vector<BatchShard>& shards) const {
+  std::string message;
+
+  // gets the documents, which are sorted so the shard order is repeatable
+  wxArrayString filepaths;
+  if (wxFileName::DirExists(filepath_input_) == true) {
+    wxDir::GetAllFiles(filepath_input_, &filepaths, "*.spananalyzer",
+                       wxDIR_FILES);
+    filepaths.Sort();
+  } else if (wxFileName::FileExists(filepath_input_) == true) {
+    filepaths.Add(filepath_input_);
+  } else {
+    message = filepath_input_ + "  --  Batch input doesn't exist.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  // splits each document into span ranges
+  wxFileName filename_shard(filepath_results_);
+  const wxString name_results = filename_shard.GetName();
+  filename_shard.SetExt("csv");
+
+  for (auto iter = filepaths.cbegin(); iter != filepaths.cend(); iter++) {
+    const std::string filepath_doc = iter->ToStdString();
+
+    // only the span nodes are counted, the spans aren't parsed
+    wxXmlDocument doc_xml;
+    int num_spans = -1;
+    if (doc_xml.Load(filepath_doc) == true) {
+      num_spans = SpanAnalyzerDocXmlHandler::CountSpans(doc_xml.GetRoot());
+    }
+
+    if (num_spans == -1) {
+      message = filepath_doc + "  --  "
+                "Document file is invalid. Aborting batch.";
+      wxLogError(message.c_str());
+      return false;
+    }
+
+    for (int index = 0; index < num_spans; index += size_shard_) {
+      filename_shard.SetName(name_results + "_shard"
+                             + std::to_string(shards.size()));
+
+      BatchShard shard;
+      shard.filepath_doc = filepath_doc;
+      shard.filepath_results = filename_shard.GetFullPath();
+      shard.index_begin = index;
+      shard.index_end = std::min(index + size_shard_, num_spans);
+      shard.is_complete = false;
+      shard.num_attempts = 0;
+      shards.push_back(shard);
+    }
+  }
+
+  return true;
+}
+
+bool BatchRunner::MergeShards(const std::vector<BatchShard>& shards) const {
+  std::string message;
+
+  wxFile file;
+  if (file.Create(filepath_results_, true) == false) {
+    message = filepath_results_ + "  --  Couldn't create batch results file.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  WriteHeader(file);
+
+  // appends the shard results in shard order, without the shard headers
+  // the shard files are copied in chunks, so only one chunk is held in memory
+  std::vector<char> chunk(kSizeChunkMerge);
+  bool status = true;
+  for (auto iter = shards.cbegin(); iter != shards.cend(); iter++) {
+    const BatchShard& shard = *iter;
+    if (shard.is_complete == false) {
+      continue;
+    }
+
+    wxFile file_shard;
+    if (file_shard.Open(shard.filepath_results) == false) {
+      message = shard.filepath_results + "  --  "
+                "Couldn't read shard results file.";
+      wxLogError(message.c_str());
+      status = false;
+      continue;
+    }
+
+    bool is_header = true;
+    bool status_shard = true;
+    while (true) {
+      const ssize_t size_read = file_shard.Read(chunk.data(), chunk.size());
+      if (size_read == wxInvalidOffset) {
+        status_shard = false;
+        break;
+      } else if (size_read == 0) {
+        break;
+      }
+
+      // skips the header, which ends at the first line break
+      size_t pos = 0;
+      if (is_header == true) {
+        const char* end = static_cast<const char*>(
+            std::memchr(chunk.data(), '\n', size_read));
+        if (end == nullptr) {
+          continue;
+        }
+        pos = end - chunk.data() + 1;
+        is_header = false;
+      }
+
+      if (file.Write(chunk.data() + pos, size_read - pos)
+          != static_cast<size_t>(size_read - pos)) {
+        status_shard = false;
+        break;
+      }
+    }
+    file_shard.Close();
+
+    if (status_shard == false) {
+      message = shard.filepath_results + "  --  "
+                "Couldn't copy shard results file.";
+      wxLogError(message.c_str());
+      status = false;
+      continue;
+    }
+
+    wxRemoveFile(shard.filepath_results);
+  }
+
+  file.Close();
+
+  message = "Batch results written to: " + filepath_results_;
+  wxLogMessage(message.c_str());
+
+  return status;
+}
+
+void BatchRunner::RunProcesses(std::vector<BatchShard>& shards) const {
+  std::string message;
+
+  // splits the analysis thread budget between the processes, whether the
+  // budget is the cpu count or set by the user
+  // pinning isn't passed on, as every process would pin to the same cpus
+  const ThreadOptions options = wxGetApp().OptionsThreads();
+  int num_threads = WorkerPool::NumThreads(options.max_threads);
+  num_threads = std::max(1, num_threads / max_processes_);
+
+  const std::string filepath_executable =
+      wxStandardPaths::Get().GetExecutablePath().ToStdString();
+
+  // activates an event loop, which notifies the processes when they terminate
+  wxEventLoop loop;
+  wxEventLoopActivator activator(&loop);
+
+  std::list<int> queue;
+  for (int i = 0; i < static_cast<int>(shards.size()); i++) {
+    queue.push_back(i);
+  }
+
+  std::list<BatchProcess*> processes;
+  while ((queue.empty() == false) || (processes.empty() == false)) {
+    // starts processes up to the limit
+    while ((queue.empty() == false)
+        && (static_cast<int>(processes.size()) < max_processes_)) {
+      const int index = queue.front();
+      queue.pop_front();
+
+      BatchShard& shard = shards[index];
+      shard.num_attempts++;
+      wxRemoveFile(shard.filepath_results);
+
+      // the arguments are passed without a shell, so paths aren't quoted
+      std::vector<std::string> args;
+      args.push_back(filepath_executable);
+      args.push_back("--config=" + filepath_config_);
+      args.push_back("--batch=" + shard.filepath_results);
+      args.push_back("--batch-shard=" + std::to_string(shard.index_begin)
+                     + "," + std::to_string(shard.index_end));
+      args.push_back("--threads=" + std::to_string(num_threads));
+      if (options.is_background == true) {
+        args.push_back("--threads-background");
+      }
+      args.push_back(shard.filepath_doc);
+
+      std::vector<const char*> argv;
+      for (auto iter = args.cbegin(); iter != args.cend(); iter++) {
+        argv.push_back(iter->c_str());
+      }
+      argv.push_back(nullptr);
+
+      BatchProcess* process = new BatchProcess(index);
+      if (wxExecute(argv.data(), wxEXEC_ASYNC, process) == 0) {
+        message = "Couldn't start process for shard "
+                  + std::to_string(index + 1) + ".";
+        wxLogError(message.c_str());
+        delete process;
+        continue;
+      }
+
+      processes.push_back(process);
+    }
+
+    // dispatches events, which flags any terminated processes
+    while (loop.Pending() == true) {
+      loop.Dispatch();
+    }
+
+    // checks the terminated processes
+    auto iter = processes.begin();
+    while (iter != processes.end()) {
+      BatchProcess* process = *iter;
+      if (process->is_terminated() == false) {
+        iter++;
+        continue;
+      }
+
+      const int index = process->index_shard();
+      BatchShard& shard = shards[index];
+      if ((process->status() == 0)
+          && (wxFileName::FileExists(shard.filepath_results) == true)) {
+        shard.is_complete = true;
+
+        message = "Shard " + std::to_string(index + 1) + " of "
+                  + std::to_string(shards.size()) + " complete.";
+        wxLogMessage(message.c_str());
+      } else if (shard.num_attempts < kAttemptsMax) {
+        message = "Shard " + std::to_string(index + 1)
+                  + " process exited with status "
+                  + std::to_string(process->status()) + ". Restarting.";
+        wxLogWarning(message.c_str());
+        queue.push_back(index);
+      } else {
+        message = "Shard " + std::to_string(index + 1)
+                  + " process exited with status "
+                  + std::to_string(process->status()) + ".";
+        wxLogError(message.c_str());
+      }
+
+      delete process;
+      iter = processes.erase(iter);
+    }
+
+    if (processes.empty() == false) {
+      wxMilliSleep(10);
+    }
+  }
+}
+
+void BatchRunner::WriteHeader(wxFile& file) {
+  file.Write("document,span,name,weathercase,condition,tension_horizontal,"
+             "tension_horizontal_core,tension_horizontal_shell,"
+             "tension_average,length_unloaded\n");
+}
@@ -0,0 +1,472 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/benchmark_runner.h"
+
+#ifdef __WXMSW__
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#endif
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#include "appcommon/widgets/timer.h"
+#include "models/base/helper.h"
+#include "wx/file.h"
+#include "wx/filename.h"
+#include "wx/wx.h"
+
+#include "spananalyzer/span_analyzer_app.h"
+#include "spananalyzer/span_analyzer_doc.h"
+#include "spananalyzer/span_analyzer_view.h"
+#include "spananalyzer/worker_pool.h"
+
+BenchmarkRunner::BenchmarkRunner(wxDocManager* manager) {
+  manager_ = manager;
+}
+
+BenchmarkRunner::~BenchmarkRunner() {
+}
+
+bool BenchmarkRunner::Run() {
+  std::string message;
+
+  // checks for a valid document file
+  if (wxFileName::FileExists(filepath_doc_) == false) {
+    message = filepath_doc_ + "  --  Benchmark document doesn't exist.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  // generates default thread counts if none are specified
+  if (threads_.empty() == true) {
+    const int num_cpus = WorkerPool::NumThreads(0);
+
+    for (int num = 1; num < num_cpus; num *= 2) {
+      threads_.push_back(num);
+    }
+    threads_.push_back(num_cpus);
+  }
+
+  // benchmarks the cable polynomials, which doesn't depend on the document
+  if (RunPolynomials() == false) {
+    return false;
+  }
+
+  // runs the benchmark for every thread count
+  measurements_.clear();
+  for (auto iter = threads_.cbegin(); iter != threads_.cend(); iter++) {
+    const int& num_threads = *iter;
+
+    message = "Running benchmark with " + std::to_string(num_threads)
+              + " thread(s).";
+    wxLogMessage(message.c_str());
+
+    BenchmarkMeasurement measurement;
+    if (RunSingle(num_threads, measurement) == false) {
+      message = "Benchmark run with " + std::to_string(num_threads)
+                + " thread(s) failed. Aborting benchmark.";
+      wxLogError(message.c_str());
+      return false;
+    }
+
+    measurements_.push_back(measurement);
+
+    message = "Open = "
+              + helper::DoubleToString(measurement.time_open, 3, true)
+              + "s, Analysis = "
+              + helper::DoubleToString(measurement.time_analysis, 3, true)
+              + "s, Reports = "
+              + helper::DoubleToString(measurement.time_reports, 3, true)
+              + "s, Save = "
+              + helper::DoubleToString(measurement.time_save, 3, true)
+              + "s, Memory = "
+              + std::to_string(measurement.memory_start) + "kB -> "
+              + std::to_string(measurement.memory_peak) + "kB (peak) -> "
+              + std::to_string(measurement.memory_end) + "kB";
+    wxLogMessage(message.c_str());
+  }
+
+  // writes results
+  return WriteResults();
+}
+
+std::string BenchmarkRunner::filepath_doc() const {
+  return filepath_doc_;
+}
+
+std::string BenchmarkRunner::filepath_results() const {
+  return filepath_results_;
+}
+
+const std::list<BenchmarkMeasurement>& BenchmarkRunner::measurements() const {
+  return measurements_;
+}
+
+const std::list<BenchmarkPolynomialMeasurement>&
+    BenchmarkRunner::measurements_polynomials() const {
+  return measurements_polynomials_;
+}
+
+void BenchmarkRunner::set_filepath_doc(const std::string& filepath_doc) {
+  filepath_doc_ = filepath_doc;
+}
+
+void BenchmarkRunner::set_filepath_results(
+    const std::string& filepath_results) {
+  filepath_results_ = filepath_results;
+}
+
+void BenchmarkRunner::set_threads(const std::list<int>& threads) {
+  threads_ = threads;
+}
+
+const std::list<int>& BenchmarkRunner::threads() const {
+  return threads_;
+}
+
+long BenchmarkRunner::MemoryPeak() {
+#ifdef __WXMSW__
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                           sizeof(counters)) == 0) {
+    return -1;
+  }
+  return static_cast<long>(counters.PeakWorkingSetSize / 1024);
+#elif defined(__linux__)
+  // the high-water mark is listed in kilobytes
+  FILE* file = std::fopen("/proc/self/status", "r");
+  if (file == nullptr) {
+    return -1;
+  }
+
+  long peak = -1;
+  char line[256];
+  while (std::fgets(line, sizeof(line), file) != nullptr) {
+    if (std::strncmp(line, "VmHWM:", 6) == 0) {
+      if (std::sscanf(line + 6, "%ld", &peak) != 1) {
+        peak = -1;
+      }
+      break;
+    }
+  }
+  std::fclose(file);
+
+  return peak;
+#else
+  return -1;
+#endif
+}
+
+long BenchmarkRunner::MemoryResident() {
+#ifdef __WXMSW__
+  PROCESS_MEMORY_COUNTERS counters;
+  if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                           sizeof(counters)) == 0) {
+    return -1;
+  }
+  return static_cast<long>(counters.WorkingSetSize / 1024);
+#elif defined(__linux__)
+  // the second field is the resident set size, in pages
+  FILE* file = std::fopen("/proc/self/statm", "r");
+  if (file == nullptr) {
+    return -1;
+  }
+
+  long size = 0;
+  long resident = 0;
+  const int count = std::fscanf(file, "%ld %ld", &size, &resident);
+  std::fclose(file);
+  if (count != 2) {
+    return -1;
+  }
+
+  return resident * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+  return -1;
+#endif
+}
+
+void BenchmarkRunner::ResetMemoryPeak() {
+#ifdef __WXMSW__
+  SetProcessWorkingSetSize(GetCurrentProcess(), static_cast<SIZE_T>(-1),
+                           static_cast<SIZE_T>(-1));
+#elif defined(__linux__)
+  // writing 5 resets the high-water mark to the current resident memory
+  FILE* file = std::fopen("/proc/self/clear_refs", "w");
+  if (file == nullptr) {
+    wxLogWarning("Couldn't reset the peak memory. The peak carries over from "
+                 "previous runs.");
+    return;
+  }
+
+  std::fputs("5", file);
+  std::fclose(file);
+#endif
+}
+
+bool BenchmarkRunner::RunPolynomials() {
+  std::string message;
+
+  // compiles the polynomials of every loaded cable
+  std::list<CablePolynomials> polynomials_cables;
+  std::list<std::string> names;
+  std::list<const PolynomialEvaluator*> polynomials;
+  const std::list<CableFile*>& cablefiles = wxGetApp().data()->cablefiles;
+  for (auto iter = cablefiles.cbegin(); iter != cablefiles.cend(); iter++) {
+    const CableFile* cablefile = *iter;
+    const std::string& name = cablefile->cable.name;
+
+    polynomials_cables.push_back(CablePolynomials());
+    CablePolynomials& polynomials_cable = polynomials_cables.back();
+    polynomials_cable.Compile(cablefile->cable);
+
+    names.push_back(name + " core creep");
+    polynomials.push_back(&polynomials_cable.core_creep);
+    names.push_back(name + " core load-strain");
+    polynomials.push_back(&polynomials_cable.core_loadstrain);
+    names.push_back(name + " shell creep");
+    polynomials.push_back(&polynomials_cable.shell_creep);
+    names.push_back(name + " shell load-strain");
+    polynomials.push_back(&polynomials_cable.shell_loadstrain);
+  }
+
+  // evaluates each polynomial over the strain range (in percent) that the
+  // polynomials are fitted to
+  // the sums are compared so the evaluations can't be optimized away, and to
+  // check that the evaluators agree
+  const int kSizePoints = 1000000;
+  const double kStep = 1.0 / kSizePoints;
+
+  measurements_polynomials_.clear();
+  Timer timer;
+  auto iter_name = names.cbegin();
+  for (auto iter = polynomials.cbegin(); iter != polynomials.cend();
+       iter++, iter_name++) {
+    const PolynomialEvaluator* polynomial = *iter;
+
+    double sum_generic = 0;
+    timer.Start();
+    for (int i = 0; i < kSizePoints; i++) {
+      sum_generic += polynomial->ValueGeneric(i * kStep);
+    }
+    timer.Stop();
+    const double time_generic = timer.Duration();
+
+    double sum_compiled = 0;
+    timer.Start();
+    for (int i = 0; i < kSizePoints; i++) {
+      sum_compiled += polynomial->Value(i * kStep);
+    }
+    timer.Stop();
+    const double time_compiled = timer.Duration();
+
+    if (1e-9 * (std::abs(sum_generic) + 1)
+        < std::abs(sum_compiled - sum_generic)) {
+      message = *iter_name + "  --  Polynomial evaluators don't match.";
+      wxLogError(message.c_str());
+    }
+
+    BenchmarkPolynomialMeasurement measurement;
+    measurement.degree = polynomial->degree();
+    measurement.form = polynomial->form();
+    measurement.name = *iter_name;
+    measurement.time_compiled = time_compiled * 1e9 / kSizePoints;
+    measurement.time_generic = time_generic * 1e9 / kSizePoints;
+    measurements_polynomials_.push_back(measurement);
+  }
+
+  // writes the results next to the results file
+  wxFileName filename_results(filepath_results_);
+  filename_results.SetName(filename_results.GetName() + "_polynomials");
+
+  wxFile file;
+  if (file.Create(filename_results.GetFullPath(), true) == false) {
+    message = filename_results.GetFullPath() + "  --  Couldn't create "
+              "benchmark polynomial results file.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  std::string line = "polynomial,degree,form,time_generic_ns,"
+                     "time_compiled_ns,speedup\n";
+  file.Write(line);
+
+  for (auto iter = measurements_polynomials_.cbegin();
+       iter != measurements_polynomials_.cend(); iter++) {
+    const BenchmarkPolynomialMeasurement& measurement = *iter;
+
+    std::string str_form;
+    if (measurement.form == PolynomialEvaluator::FormType::kEstrin) {
+      str_form = "Estrin";
+    } else if (measurement.form == PolynomialEvaluator::FormType::kHorner) {
+      str_form = "Horner";
+    } else {
+      str_form = "Generic";
+    }
+
+    double speedup = 0;
+    if (0 < measurement.time_compiled) {
+      speedup = measurement.time_generic / measurement.time_compiled;
+    }
+
+    line = measurement.name + ","
+           + std::to_string(measurement.degree) + ","
+           + str_form + ","
+           + helper::DoubleToString(measurement.time_generic, 3, true) + ","
+           + helper::DoubleToString(measurement.time_compiled, 3, true) + ","
+           + helper::DoubleToString(speedup, 3, true) + "\n";
+    file.Write(line);
+  }
+
+  file.Close();
+
+  message = "Benchmarked " + std::to_string(measurements_polynomials_.size())
+            + " cable polynomial(s).";
+  wxLogMessage(message.c_str());
+
+  return true;
+}
+
+bool BenchmarkRunner::RunSingle(const int& num_threads,
+                                BenchmarkMeasurement& measurement) {
+  Timer timer;
+
+  // records the resident memory before the document is opened, and resets
+  // the peak so it only covers this run
+  measurement.memory_start = MemoryResident();
+  ResetMemoryPeak();
+
+  // opens the document
+  timer.Start();
+  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(
+      manager_->CreateDocument(filepath_doc_, wxDOC_SILENT));
+  timer.Stop();
+  if (doc == nullptr) {
+    wxLogError("Couldn't open benchmark document.");
+    return false;
+  }
+  measurement.time_open = timer.Duration();
+
+  const int kSizeSpans = doc->spans().size();
+  measurement.num_spans = kSizeSpans;
+  measurement.num_threads = num_threads;
+  measurement.num_weathercases = wxGetApp().data()->weathercases.size();
+
+  doc->set_max_threads_analysis(num_threads);
+
+  // activates every span, which analyzes it, and updates the views
+  // the analysis and view updates are timed separately
+  // the view updates are only queued by the document, and the frame is never
+  // shown, so they are flushed to every pane regardless of visibility
+  SpanAnalyzerView* view = dynamic_cast<SpanAnalyzerView*>(doc->GetFirstView());
+  double time_analysis = 0;
+  double time_reports = 0;
+  UpdateHint hint(UpdateHint::Type::kSpansEdit);
+  for (int i = 0; i < kSizeSpans; i++) {
+    timer.Start();
+    doc->set_index_activated(i);
+    timer.Stop();
+    time_analysis += timer.Duration();
+
+    timer.Start();
+    doc->UpdateAllViews(nullptr, &hint);
+    if (view != nullptr) {
+      view->FlushUpdates(true);
+    }
+    timer.Stop();
+    time_reports += timer.Duration();
+  }
+  doc->set_index_activated(-1);
+
+  measurement.time_analysis = time_analysis;
+  measurement.time_reports = time_reports;
+
+  // saves the document to a temporary file next to the results file
+  wxFileName filename_save(filepath_results_);
+  filename_save.SetName(filename_save.GetName() + "_save");
+  filename_save.SetExt("spananalyzer");
+
+  // waits for the background save so the whole write is timed
+  timer.Start();
+  bool status_save = doc->OnSaveDocument(filename_save.GetFullPath());
+  if (wxGetApp().controller_save()->Wait() == false) {
+    status_save = false;
+  }
+  timer.Stop();
+  measurement.time_save = timer.Duration();
+
+  if (filename_save.FileExists() == true) {
+    wxRemoveFile(filename_save.GetFullPath());
+  }
+
+  // records the resident memory while the document and results are loaded,
+  // and the peak of the run
+  measurement.memory_end = MemoryResident();
+  measurement.memory_peak = MemoryPeak();
+
+  // closes the document without prompting
+  manager_->CloseDocument(doc, true);
+
+  return status_save;
+}
+
+bool BenchmarkRunner::WriteResults() const {
+  std::string message;
+
+  wxFile file;
+  if (file.Create(filepath_results_, true) == false) {
+    message = filepath_results_ + "  --  Couldn't create benchmark results "
+              "file.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  // writes header
+  std::string line = "threads,spans,weathercases,time_open,time_analysis,"
+                     "time_reports,time_save,speedup_analysis,"
+                     "efficiency_analysis,memory_start_kb,memory_peak_kb,"
+                     "memory_end_kb\n";
+  file.Write(line);
+
+  // writes a line for each measurement
+  // the speedup and efficiency are relative to the first measurement
+  const BenchmarkMeasurement& reference = measurements_.front();
+  for (auto iter = measurements_.cbegin(); iter != measurements_.cend();
+       iter++) {
+    const BenchmarkMeasurement& measurement = *iter;
+
+    double speedup = 0;
+    if (0 < measurement.time_analysis) {
+      speedup = reference.time_analysis / measurement.time_analysis;
+    }
+
+    const double efficiency = speedup * reference.num_threads
+                              / measurement.num_threads;
+
+    line = std::to_string(measurement.num_threads) + ","
+           + std::to_string(measurement.num_spans) + ","
+           + std::to_string(measurement.num_weathercases) + ","
+           + helper::DoubleToString(measurement.time_open, 4, true) + ","
+           + helper::DoubleToString(measurement.time_analysis, 4, true) + ","
+           + helper::DoubleToString(measurement.time_reports, 4, true) + ","
+           + helper::DoubleToString(measurement.time_save, 4, true) + ","
+           + helper::DoubleToString(speedup, 3, true) + ","
+           + helper::DoubleToString(efficiency, 3, true) + ","
+           + std::to_string(measurement.memory_start) + ","
+           + std::to_string(measurement.memory_peak) + ","
+           + std::to_string(measurement.memory_end) + "\n";
+    file.Write(line);
+  }
+
+  file.Close();
+
+  message = "Benchmark results written to: " + filepath_results_;
+  wxLogMessage(message.c_str());
+
+  return true;
+}
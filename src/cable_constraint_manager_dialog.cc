@@ -9,6 +9,8 @@
 #include "wx/xrc/xmlres.h"
 
 #include "spananalyzer/cable_constraint_editor_dialog.h"
+#include "spananalyzer/display_unit_converter.h"
+#include "spananalyzer/span_analyzer_app.h"
 
 BEGIN_EVENT_TABLE(CableConstraintManagerDialog, wxDialog)
   EVT_BUTTON(XRCID("button_add"), CableConstraintManagerDialog::OnButtonAdd)
@@ -39,6 +41,7 @@ CableConstraintManagerDialog::CableConstraintManagerDialog(
   cablefiles_ = cablefiles;
   weathercases_ = weathercases;
   units_ = &units;
+  units_model_ = wxGetApp().units_model();
   constraints_ = constraints;
 
   // makes copies so user can modify
@@ -81,9 +84,10 @@ void CableConstraintManagerDialog::OnButtonAdd(wxCommandEvent& event) {
 
   wxBusyCursor cursor;
 
-  // converts units to consistent unit style
+  // converts units to consistent unit style and the model unit system
   CableConstraintUnitConverter::ConvertUnitStyleToConsistent(
       0, *units_, constraint);
+  DisplayUnitConverter::ConvertUnitSystem(*units_, units_model_, constraint);
 
   // adds to modified list
   if (index_selected_ == wxNOT_FOUND) {
@@ -156,7 +160,8 @@ void CableConstraintManagerDialog::OnButtonEdit(wxCommandEvent& event) {
   auto iter = std::next(constraints_modified_.begin(), index_selected_);
   CableConstraint constraint = *iter;
 
-  // converts units to different unit style
+  // converts units to the display unit system and different unit style
+  DisplayUnitConverter::ConvertUnitSystem(units_model_, *units_, constraint);
   CableConstraintUnitConverter::ConvertUnitStyleToDifferent(
       *units_, constraint);
 
@@ -169,9 +174,10 @@ void CableConstraintManagerDialog::OnButtonEdit(wxCommandEvent& event) {
 
   wxBusyCursor cursor;
 
-  // converts units to consistent unit style
+  // converts units to consistent unit style and the model unit system
   CableConstraintUnitConverter::ConvertUnitStyleToConsistent(
       0, *units_, constraint);
+  DisplayUnitConverter::ConvertUnitSystem(*units_, units_model_, constraint);
 
   // transfers edited constraint to list
   *iter = constraint;
@@ -305,8 +311,12 @@ void CableConstraintManagerDialog::UpdateListCtrlRow(
     str_type = "Support";
   }
 
-  // gets limit string
-  std::string str_limit = helper::DoubleToString(constraint.limit, 2, true);
+  // gets limit string in the display unit system
+  const double limit = DisplayUnitConverter::ConvertUnitSystem(
+      units_model_, *units_,
+      DisplayUnitConverter::QuantityTypeLimit(constraint.type_limit),
+      constraint.limit);
+  std::string str_limit = helper::DoubleToString(limit, 2, true);
 
   // modifies listctrl
   listctrl_->SetItem(index, 0, constraint.note);
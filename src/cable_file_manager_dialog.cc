@@ -38,6 +38,7 @@ CableFileManagerDialog::CableFileManagerDialog(
 
   listctrl_ = XRCCTRL(*this, "listctrl_cables", wxListCtrl);
   units_ = units;
+  units_model_ = wxGetApp().units_model();
 
   index_selected_ = wxNOT_FOUND;
 
@@ -96,22 +97,14 @@ void CableFileManagerDialog::DeleteExtraCableFiles(
 }
 
 bool CableFileManagerDialog::IsReferencedByDocument(
-    const std::string& name) const {
+    const Cable* cable) const {
   // gets document
   const SpanAnalyzerDoc* doc = wxGetApp().GetDocument();
   if (doc == nullptr) {
     return false;
   }
 
-  // scans all spans to see if cable name is referenced
-  for (auto iter = doc->spans().cbegin(); iter != doc->spans().cend(); iter++) {
-    const Span& span = *iter;
-    if (span.linecable.cable()->name == name) {
-      return true;
-    }
-  }
-
-  return false;
+  return doc->IsReferenced(cable);
 }
 
 bool CableFileManagerDialog::IsUniqueName(const std::string& name,
@@ -171,7 +164,7 @@ void CableFileManagerDialog::OnButtonAdd(wxCommandEvent& event) {
       CableFile cablefile;
       cablefile.filepath = path;
       const int status = FileHandler::LoadCable(cablefile.filepath,
-        units_, cablefile.cable);
+        units_model_, cablefile.cable);
       if (status != 0) {
         continue;
       }
@@ -240,7 +233,9 @@ void CableFileManagerDialog::OnButtonEdit(wxCommandEvent& event) {
   auto iter = std::next(cablefiles_modified_.begin(), index_selected_);
   CableFile cablefile = **iter;
 
-  // converts units to different unit style
+  // converts units to the display unit system and different unit style
+  CableUnitConverter::ConvertUnitSystem(units_model_, units_, true,
+                                        cablefile.cable);
   CableUnitConverter::ConvertUnitStyleToDifferent(
       units_,
       true,
@@ -267,15 +262,17 @@ void CableFileManagerDialog::OnButtonEdit(wxCommandEvent& event) {
 
   wxBusyCursor cursor;
 
-  // converts units to consistent unit style
+  // converts units to consistent unit style and the model unit system
   CableUnitConverter::ConvertUnitStyleToConsistent(
       0,
       units_,
       true,
       cablefile.cable);
+  CableUnitConverter::ConvertUnitSystem(units_, units_model_, true,
+                                        cablefile.cable);
 
   // saves cable to filesystem
-  FileHandler::SaveCable(cablefile.filepath, cablefile.cable, units_);
+  FileHandler::SaveCable(cablefile.filepath, cablefile.cable, units_model_);
 
   // transfers copied cable to original
   **iter = cablefile;
@@ -344,12 +341,14 @@ void CableFileManagerDialog::OnButtonNew(wxCommandEvent& event) {
 
   wxBusyCursor cursor;
 
-  // converts units to consistent unit style
+  // converts units to consistent unit style and the model unit system
   CableUnitConverter::ConvertUnitStyleToConsistent(
       0,
       units_,
       true,
       cablefile.cable);
+  CableUnitConverter::ConvertUnitSystem(units_, units_model_, true,
+                                        cablefile.cable);
 
   // gets filepath to save cable
   wxFileDialog dialog_file(this, "Save Cable File", "", ".cable",
@@ -360,7 +359,7 @@ void CableFileManagerDialog::OnButtonNew(wxCommandEvent& event) {
   cablefile.filepath = dialog_file.GetPath();
 
   // saves file
-  FileHandler::SaveCable(cablefile.filepath, cablefile.cable, units_);
+  FileHandler::SaveCable(cablefile.filepath, cablefile.cable, units_model_);
 
   // determines if new cable was saved over loaded cable file
   int index_existing = wxNOT_FOUND;
@@ -438,7 +437,7 @@ void CableFileManagerDialog::OnButtonRemove(wxCommandEvent& event) {
   const CableFile* cablefile = *iter;
 
   // checks if the cablefile is referenced by the document
-  bool is_referenced = IsReferencedByDocument(cablefile->cable.name);
+  bool is_referenced = IsReferencedByDocument(&cablefile->cable);
   if (is_referenced == true) {
     std::string message = cablefile->filepath + "  --  "
                           "Cable file is currently referenced by the open "
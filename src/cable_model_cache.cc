@@ -0,0 +1,383 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/cable_model_cache.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+/// \brief Appends the bytes of a value to a key.
+/// \param[in] value
+///   The value.
+/// \param[in,out] key
+///   The key.
+template<typename T>
+void AppendKey(const T& value, std::string& key) {
+  key.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+/// \var kComponents
+///   The component types, in array index order.
+const CableElongationModel::ComponentType kComponents[3] = {
+    CableElongationModel::ComponentType::kCombined,
+    CableElongationModel::ComponentType::kCore,
+    CableElongationModel::ComponentType::kShell};
+
+/// \var kSizeTableMax
+///   The maximum number of intervals in a lookup table.
+const int kSizeTableMax = 8192;
+
+/// \var kSizeTableMin
+///   The initial number of intervals in a lookup table.
+const int kSizeTableMin = 256;
+
+/// \var kStrainTableMax
+///   The last strain in the lookup tables. This includes the plotted range.
+const double kStrainTableMax = 0.012;
+
+/// \var kStrainTableMin
+///   The first strain in the lookup tables. This includes the plotted range.
+const double kStrainTableMin = -0.002;
+
+/// \var kToleranceTable
+///   The interpolation error tolerance of the lookup tables, relative to the
+///   cable rated strength.
+const double kToleranceTable = 1e-6;
+
+}  // namespace
+
+CompiledCableModel::CompiledCableModel() {
+  error_ = 0;
+  is_tabulated_ = false;
+
+  for (int i = 0; i < 3; i++) {
+    strains_unloaded_[i] = 0;
+  }
+}
+
+CompiledCableModel::~CompiledCableModel() {
+}
+
+bool CompiledCableModel::Compile(const Cable* cable, const CableState& state,
+                                 const CableStretchState& state_stretch,
+                                 const bool& is_tabulated) {
+  cable_.set_cable_base(cable);
+
+  model_.set_cable(&cable_);
+  model_.set_state(state);
+  model_.set_state_stretch(state_stretch);
+
+  // validating also updates the model, so it isn't modified when shared
+  if (model_.Validate(false, nullptr) == false) {
+    return false;
+  }
+
+  // solves the unloaded strains
+  for (int i = 0; i < 3; i++) {
+    strains_unloaded_[i] = model_.Strain(kComponents[i], 0);
+  }
+
+  // solves the breakpoints
+  // the components start carrying load at the unloaded strain, and switch
+  // from the polynomial to a linear extension at the polynomial load limits
+  breakpoints_.clear();
+  const CableComponent* components[2] = {&cable->component_core,
+                                         &cable->component_shell};
+  for (int i = 0; i < 2; i++) {
+    const CableComponent* component = components[i];
+    const CableElongationModel::ComponentType& type_component =
+        kComponents[i + 1];
+
+    breakpoints_.push_back(strains_unloaded_[i + 1]);
+
+    const double limits[2] = {component->load_limit_polynomial_creep,
+                              component->load_limit_polynomial_loadstrain};
+    for (int j = 0; j < 2; j++) {
+      if (0 < limits[j]) {
+        breakpoints_.push_back(model_.Strain(type_component, limits[j]));
+      }
+    }
+  }
+
+  // the stretch load sets where the curves switch from the stretched modulus
+  // back to the polynomial
+  if (0 < state_stretch.load) {
+    breakpoints_.push_back(model_.Strain(
+        CableElongationModel::ComponentType::kCombined, state_stretch.load));
+  }
+
+  std::sort(breakpoints_.begin(), breakpoints_.end());
+
+  // builds the lookup tables
+  is_tabulated_ = is_tabulated;
+  error_ = 0;
+  if (is_tabulated_ == true) {
+    for (int i = 0; i < 3; i++) {
+      UpdateTable(kComponents[i], tables_[i]);
+      error_ = std::max(error_, tables_[i].error);
+    }
+  }
+
+  return true;
+}
+
+double CompiledCableModel::Load(
+    const CableElongationModel::ComponentType& type_component,
+    const double& strain) const {
+  if (is_tabulated_ == false) {
+    return model_.Load(type_component, strain);
+  }
+
+  // finds the table interval
+  const CableModelTable& table = tables_[IndexComponent(type_component)];
+  const double position = (strain - table.x_min) / table.step;
+  const int kSizeIntervals = table.is_exact.size();
+  if ((position < 0) || (kSizeIntervals <= position)) {
+    return model_.Load(type_component, strain);
+  }
+
+  const int index = static_cast<int>(position);
+  if (table.is_exact[index] == true) {
+    return model_.Load(type_component, strain);
+  }
+
+  // interpolates within the interval
+  const double fraction = position - index;
+  return table.values[index]
+         + fraction * (table.values[index + 1] - table.values[index]);
+}
+
+long CompiledCableModel::SizeMemory() const {
+  long size = sizeof(*this);
+  size += breakpoints_.capacity() * sizeof(double);
+  for (int i = 0; i < 3; i++) {
+    size += tables_[i].is_exact.capacity() * sizeof(char);
+    size += tables_[i].values.capacity() * sizeof(double);
+  }
+
+  return size;
+}
+
+double CompiledCableModel::Strain(
+    const CableElongationModel::ComponentType& type_component,
+    const double& load) const {
+  return model_.Strain(type_component, load);
+}
+
+double CompiledCableModel::StrainUnloaded(
+    const CableElongationModel::ComponentType& type_component) const {
+  return strains_unloaded_[IndexComponent(type_component)];
+}
+
+const std::vector<double>& CompiledCableModel::breakpoints() const {
+  return breakpoints_;
+}
+
+const SagTensionCable* CompiledCableModel::cable() const {
+  return &cable_;
+}
+
+double CompiledCableModel::error() const {
+  return error_;
+}
+
+bool CompiledCableModel::is_tabulated() const {
+  return is_tabulated_;
+}
+
+const CableElongationModel* CompiledCableModel::model() const {
+  return &model_;
+}
+
+int CompiledCableModel::IndexComponent(
+    const CableElongationModel::ComponentType& type_component) {
+  if (type_component == CableElongationModel::ComponentType::kCore) {
+    return 1;
+  } else if (type_component == CableElongationModel::ComponentType::kShell) {
+    return 2;
+  } else {
+    return 0;
+  }
+}
+
+void CompiledCableModel::UpdateTable(
+    const CableElongationModel::ComponentType& type_component,
+    CableModelTable& table) const {
+  const double tolerance = kToleranceTable * *cable_.strength_rated();
+
+  table.x_min = kStrainTableMin;
+
+  // refines the table until every interval midpoint is within the tolerance
+  int size = kSizeTableMin;
+  while (true) {
+    table.step = (kStrainTableMax - kStrainTableMin) / size;
+
+    table.values.resize(size + 1);
+    for (int i = 0; i <= size; i++) {
+      table.values[i] = model_.Load(type_component,
+                                    table.x_min + i * table.step);
+    }
+
+    // flags the intervals that contain a breakpoint
+    table.is_exact.assign(size, false);
+    for (auto iter = breakpoints_.cbegin(); iter != breakpoints_.cend();
+         iter++) {
+      const int index = static_cast<int>(
+          std::floor((*iter - table.x_min) / table.step));
+      if ((0 <= index) && (index < size)) {
+        table.is_exact[index] = true;
+      }
+    }
+
+    // checks the interpolation error at the midpoints
+    // the intervals that exceed the tolerance are flagged, and only solved
+    // exactly if the table can't be refined further
+    table.error = 0;
+    bool is_refined = false;
+    for (int i = 0; i < size; i++) {
+      if (table.is_exact[i] == true) {
+        continue;
+      }
+
+      const double load = model_.Load(type_component,
+                                      table.x_min + (i + 0.5) * table.step);
+      const double error =
+          std::abs(load - (table.values[i] + table.values[i + 1]) / 2);
+      if (tolerance < error) {
+        if (size < kSizeTableMax) {
+          is_refined = true;
+          break;
+        }
+        table.is_exact[i] = true;
+      } else {
+        table.error = std::max(table.error, error);
+      }
+    }
+
+    if (is_refined == false) {
+      break;
+    }
+
+    size = size * 2;
+  }
+}
+
+
+CableModelCache::CableModelCache() {
+  size_budget_ = 0;
+  size_memory_ = 0;
+}
+
+CableModelCache::~CableModelCache() {
+}
+
+void CableModelCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  size_memory_ = 0;
+}
+
+std::shared_ptr<const CompiledCableModel> CableModelCache::Model(
+    const Cable* cable, const CableState& state,
+    const CableStretchState& state_stretch, const bool& is_tabulated) {
+  if (cable == nullptr) {
+    return nullptr;
+  }
+
+  const std::string key = Key(cable, state, state_stretch);
+
+  // searches for a cached model, and marks it as most recently used
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = index_.find(key);
+    if ((iter != index_.end())
+        && ((is_tabulated == false)
+            || (iter->second->model->is_tabulated() == true))) {
+      entries_.splice(entries_.begin(), entries_, iter->second);
+      return entries_.front().model;
+    }
+  }
+
+  // compiles a new model without the cache locked
+  std::shared_ptr<CompiledCableModel> model(new CompiledCableModel());
+  if (model->Compile(cable, state, state_stretch, is_tabulated) == false) {
+    return nullptr;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // keeps a model that another thread cached while this one was compiling
+  auto iter = index_.find(key);
+  if (iter != index_.end()) {
+    if ((is_tabulated == false)
+        || (iter->second->model->is_tabulated() == true)) {
+      entries_.splice(entries_.begin(), entries_, iter->second);
+      return entries_.front().model;
+    }
+
+    // removes the model without tables, which is replaced
+    size_memory_ -= iter->second->size;
+    entries_.erase(iter->second);
+    index_.erase(iter);
+  }
+
+  // caches the new model and evicts models over the budget
+  Entry entry;
+  entry.key = key;
+  entry.model = model;
+  entry.size = model->SizeMemory();
+
+  size_memory_ += entry.size;
+  entries_.push_front(entry);
+  index_[key] = entries_.begin();
+
+  Evict();
+
+  return model;
+}
+
+void CableModelCache::set_size_budget(const long& size_budget) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_budget_ = size_budget;
+  Evict();
+}
+
+int CableModelCache::size() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+long CableModelCache::size_budget() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_budget_;
+}
+
+long CableModelCache::size_memory() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return size_memory_;
+}
+
+void CableModelCache::Evict() {
+  // removes from the least recently used model
+  while ((size_budget_ < size_memory_) && (entries_.empty() == false)) {
+    const Entry& entry = entries_.back();
+    size_memory_ -= entry.size;
+    index_.erase(entry.key);
+    entries_.pop_back();
+  }
+}
+
+std::string CableModelCache::Key(const Cable* cable, const CableState& state,
+                                 const CableStretchState& state_stretch) {
+  std::string key;
+  AppendKey(cable, key);
+  AppendKey(state.temperature, key);
+  AppendKey(state.type_polynomial, key);
+  AppendKey(state_stretch.load, key);
+  AppendKey(state_stretch.temperature, key);
+  AppendKey(state_stretch.type_polynomial, key);
+  return key;
+}
@@ -3,6 +3,8 @@
 
 #include "spananalyzer/cable_plot_pane.h"
 
+#include <memory>
+
 #include "appcommon/graphics/circle_renderer_2d.h"
 #include "appcommon/graphics/line_renderer_2d.h"
 #include "appcommon/graphics/text_renderer_2d.h"
@@ -11,6 +13,7 @@
 #include "wx/dcbuffer.h"
 
 #include "spananalyzer/cable_plot_options_dialog.h"
+#include "spananalyzer/display_unit_converter.h"
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_doc.h"
 #include "spananalyzer/span_analyzer_view.h"
@@ -191,11 +194,13 @@ void CablePlotPane::OnMouse(wxMouseEvent& event) {
   point_graphics.y = event.GetY();
   const Point2d<float> point_data = plot_.PointGraphicsToData(point_graphics);
 
-  // logs to status bar
+  // logs to status bar in the display unit system
+  const double y = DisplayUnitConverter::ToDisplay(
+      DisplayUnitConverter::QuantityType::kForce, point_data.y);
   std::string str = "X="
                     + helper::DoubleToString(point_data.x, 5, true)
                     + "   Y="
-                    + helper::DoubleToString(point_data.y, 2, true);
+                    + helper::DoubleToString(y, 2, true);
 
   status_bar_log::SetText(str, 1);
 }
@@ -262,7 +267,10 @@ void CablePlotPane::UpdateDataSetAxes(
 
   text = new Text2d();
   text->angle = 0;
-  text->message = helper::DoubleToString(y_min, 0, true) + " ";
+  text->message = helper::DoubleToString(
+      DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kForce, y_min),
+      0, true) + " ";
   text->offset = Point2d<int>(-5, 5);
   text->point.x = 0;
   text->point.y = y_min;
@@ -271,7 +279,10 @@ void CablePlotPane::UpdateDataSetAxes(
 
   text = new Text2d();
   text->angle = 0;
-  text->message = helper::DoubleToString(y_max, 0, true) + " ";
+  text->message = helper::DoubleToString(
+      DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kForce, y_max),
+      0, true) + " ";
   text->offset = Point2d<int>(-5, 0);
   text->point.x = 0;
   text->point.y = y_max;
@@ -280,7 +291,7 @@ void CablePlotPane::UpdateDataSetAxes(
 }
 
 void CablePlotPane::UpdateDataSetCable(
-    const CableElongationModel& model,
+    const CompiledCableModel& model,
     const CableElongationModel::ComponentType& type_component,
     LineDataSet2d& dataset) {
   // calculates points
@@ -316,7 +327,7 @@ void CablePlotPane::UpdateDataSetCable(
 }
 
 void CablePlotPane::UpdateDataSetMarker(
-    const CableElongationModel& model,
+    const CompiledCableModel& model,
     const SagTensionAnalysisResult* result) {
   // calculates points
   Point2d<double> point;
@@ -378,25 +389,27 @@ void CablePlotPane::UpdatePlotDatasets() {
 
   // gets filtered result from doc
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  const SagTensionAnalysisResult* result = doc->Result(index,
-                                                       filter->condition);
-  if (result == nullptr) {
+  SagTensionAnalysisResult result_filter;
+  if (doc->Result(index, filter->condition, result_filter) == false) {
     return;
   }
+  const SagTensionAnalysisResult* result = &result_filter;
 
-  // creates a cable elongation model
+  // gets the compiled cable model, with lookup tables for the plot curves
+  // the model is cached, so it is only compiled the first time the result is
+  // plotted
   const Span* span = doc->SpanActivated();
+  const std::shared_ptr<const CompiledCableModel> model_compiled =
+      doc->cache_models()->Model(span->linecable.cable(), result->state,
+                                 *doc->StretchState(result->condition), true);
+  if (model_compiled == nullptr) {
+    return;
+  }
 
-  SagTensionCable cable;
-  cable.set_cable_base(span->linecable.cable());
-
-  CableElongationModel model;
-  model.set_cable(&cable);
-  model.set_state(result->state);
-  model.set_state_stretch(*doc->StretchState(result->condition));
+  const CompiledCableModel& model = *model_compiled;
 
   // updates datasets
-  UpdateDataSetAxes(0, 0.01, 0, *cable.strength_rated());
+  UpdateDataSetAxes(0, 0.01, 0, *model.cable()->strength_rated());
 
   UpdateStrains(model);
 
@@ -494,12 +507,12 @@ void CablePlotPane::UpdatePlotScaling() {
 }
 
 void CablePlotPane::UpdateStrains(
-    const CableElongationModel& model) {
+    const CompiledCableModel& model) {
   // gets the unloaded points
   const double strain_unloaded_core =
-      model.Strain(CableElongationModel::ComponentType::kCore, 0);
+      model.StrainUnloaded(CableElongationModel::ComponentType::kCore);
   const double strain_unloaded_shell =
-      model.Strain(CableElongationModel::ComponentType::kShell, 0);
+      model.StrainUnloaded(CableElongationModel::ComponentType::kShell);
 
   // adds evenly spaced points for the plot range
   const double kStrainBegin = -0.001;
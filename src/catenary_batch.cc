@@ -0,0 +1,391 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/catenary_batch.h"
+
+#include <cmath>
+#include <cstring>
+
+#include "spananalyzer/catenary_batch_kernel.h"
+
+#if defined(__SSE2__) || defined(_M_X64) \
+    || (defined(_M_IX86_FP) && (2 <= _M_IX86_FP))
+#define SPANANALYZER_CATENARY_BATCH_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace kernel = catenary_batch_kernel;
+
+namespace {
+
+/// \par OVERVIEW
+///
+/// This struct has the kernel operations for scalar instructions.
+struct ScalarOps {
+  typedef double Vector;
+  static const int kSize = 1;
+
+  static uint64_t Bits(const double& a) {
+    uint64_t bits;
+    std::memcpy(&bits, &a, sizeof(bits));
+    return bits;
+  }
+
+  static double FromBits(const uint64_t& bits) {
+    double a;
+    std::memcpy(&a, &bits, sizeof(a));
+    return a;
+  }
+
+  static double Add(const double& a, const double& b) { return a + b; }
+  static double And(const double& a, const double& b) {
+    return FromBits(Bits(a) & Bits(b));
+  }
+  static double Div(const double& a, const double& b) { return a / b; }
+  static double LessThan(const double& a, const double& b) {
+    return FromBits((a < b) ? ~0ULL : 0ULL);
+  }
+  static double Load(const double* p) { return *p; }
+  static double Max(const double& a, const double& b) {
+    return (a < b) ? b : a;
+  }
+  static double Min(const double& a, const double& b) {
+    return (b < a) ? b : a;
+  }
+  static double Mul(const double& a, const double& b) { return a * b; }
+  static double Or(const double& a, const double& b) {
+    return FromBits(Bits(a) | Bits(b));
+  }
+  static double Select(const double& mask, const double& a,
+                       const double& b) {
+    return (Bits(mask) != 0) ? a : b;
+  }
+  static double Set(const double& a) { return a; }
+  static double SetBits(const uint64_t& bits) { return FromBits(bits); }
+  static double ShiftLeft52(const double& a) {
+    return FromBits(Bits(a) << 52);
+  }
+  static double ShiftRight52(const double& a) {
+    return FromBits(Bits(a) >> 52);
+  }
+  static double Sqrt(const double& a) { return std::sqrt(a); }
+  static void Store(double* p, const double& a) { *p = a; }
+  static double Sub(const double& a, const double& b) { return a - b; }
+};
+
+#ifdef SPANANALYZER_CATENARY_BATCH_SSE2
+/// \par OVERVIEW
+///
+/// This struct has the kernel operations for SSE2 instructions.
+struct Sse2Ops {
+  typedef __m128d Vector;
+  static const int kSize = 2;
+
+  static __m128d Add(const __m128d& a, const __m128d& b) {
+    return _mm_add_pd(a, b);
+  }
+  static __m128d And(const __m128d& a, const __m128d& b) {
+    return _mm_and_pd(a, b);
+  }
+  static __m128d Div(const __m128d& a, const __m128d& b) {
+    return _mm_div_pd(a, b);
+  }
+  static __m128d LessThan(const __m128d& a, const __m128d& b) {
+    return _mm_cmplt_pd(a, b);
+  }
+  static __m128d Load(const double* p) { return _mm_loadu_pd(p); }
+  static __m128d Max(const __m128d& a, const __m128d& b) {
+    return _mm_max_pd(a, b);
+  }
+  static __m128d Min(const __m128d& a, const __m128d& b) {
+    return _mm_min_pd(a, b);
+  }
+  static __m128d Mul(const __m128d& a, const __m128d& b) {
+    return _mm_mul_pd(a, b);
+  }
+  static __m128d Or(const __m128d& a, const __m128d& b) {
+    return _mm_or_pd(a, b);
+  }
+  static __m128d Select(const __m128d& mask, const __m128d& a,
+                        const __m128d& b) {
+    return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b));
+  }
+  static __m128d Set(const double& a) { return _mm_set1_pd(a); }
+  static __m128d SetBits(const uint64_t& bits) {
+    return _mm_castsi128_pd(_mm_set1_epi64x(static_cast<long long>(bits)));
+  }
+  static __m128d ShiftLeft52(const __m128d& a) {
+    return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(a), 52));
+  }
+  static __m128d ShiftRight52(const __m128d& a) {
+    return _mm_castsi128_pd(_mm_srli_epi64(_mm_castpd_si128(a), 52));
+  }
+  static __m128d Sqrt(const __m128d& a) { return _mm_sqrt_pd(a); }
+  static void Store(double* p, const __m128d& a) { _mm_storeu_pd(p, a); }
+  static __m128d Sub(const __m128d& a, const __m128d& b) {
+    return _mm_sub_pd(a, b);
+  }
+};
+#endif
+
+/// \brief Determines if the processor and operating system support AVX2.
+/// \return If AVX2 is supported.
+bool IsSupportedAvx2() {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+
+  // checks that the operating system saves the AVX registers
+  __cpuid(info, 1);
+  const bool is_osxsave = (info[2] & (1 << 27)) != 0;
+  const bool is_avx = (info[2] & (1 << 28)) != 0;
+  if ((is_osxsave == false) || (is_avx == false)) {
+    return false;
+  }
+  if ((_xgetbv(0) & 0x6) != 0x6) {
+    return false;
+  }
+
+  __cpuidex(info, 7, 0);
+  return (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2") != 0;
+#else
+  return false;
+#endif
+}
+
+/// \brief Solves the catenary plane coordinate parameters.
+/// \param[in] spacing_horizontal
+///   The horizontal end point spacing on the catenary plane.
+/// \param[in] spacing_vertical
+///   The vertical end point spacing on the catenary plane.
+/// \param[in] constant
+///   The catenary constant.
+/// \return The coordinate parameters.
+kernel::CoordinateParameters SolveCoordinateParameters(
+    const double& spacing_horizontal,
+    const double& spacing_vertical,
+    const double& constant) {
+  double x_start;
+  double x_end;
+  kernel::EndPoints<ScalarOps>(spacing_horizontal, spacing_vertical,
+                               constant, x_start, x_end);
+
+  kernel::CoordinateParameters parameters;
+  parameters.constant = constant;
+  parameters.length_start =
+      constant * kernel::Sinh<ScalarOps>(x_start / constant);
+  parameters.length = constant * kernel::Sinh<ScalarOps>(x_end / constant)
+                      - parameters.length_start;
+  parameters.x_start = x_start;
+  parameters.y_start =
+      constant * (kernel::Cosh<ScalarOps>(x_start / constant) - 1);
+  return parameters;
+}
+
+/// \brief Solves a quantity with the widest available instructions.
+/// \param[in] type
+///   The quantity type.
+/// \param[in] spacings_horizontal
+///   The horizontal end point spacings on the catenary plane.
+/// \param[in] spacings_vertical
+///   The vertical end point spacings on the catenary plane.
+/// \param[in] tensions_horizontal
+///   The horizontal tensions.
+/// \param[in] weights_unit
+///   The unit weight magnitudes.
+/// \param[in] size
+///   The number of catenaries.
+/// \param[out] values
+///   The quantity values.
+void SolveQuantityDispatch(const kernel::QuantityType& type,
+                           const double* spacings_horizontal,
+                           const double* spacings_vertical,
+                           const double* tensions_horizontal,
+                           const double* weights_unit,
+                           const int& size,
+                           double* values) {
+  int index = 0;
+  if (CatenaryBatch::instruction_set()
+      == CatenaryBatch::InstructionSet::kAvx2) {
+    index += kernel::SolveQuantityAvx2(type, spacings_horizontal,
+                                       spacings_vertical, tensions_horizontal,
+                                       weights_unit, size, values);
+  }
+
+#ifdef SPANANALYZER_CATENARY_BATCH_SSE2
+  index += kernel::SolveQuantity<Sse2Ops>(
+      type, spacings_horizontal + index, spacings_vertical + index,
+      tensions_horizontal + index, weights_unit + index, size - index,
+      values + index);
+#endif
+
+  kernel::SolveQuantity<ScalarOps>(
+      type, spacings_horizontal + index, spacings_vertical + index,
+      tensions_horizontal + index, weights_unit + index, size - index,
+      values + index);
+}
+
+}  // namespace
+
+CatenaryBatch::CatenaryBatch() {
+}
+
+CatenaryBatch::~CatenaryBatch() {
+}
+
+void CatenaryBatch::Append(const Catenary3d& catenary) {
+  const Vector3d spacing = catenary.spacing_endpoints();
+  const Vector3d weight = catenary.weight_unit();
+  const double weight_magnitude = weight.Magnitude();
+
+  // projects the spacing onto the catenary plane
+  const double length_chord = spacing.Magnitude();
+  const double spacing_vertical =
+      spacing.z() * (weight.z() / weight_magnitude);
+  const double spacing_horizontal = std::sqrt(
+      length_chord * length_chord - spacing_vertical * spacing_vertical);
+
+  spacings_horizontal_.push_back(spacing_horizontal);
+  spacings_vertical_.push_back(spacing_vertical);
+  tensions_horizontal_.push_back(catenary.tension_horizontal());
+  weights_unit_.push_back(weight_magnitude);
+}
+
+void CatenaryBatch::Clear() {
+  spacings_horizontal_.clear();
+  spacings_vertical_.clear();
+  tensions_horizontal_.clear();
+  weights_unit_.clear();
+}
+
+void CatenaryBatch::Coordinates(const Catenary3d& catenary,
+                                const std::vector<double>& positions,
+                                std::vector<Point3d<double>>& coordinates) {
+  coordinates.clear();
+  if (positions.empty() == true) {
+    return;
+  }
+
+  // gets the catenary plane parameters
+  CatenaryBatch batch;
+  batch.Append(catenary);
+  const double spacing_horizontal = batch.spacings_horizontal_.front();
+  const double spacing_vertical = batch.spacings_vertical_.front();
+  const double weight = batch.weights_unit_.front();
+  const double constant = catenary.tension_horizontal() / weight;
+
+  const kernel::CoordinateParameters parameters = SolveCoordinateParameters(
+      spacing_horizontal, spacing_vertical, constant);
+
+  // solves the catenary plane coordinates
+  const int kSizePositions = positions.size();
+  std::vector<double> x(kSizePositions);
+  std::vector<double> y(kSizePositions);
+
+  int index = 0;
+  if (instruction_set() == InstructionSet::kAvx2) {
+    index += kernel::SolveCoordinatesAvx2(parameters, positions.data(),
+                                          kSizePositions, x.data(),
+                                          y.data());
+  }
+
+#ifdef SPANANALYZER_CATENARY_BATCH_SSE2
+  index += kernel::SolveCoordinates<Sse2Ops>(
+      parameters, positions.data() + index, kSizePositions - index,
+      x.data() + index, y.data() + index);
+#endif
+
+  kernel::SolveCoordinates<ScalarOps>(
+      parameters, positions.data() + index, kSizePositions - index,
+      x.data() + index, y.data() + index);
+
+  // gets the catenary plane axes in the 3D coordinate system
+  // the vertical axis is opposite the resultant unit load, and the
+  // horizontal axis is the remainder of the chord
+  const Vector3d spacing = catenary.spacing_endpoints();
+  const Vector3d weight_unit = catenary.weight_unit();
+  const double axis_vertical[3] = {
+      0,
+      -weight_unit.y() / weight,
+      weight_unit.z() / weight};
+
+  double axis_horizontal[3] = {
+      spacing.x() - spacing_vertical * axis_vertical[0],
+      spacing.y() - spacing_vertical * axis_vertical[1],
+      spacing.z() - spacing_vertical * axis_vertical[2]};
+  for (int i = 0; i < 3; i++) {
+    axis_horizontal[i] /= spacing_horizontal;
+  }
+
+  // rotates the coordinates to the 3D coordinate system
+  coordinates.reserve(kSizePositions);
+  for (int i = 0; i < kSizePositions; i++) {
+    coordinates.push_back(Point3d<double>(
+        x[i] * axis_horizontal[0] + y[i] * axis_vertical[0],
+        x[i] * axis_horizontal[1] + y[i] * axis_vertical[1],
+        x[i] * axis_horizontal[2] + y[i] * axis_vertical[2]));
+  }
+}
+
+void CatenaryBatch::Lengths(std::vector<double>& lengths) const {
+  lengths.resize(size());
+  SolveQuantityDispatch(kernel::QuantityType::kLength,
+                        spacings_horizontal_.data(),
+                        spacings_vertical_.data(),
+                        tensions_horizontal_.data(), weights_unit_.data(),
+                        size(), lengths.data());
+}
+
+void CatenaryBatch::Reserve(const int& size) {
+  spacings_horizontal_.reserve(size);
+  spacings_vertical_.reserve(size);
+  tensions_horizontal_.reserve(size);
+  weights_unit_.reserve(size);
+}
+
+void CatenaryBatch::Sags(std::vector<double>& sags) const {
+  sags.resize(size());
+  SolveQuantityDispatch(kernel::QuantityType::kSag,
+                        spacings_horizontal_.data(),
+                        spacings_vertical_.data(),
+                        tensions_horizontal_.data(), weights_unit_.data(),
+                        size(), sags.data());
+}
+
+void CatenaryBatch::TensionsMax(std::vector<double>& tensions) const {
+  tensions.resize(size());
+  SolveQuantityDispatch(kernel::QuantityType::kTensionMax,
+                        spacings_horizontal_.data(),
+                        spacings_vertical_.data(),
+                        tensions_horizontal_.data(), weights_unit_.data(),
+                        size(), tensions.data());
+}
+
+CatenaryBatch::InstructionSet CatenaryBatch::instruction_set() {
+  // the processor is only checked once
+  static const bool kIsSupportedAvx2 =
+      (kernel::IsCompiledAvx2() == true) && (IsSupportedAvx2() == true);
+  if (kIsSupportedAvx2 == true) {
+    return InstructionSet::kAvx2;
+  }
+
+#ifdef SPANANALYZER_CATENARY_BATCH_SSE2
+  return InstructionSet::kSse2;
+#else
+  return InstructionSet::kScalar;
+#endif
+}
+
+int CatenaryBatch::size() const {
+  return spacings_horizontal_.size();
+}
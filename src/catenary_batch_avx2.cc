@@ -0,0 +1,128 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+// This file is compiled with AVX2 instructions enabled (-mavx2 for GCC and
+// Clang). MSVC doesn't need a flag to use the AVX2 intrinsics. The functions
+// are only called after the processor is checked for AVX2 support.
+
+#include "spananalyzer/catenary_batch_kernel.h"
+
+#if defined(__AVX2__) \
+    || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#define SPANANALYZER_CATENARY_BATCH_AVX2
+#include <immintrin.h>
+#endif
+
+namespace kernel = catenary_batch_kernel;
+
+#ifdef SPANANALYZER_CATENARY_BATCH_AVX2
+
+namespace {
+
+/// \par OVERVIEW
+///
+/// This struct has the kernel operations for AVX2 instructions.
+struct Avx2Ops {
+  typedef __m256d Vector;
+  static const int kSize = 4;
+
+  static __m256d Add(const __m256d& a, const __m256d& b) {
+    return _mm256_add_pd(a, b);
+  }
+  static __m256d And(const __m256d& a, const __m256d& b) {
+    return _mm256_and_pd(a, b);
+  }
+  static __m256d Div(const __m256d& a, const __m256d& b) {
+    return _mm256_div_pd(a, b);
+  }
+  static __m256d LessThan(const __m256d& a, const __m256d& b) {
+    return _mm256_cmp_pd(a, b, _CMP_LT_OQ);
+  }
+  static __m256d Load(const double* p) { return _mm256_loadu_pd(p); }
+  static __m256d Max(const __m256d& a, const __m256d& b) {
+    return _mm256_max_pd(a, b);
+  }
+  static __m256d Min(const __m256d& a, const __m256d& b) {
+    return _mm256_min_pd(a, b);
+  }
+  static __m256d Mul(const __m256d& a, const __m256d& b) {
+    return _mm256_mul_pd(a, b);
+  }
+  static __m256d Or(const __m256d& a, const __m256d& b) {
+    return _mm256_or_pd(a, b);
+  }
+  static __m256d Select(const __m256d& mask, const __m256d& a,
+                        const __m256d& b) {
+    return _mm256_blendv_pd(b, a, mask);
+  }
+  static __m256d Set(const double& a) { return _mm256_set1_pd(a); }
+  static __m256d SetBits(const uint64_t& bits) {
+    return _mm256_castsi256_pd(
+        _mm256_set1_epi64x(static_cast<long long>(bits)));
+  }
+  static __m256d ShiftLeft52(const __m256d& a) {
+    return _mm256_castsi256_pd(
+        _mm256_slli_epi64(_mm256_castpd_si256(a), 52));
+  }
+  static __m256d ShiftRight52(const __m256d& a) {
+    return _mm256_castsi256_pd(
+        _mm256_srli_epi64(_mm256_castpd_si256(a), 52));
+  }
+  static __m256d Sqrt(const __m256d& a) { return _mm256_sqrt_pd(a); }
+  static void Store(double* p, const __m256d& a) { _mm256_storeu_pd(p, a); }
+  static __m256d Sub(const __m256d& a, const __m256d& b) {
+    return _mm256_sub_pd(a, b);
+  }
+};
+
+}  // namespace
+
+bool kernel::IsCompiledAvx2() {
+  return true;
+}
+
+int kernel::SolveQuantityAvx2(const QuantityType& type,
+                              const double* spacings_horizontal,
+                              const double* spacings_vertical,
+                              const double* tensions_horizontal,
+                              const double* weights_unit,
+                              const int& size,
+                              double* values) {
+  return SolveQuantity<Avx2Ops>(type, spacings_horizontal, spacings_vertical,
+                                tensions_horizontal, weights_unit, size,
+                                values);
+}
+
+int kernel::SolveCoordinatesAvx2(const CoordinateParameters& parameters,
+                                 const double* positions,
+                                 const int& size,
+                                 double* x,
+                                 double* y) {
+  return SolveCoordinates<Avx2Ops>(parameters, positions, size, x, y);
+}
+
+#else
+
+bool kernel::IsCompiledAvx2() {
+  return false;
+}
+
+int kernel::SolveQuantityAvx2(const QuantityType& type,
+                              const double* spacings_horizontal,
+                              const double* spacings_vertical,
+                              const double* tensions_horizontal,
+                              const double* weights_unit,
+                              const int& size,
+                              double* values) {
+  return 0;
+}
+
+int kernel::SolveCoordinatesAvx2(const CoordinateParameters& parameters,
+                                 const double* positions,
+                                 const int& size,
+                                 double* x,
+                                 double* y) {
+  return 0;
+}
+
+#endif
@@ -0,0 +1,315 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/clearance_index.h"
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+
+#include "spananalyzer/catenary_batch.h"
+
+namespace {
+
+/// \var kNumSegmentsCurve
+///   The number of segments that a catenary is sampled with.
+const int kNumSegmentsCurve = 200;
+
+/// \var kSizeLeaf
+///   The maximum number of points in a leaf node.
+const int kSizeLeaf = 16;
+
+}  // namespace
+
+ClearanceCurve::ClearanceCurve() {
+}
+
+double ClearanceCurve::Elevation(const double& station) const {
+  const int index = IndexSegment(station);
+  const double& station_0 = stations_.at(index);
+  const double& station_1 = stations_.at(index + 1);
+  const double& elevation_0 = elevations_.at(index);
+  const double& elevation_1 = elevations_.at(index + 1);
+
+  // interpolates the segment
+  if (station_1 <= station_0) {
+    return std::min(elevation_0, elevation_1);
+  }
+
+  const double fraction = (station - station_0) / (station_1 - station_0);
+  return elevation_0 + fraction * (elevation_1 - elevation_0);
+}
+
+double ClearanceCurve::ElevationMin(const double& station_begin,
+                                    const double& station_end) const {
+  // gets the elevation at the range ends
+  double elevation_min = std::min(Elevation(station_begin),
+                                  Elevation(station_end));
+
+  // gets the minimum elevation of the points inside the range
+  const int index_begin = IndexSegment(station_begin) + 1;
+  const int index_end = IndexSegment(station_end);
+  if (index_begin <= index_end) {
+    // looks up the two overlapping power-of-two ranges in the sparse table
+    const int num_points = index_end - index_begin + 1;
+    int level = 0;
+    while ((2 << level) <= num_points) {
+      level++;
+    }
+
+    const std::vector<double>& elevations = elevations_min_.at(level);
+    elevation_min = std::min(elevation_min, elevations.at(index_begin));
+    elevation_min = std::min(
+        elevation_min, elevations.at(index_end - (1 << level) + 1));
+  }
+
+  return elevation_min;
+}
+
+void ClearanceCurve::set_catenary(const Catenary3d& catenary) {
+  stations_.clear();
+  elevations_.clear();
+  stations_.reserve(kNumSegmentsCurve + 1);
+  elevations_.reserve(kNumSegmentsCurve + 1);
+
+  // samples the catenary
+  // the stations are forced to increase so the segments can be searched
+  std::vector<double> positions;
+  positions.reserve(kNumSegmentsCurve + 1);
+  for (int i = 0; i <= kNumSegmentsCurve; i++) {
+    positions.push_back(static_cast<double>(i)
+                        / static_cast<double>(kNumSegmentsCurve));
+  }
+
+  std::vector<Point3d<double>> points;
+  CatenaryBatch::Coordinates(catenary, positions, points);
+
+  for (auto iter = points.cbegin(); iter != points.cend(); iter++) {
+    const Point3d<double>& point = *iter;
+
+    double station = point.x;
+    if (stations_.empty() == false) {
+      station = std::max(station, stations_.back());
+    }
+
+    stations_.push_back(station);
+    elevations_.push_back(point.z);
+  }
+
+  // builds the sparse table
+  const int kSizePoints = elevations_.size();
+  elevations_min_.clear();
+  elevations_min_.push_back(elevations_);
+  for (int level = 1; (1 << level) <= kSizePoints; level++) {
+    const std::vector<double>& elevations_previous = elevations_min_.back();
+    const int offset = 1 << (level - 1);
+
+    std::vector<double> elevations(kSizePoints - (1 << level) + 1);
+    for (unsigned int i = 0; i < elevations.size(); i++) {
+      elevations[i] = std::min(elevations_previous[i],
+                               elevations_previous[i + offset]);
+    }
+
+    elevations_min_.push_back(std::move(elevations));
+  }
+}
+
+double ClearanceCurve::station_max() const {
+  if (stations_.empty() == true) {
+    return 0;
+  }
+
+  return stations_.back();
+}
+
+int ClearanceCurve::IndexSegment(const double& station) const {
+  const int kSizeSegments = stations_.size() - 1;
+
+  auto iter = std::upper_bound(stations_.cbegin(), stations_.cend(), station);
+  int index = std::distance(stations_.cbegin(), iter) - 1;
+  index = std::max(index, 0);
+  index = std::min(index, kSizeSegments - 1);
+
+  return index;
+}
+
+ClearanceIndex::ClearanceIndex() {
+}
+
+void ClearanceIndex::Build(const std::vector<ProfilePoint>& profile) {
+  Clear();
+
+  if (profile.empty() == true) {
+    return;
+  }
+
+  // sorts the points by station
+  points_ = profile;
+  std::sort(points_.begin(), points_.end(),
+            [](const ProfilePoint& a, const ProfilePoint& b) {
+              return a.station < b.station;
+            });
+
+  // builds the tree
+  nodes_.reserve(2 * (points_.size() / kSizeLeaf + 1));
+  BuildNode(0, points_.size());
+}
+
+void ClearanceIndex::Clear() {
+  nodes_.clear();
+  points_.clear();
+}
+
+void ClearanceIndex::Query(const ClearanceCurve& curve,
+                           ClearanceResult& result) const {
+  // initializes
+  result.clearance = 0;
+  result.clearance_required = 0;
+  result.num_points = 0;
+  result.num_violations = 0;
+  result.station = 0;
+
+  if (nodes_.empty() == true) {
+    return;
+  }
+
+  // counts the points within the curve
+  const double station_max = curve.station_max();
+  auto iter_begin = std::lower_bound(
+      points_.cbegin(), points_.cend(), 0.0,
+      [](const ProfilePoint& point, const double& station) {
+        return point.station < station;
+      });
+  auto iter_end = std::upper_bound(
+      points_.cbegin(), points_.cend(), station_max,
+      [](const double& station, const ProfilePoint& point) {
+        return station < point.station;
+      });
+  result.num_points = std::distance(iter_begin, iter_end);
+  if (result.num_points == 0) {
+    return;
+  }
+
+  // searches the tree, visiting the node with the lower bound first
+  // a node is skipped if its bound can't improve the governing point and
+  // can't contain a violation
+  double margin_min = std::numeric_limits<double>::max();
+  std::vector<std::pair<double, int>> stack;
+
+  double bound = 0;
+  if (MarginBound(nodes_.front(), curve, bound) == true) {
+    stack.push_back(std::make_pair(bound, 0));
+  }
+
+  while (stack.empty() == false) {
+    const std::pair<double, int> item = stack.back();
+    stack.pop_back();
+
+    if (std::max(margin_min, 0.0) <= item.first) {
+      continue;
+    }
+
+    const Node& node = nodes_.at(item.second);
+    if (node.index_left == -1) {
+      // checks every point in the leaf
+      for (int i = node.index_begin; i < node.index_end; i++) {
+        const ProfilePoint& point = points_.at(i);
+        if ((point.station < 0) || (station_max < point.station)) {
+          continue;
+        }
+
+        const double clearance = curve.Elevation(point.station)
+                                 - point.elevation;
+        const double margin = clearance - point.clearance;
+        if (margin < 0) {
+          result.num_violations++;
+        }
+
+        if (margin < margin_min) {
+          margin_min = margin;
+          result.clearance = clearance;
+          result.clearance_required = point.clearance;
+          result.station = point.station;
+        }
+      }
+    } else {
+      // pushes the children so the lower bound is popped first
+      double bound_left = 0;
+      double bound_right = 0;
+      const bool is_left = MarginBound(nodes_.at(node.index_left), curve,
+                                       bound_left);
+      const bool is_right = MarginBound(nodes_.at(node.index_right), curve,
+                                        bound_right);
+
+      if ((is_left == true) && (is_right == true)) {
+        if (bound_left < bound_right) {
+          stack.push_back(std::make_pair(bound_right, node.index_right));
+          stack.push_back(std::make_pair(bound_left, node.index_left));
+        } else {
+          stack.push_back(std::make_pair(bound_left, node.index_left));
+          stack.push_back(std::make_pair(bound_right, node.index_right));
+        }
+      } else if (is_left == true) {
+        stack.push_back(std::make_pair(bound_left, node.index_left));
+      } else if (is_right == true) {
+        stack.push_back(std::make_pair(bound_right, node.index_right));
+      }
+    }
+  }
+}
+
+int ClearanceIndex::size() const {
+  return points_.size();
+}
+
+int ClearanceIndex::BuildNode(const int& index_begin, const int& index_end) {
+  // adds the node before the children, so the root node is first
+  const int index_node = nodes_.size();
+  nodes_.push_back(Node());
+
+  Node node;
+  node.index_begin = index_begin;
+  node.index_end = index_end;
+  node.station_min = points_.at(index_begin).station;
+  node.station_max = points_.at(index_end - 1).station;
+
+  if (index_end - index_begin <= kSizeLeaf) {
+    // gets the bounds of the leaf points
+    node.index_left = -1;
+    node.index_right = -1;
+    node.clearance_max = points_.at(index_begin).clearance;
+    node.elevation_max = points_.at(index_begin).elevation;
+    for (int i = index_begin + 1; i < index_end; i++) {
+      const ProfilePoint& point = points_.at(i);
+      node.clearance_max = std::max(node.clearance_max, point.clearance);
+      node.elevation_max = std::max(node.elevation_max, point.elevation);
+    }
+  } else {
+    // splits the points in half and gets the bounds of the children
+    const int index_split = index_begin + (index_end - index_begin) / 2;
+    node.index_left = BuildNode(index_begin, index_split);
+    node.index_right = BuildNode(index_split, index_end);
+
+    const Node& left = nodes_.at(node.index_left);
+    const Node& right = nodes_.at(node.index_right);
+    node.clearance_max = std::max(left.clearance_max, right.clearance_max);
+    node.elevation_max = std::max(left.elevation_max, right.elevation_max);
+  }
+
+  nodes_.at(index_node) = node;
+  return index_node;
+}
+
+bool ClearanceIndex::MarginBound(const Node& node, const ClearanceCurve& curve,
+                                 double& bound) const {
+  // clips the node station range to the curve
+  const double station_begin = std::max(node.station_min, 0.0);
+  const double station_end = std::min(node.station_max, curve.station_max());
+  if (station_end < station_begin) {
+    return false;
+  }
+
+  bound = curve.ElevationMin(station_begin, station_end)
+          - node.elevation_max - node.clearance_max;
+  return true;
+}
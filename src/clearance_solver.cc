@@ -0,0 +1,132 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/clearance_solver.h"
+
+#include <algorithm>
+
+#include "models/transmissionline/catenary.h"
+
+ClearanceThread::ClearanceThread() {
+  index_ = nullptr;
+  index_begin_ = 0;
+  index_end_ = 0;
+  results_ = nullptr;
+  results_analysis_ = nullptr;
+  span_ = nullptr;
+}
+
+void ClearanceThread::Process() {
+  ClearanceCurve curve;
+  for (int i = index_begin_; i < index_end_; i++) {
+    const SagTensionAnalysisResult& result = results_analysis_->at(i);
+
+    // creates a catenary with the result parameters
+    Catenary3d catenary;
+    catenary.set_spacing_endpoints(span_->spacing_attachments);
+    catenary.set_tension_horizontal(result.tension_horizontal);
+    catenary.set_weight_unit(result.weight_unit);
+
+    // queries the index with the catenary profile
+    curve.set_catenary(catenary);
+    index_->Query(curve, results_->at(i));
+  }
+}
+
+void ClearanceThread::set_index(const ClearanceIndex* index) {
+  index_ = index;
+}
+
+void ClearanceThread::set_indexes(const int& index_begin,
+                                  const int& index_end) {
+  index_begin_ = index_begin;
+  index_end_ = index_end;
+}
+
+void ClearanceThread::set_results_analysis(
+    const std::vector<SagTensionAnalysisResult>* results_analysis) {
+  results_analysis_ = results_analysis;
+}
+
+void ClearanceThread::set_results(std::vector<ClearanceResult>* results) {
+  results_ = results;
+}
+
+void ClearanceThread::set_span(const Span* span) {
+  span_ = span;
+}
+
+ClearanceSolver::ClearanceSolver() {
+  span_ = nullptr;
+
+  max_threads_ = WorkerPool::NumThreads(0);
+}
+
+ClearanceSolver::~ClearanceSolver() {
+}
+
+bool ClearanceSolver::Solve(
+    const std::vector<SagTensionAnalysisResult>& results_analysis,
+    std::vector<ClearanceResult>& results) const {
+  results.clear();
+
+  // checks span
+  if (span_ == nullptr) {
+    return false;
+  }
+
+  if (span_->spacing_attachments.x() <= 0) {
+    return false;
+  }
+
+  const int kSizeResults = results_analysis.size();
+  results.resize(kSizeResults);
+  if (kSizeResults == 0) {
+    return true;
+  }
+
+  // determines the number of threads
+  const int num_threads = std::min(max_threads_, kSizeResults);
+
+  // creates threads with contiguous result ranges
+  WorkerPool pool;
+  for (int i = 0; i < num_threads; i++) {
+    ClearanceThread* thread = new ClearanceThread();
+    thread->set_index(&index_);
+    thread->set_indexes(kSizeResults * i / num_threads,
+                        kSizeResults * (i + 1) / num_threads);
+    thread->set_results_analysis(&results_analysis);
+    thread->set_results(&results);
+    thread->set_span(span_);
+    pool.Add(thread);
+  }
+
+  // solves the ranges, and deletes the threads with the pool
+  pool.Start();
+  pool.RunPass();
+
+  return true;
+}
+
+int ClearanceSolver::max_threads() const {
+  return max_threads_;
+}
+
+void ClearanceSolver::set_max_threads(const int& max_threads) {
+  max_threads_ = WorkerPool::NumThreads(max_threads);
+}
+
+void ClearanceSolver::set_span(const Span* span) {
+  span_ = span;
+
+  // indexes the profile points
+  if (span_ == nullptr) {
+    index_.Clear();
+  } else {
+    index_.Build(span_->profile);
+  }
+}
+
+const Span* ClearanceSolver::span() const {
+  return span_;
+}
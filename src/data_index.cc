@@ -0,0 +1,55 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/data_index.h"
+
+#include <utility>
+
+DataIndex::DataIndex() {
+}
+
+void DataIndex::Build(const SpanAnalyzerData& data) {
+  Clear();
+
+  // indexes cables
+  // an existing key isn't replaced, so the first cable with a name is kept
+  cables_.reserve(data.cablefiles.size());
+  for (auto iter = data.cablefiles.cbegin(); iter != data.cablefiles.cend();
+       iter++) {
+    const CableFile* cablefile = *iter;
+    cables_.insert(std::make_pair(cablefile->cable.name, &cablefile->cable));
+  }
+
+  // indexes weathercases
+  weathercases_.reserve(data.weathercases.size());
+  for (auto iter = data.weathercases.cbegin();
+       iter != data.weathercases.cend(); iter++) {
+    const WeatherLoadCase* weathercase = *iter;
+    weathercases_.insert(std::make_pair(weathercase->description,
+                                        weathercase));
+  }
+}
+
+void DataIndex::Clear() {
+  cables_.clear();
+  weathercases_.clear();
+}
+
+const Cable* DataIndex::FindCable(const std::string& name) const {
+  auto iter = cables_.find(name);
+  if (iter == cables_.end()) {
+    return nullptr;
+  }
+
+  return iter->second;
+}
+
+const WeatherLoadCase* DataIndex::FindWeathercase(
+    const std::string& description) const {
+  auto iter = weathercases_.find(description);
+  if (iter == weathercases_.end()) {
+    return nullptr;
+  }
+
+  return iter->second;
+}
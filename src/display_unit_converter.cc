@@ -0,0 +1,83 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/display_unit_converter.h"
+
+#include "spananalyzer/span_analyzer_app.h"
+
+void DisplayUnitConverter::ConvertUnitSystem(
+    const units::UnitSystem& system_from,
+    const units::UnitSystem& system_to,
+    CableConstraint& constraint) {
+  constraint.limit = ConvertUnitSystem(system_from, system_to,
+                                       QuantityTypeLimit(constraint.type_limit),
+                                       constraint.limit);
+}
+
+double DisplayUnitConverter::ConvertUnitSystem(
+    const units::UnitSystem& system_from,
+    const units::UnitSystem& system_to,
+    const QuantityType& type,
+    const double& value) {
+  if (system_from == system_to) {
+    return value;
+  }
+
+  double value_converted = value;
+  if (system_to == units::UnitSystem::kMetric) {
+    if (type == QuantityType::kForce) {
+      value_converted = units::ConvertForce(
+          value_converted,
+          units::ForceConversionType::kPoundsToNewtons);
+    } else if (type == QuantityType::kLength) {
+      value_converted = units::ConvertLength(
+          value_converted,
+          units::LengthConversionType::kFeetToMeters);
+    } else if (type == QuantityType::kWeightUnit) {
+      value_converted = units::ConvertForce(
+          value_converted,
+          units::ForceConversionType::kPoundsToNewtons);
+      value_converted = units::ConvertLength(
+          value_converted,
+          units::LengthConversionType::kFeetToMeters,
+          1, false);
+    }
+  } else if (system_to == units::UnitSystem::kImperial) {
+    if (type == QuantityType::kForce) {
+      value_converted = units::ConvertForce(
+          value_converted,
+          units::ForceConversionType::kNewtonsToPounds);
+    } else if (type == QuantityType::kLength) {
+      value_converted = units::ConvertLength(
+          value_converted,
+          units::LengthConversionType::kMetersToFeet);
+    } else if (type == QuantityType::kWeightUnit) {
+      value_converted = units::ConvertForce(
+          value_converted,
+          units::ForceConversionType::kNewtonsToPounds);
+      value_converted = units::ConvertLength(
+          value_converted,
+          units::LengthConversionType::kMetersToFeet,
+          1, false);
+    }
+  }
+
+  return value_converted;
+}
+
+DisplayUnitConverter::QuantityType DisplayUnitConverter::QuantityTypeLimit(
+    const CableConstraint::LimitType& type_limit) {
+  if ((type_limit == CableConstraint::LimitType::kHorizontalTension)
+      || (type_limit == CableConstraint::LimitType::kSupportTension)) {
+    return QuantityType::kForce;
+  } else {
+    return QuantityType::kLength;
+  }
+}
+
+double DisplayUnitConverter::ToDisplay(const QuantityType& type,
+                                       const double& value) {
+  return ConvertUnitSystem(wxGetApp().units_model(),
+                           wxGetApp().config()->units,
+                           type, value);
+}
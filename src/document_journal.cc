@@ -0,0 +1,386 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/document_journal.h"
+
+#include <list>
+#include <sstream>
+
+#include "wx/filename.h"
+#include "wx/mstream.h"
+#include "wx/xml/xml.h"
+
+#include "spananalyzer/span_analyzer_doc.h"
+#include "spananalyzer/span_unit_converter.h"
+#include "spananalyzer/span_xml_handler.h"
+#include "spananalyzer/xml_stream_writer.h"
+
+namespace {
+
+/// \var kHeader
+///   The first line of a journal file, which identifies the format version.
+const std::string kHeader = "SpanAnalyzerJournal 1\n";
+
+}  // namespace
+
+DocumentJournal::DocumentJournal() {
+  units_ = units::UnitSystem::kImperial;
+}
+
+DocumentJournal::~DocumentJournal() {
+  Close(false);
+}
+
+void DocumentJournal::Close(const bool& is_removed) {
+  if (file_.IsOpened() == true) {
+    file_.Close();
+  }
+
+  if ((is_removed == true) && (filepath_doc_.empty() == false)) {
+    Remove(filepath_doc_);
+  }
+
+  filepath_doc_.clear();
+}
+
+bool DocumentJournal::Exists(const std::string& filepath_doc) {
+  return (wxFileExists(FilepathJournal(filepath_doc)) == true)
+      || (wxFileExists(FilepathRotated(filepath_doc)) == true);
+}
+
+bool DocumentJournal::IsOpen() const {
+  return file_.IsOpened();
+}
+
+bool DocumentJournal::IsRotated() const {
+  if (filepath_doc_.empty() == true) {
+    return false;
+  }
+
+  return wxFileExists(FilepathRotated(filepath_doc_));
+}
+
+bool DocumentJournal::Open(const std::string& filepath_doc,
+                           const units::UnitSystem& units) {
+  Close(false);
+
+  if (filepath_doc.empty() == true) {
+    return false;
+  }
+
+  // opens the file for appending
+  const std::string filepath = FilepathJournal(filepath_doc);
+  if (file_.Open(filepath, "ab") == false) {
+    std::string message = filepath + "  --  "
+                          "Journal file couldn't be opened. Edits won't be "
+                          "recoverable until the document is saved.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  filepath_doc_ = filepath_doc;
+  units_ = units;
+
+  // writes the header to new files
+  if (file_.Length() == 0) {
+    Write(kHeader);
+  }
+
+  return true;
+}
+
+void DocumentJournal::RecordDelete(const int& index) {
+  if (IsOpen() == false) {
+    return;
+  }
+
+  Write("D " + std::to_string(index) + "\n");
+}
+
+void DocumentJournal::RecordInsert(const int& index, const Span& span) {
+  if (IsOpen() == false) {
+    return;
+  }
+
+  WriteSpan('I', index, span);
+}
+
+void DocumentJournal::RecordModify(const int& index, const Span& span) {
+  if (IsOpen() == false) {
+    return;
+  }
+
+  WriteSpan('M', index, span);
+}
+
+void DocumentJournal::RecordMove(const int& index_from, const int& index_to) {
+  if (IsOpen() == false) {
+    return;
+  }
+
+  Write("V " + std::to_string(index_from) + " " + std::to_string(index_to)
+        + "\n");
+}
+
+void DocumentJournal::Remove(const std::string& filepath_doc) {
+  const std::string filepath_journal = FilepathJournal(filepath_doc);
+  if (wxFileExists(filepath_journal) == true) {
+    wxRemoveFile(filepath_journal);
+  }
+
+  const std::string filepath_rotated = FilepathRotated(filepath_doc);
+  if (wxFileExists(filepath_rotated) == true) {
+    wxRemoveFile(filepath_rotated);
+  }
+}
+
+int DocumentJournal::Replay(const std::string& filepath_doc,
+                            const units::UnitSystem& units,
+                            const SpanAnalyzerData& data,
+                            SpanAnalyzerDoc& doc) {
+  int count = 0;
+
+  // replays the rotated journal first, as it is older
+  std::list<std::string> filepaths;
+  filepaths.push_back(FilepathRotated(filepath_doc));
+  filepaths.push_back(FilepathJournal(filepath_doc));
+
+  for (auto iter = filepaths.cbegin(); iter != filepaths.cend(); iter++) {
+    const std::string& filepath = *iter;
+    if (wxFileExists(filepath) == false) {
+      continue;
+    }
+
+    const int count_file = ReplayFile(filepath, units, data, doc);
+    if (count_file == -1) {
+      return -1;
+    }
+
+    count += count_file;
+  }
+
+  return count;
+}
+
+std::string DocumentJournal::Rotate() {
+  if (filepath_doc_.empty() == true) {
+    return "";
+  }
+
+  const std::string filepath_doc = filepath_doc_;
+  Close(false);
+
+  const std::string filepath_journal = FilepathJournal(filepath_doc);
+  const std::string filepath_rotated = FilepathRotated(filepath_doc);
+  if (wxFileExists(filepath_journal) == false) {
+    return "";
+  }
+
+  if (wxFileExists(filepath_rotated) == false) {
+    // renames the journal
+    if (wxRenameFile(filepath_journal, filepath_rotated, false) == false) {
+      return "";
+    }
+  } else {
+    // appends the journal records to the rotated journal
+    wxFFile file_journal(filepath_journal, "rb");
+    wxFFile file_rotated(filepath_rotated, "ab");
+    if ((file_journal.IsOpened() == false)
+        || (file_rotated.IsOpened() == false)) {
+      return "";
+    }
+
+    std::string content(static_cast<size_t>(file_journal.Length()), '\0');
+    file_journal.Read(&content[0], content.size());
+    file_journal.Close();
+
+    // skips the header
+    if (content.compare(0, kHeader.size(), kHeader) == 0) {
+      content.erase(0, kHeader.size());
+    }
+
+    file_rotated.Write(content.data(), content.size());
+    file_rotated.Close();
+
+    wxRemoveFile(filepath_journal);
+  }
+
+  return filepath_rotated;
+}
+
+const std::string& DocumentJournal::filepath_doc() const {
+  return filepath_doc_;
+}
+
+std::string DocumentJournal::FilepathJournal(const std::string& filepath_doc) {
+  return filepath_doc + ".journal";
+}
+
+std::string DocumentJournal::FilepathRotated(const std::string& filepath_doc) {
+  return filepath_doc + ".journal.saving";
+}
+
+int DocumentJournal::ReplayFile(const std::string& filepath,
+                                const units::UnitSystem& units,
+                                const SpanAnalyzerData& data,
+                                SpanAnalyzerDoc& doc) {
+  std::string message;
+
+  // reads the file
+  wxFFile file(filepath, "rb");
+  if (file.IsOpened() == false) {
+    message = filepath + "  --  Journal file couldn't be opened.";
+    wxLogError(message.c_str());
+    return -1;
+  }
+
+  std::string content(static_cast<size_t>(file.Length()), '\0');
+  file.Read(&content[0], content.size());
+  file.Close();
+
+  // checks the header
+  if (content.compare(0, kHeader.size(), kHeader) != 0) {
+    message = filepath + "  --  Journal file has an invalid header.";
+    wxLogError(message.c_str());
+    return -1;
+  }
+
+  // replays records until the end of the file
+  int count = 0;
+  size_t pos = kHeader.size();
+  while (pos < content.size()) {
+    // gets the record line
+    const size_t pos_end = content.find('\n', pos);
+    if (pos_end == std::string::npos) {
+      break;
+    }
+
+    std::istringstream stream(content.substr(pos, pos_end - pos));
+    pos = pos_end + 1;
+
+    char type = ' ';
+    stream >> type;
+
+    bool status = false;
+    if (type == 'D') {
+      int index = -1;
+      stream >> index;
+      status = (stream.fail() == false) && (doc.DeleteSpan(index) == true);
+    } else if (type == 'V') {
+      int index_from = -1;
+      int index_to = -1;
+      stream >> index_from >> index_to;
+      status = (stream.fail() == false)
+               && (doc.MoveSpan(index_from, index_to) == true);
+    } else if ((type == 'I') || (type == 'M')) {
+      int index = -1;
+      char units_record = ' ';
+      size_t size = 0;
+      stream >> index >> units_record >> size;
+      if (stream.fail() == true) {
+        break;
+      }
+
+      // ignores a span node that wasn't completely written
+      if (content.size() < pos + size) {
+        break;
+      }
+
+      // parses the span node
+      wxMemoryInputStream stream_node(content.data() + pos, size);
+      pos = pos + size + 1;
+
+      wxXmlDocument doc_xml;
+      if (doc_xml.Load(stream_node) == false) {
+        break;
+      }
+
+      Span span;
+      status = SpanXmlHandler::ParseNode(doc_xml.GetRoot(), filepath,
+                                         units::UnitSystem::kNull, false,
+                                         &data.cablefiles, &data.weathercases,
+                                         span);
+
+      // converts the span if it was recorded in a different unit system
+      units::UnitSystem units_span = units::UnitSystem::kImperial;
+      if (units_record == 'M') {
+        units_span = units::UnitSystem::kMetric;
+      }
+      if (units_span != units) {
+        SpanUnitConverter::ConvertUnitSystem(units_span, units, true, span);
+      }
+
+      // applies the span
+      if (status == true) {
+        if (type == 'I') {
+          status = doc.InsertSpan(index, span);
+        } else {
+          status = doc.ModifySpan(index, span);
+        }
+      }
+    } else {
+      break;
+    }
+
+    if (status == false) {
+      message = filepath + "  --  Journal record " + std::to_string(count + 1)
+                + " couldn't be applied. Recovery stopped.";
+      wxLogError(message.c_str());
+      return -1;
+    }
+
+    count++;
+  }
+
+  if (pos < content.size()) {
+    message = filepath + "  --  Journal ends with an incomplete record, which "
+              "was ignored.";
+    wxLogWarning(message.c_str());
+  }
+
+  return count;
+}
+
+void DocumentJournal::Write(const std::string& record) {
+  // flushes each record so it survives an unexpected exit
+  if ((file_.Write(record.data(), record.size()) != record.size())
+      || (file_.Flush() == false)) {
+    std::string message = FilepathJournal(filepath_doc_) + "  --  "
+                          "Journal file couldn't be written. Edits won't be "
+                          "recoverable until the document is saved.";
+    wxLogError(message.c_str());
+    file_.Close();
+  }
+}
+
+void DocumentJournal::WriteSpan(const char& type, const int& index,
+                                const Span& span) {
+  // copies the span and removes connections
+  Span span_recorded = span;
+  span_recorded.linecable.ClearConnections();
+
+  // streams the span node to memory
+  wxMemoryOutputStream stream;
+  {
+    XmlStreamWriter writer(stream, 0);
+    SpanXmlHandler::WriteNode(span_recorded, "", units_,
+                              units::UnitStyle::kConsistent, writer);
+    writer.EndDocument();
+  }
+
+  std::string node(static_cast<size_t>(stream.GetSize()), '\0');
+  stream.CopyTo(&node[0], node.size());
+
+  // writes the record
+  std::string record;
+  record += type;
+  record += " " + std::to_string(index);
+  if (units_ == units::UnitSystem::kMetric) {
+    record += " M ";
+  } else {
+    record += " I ";
+  }
+  record += std::to_string(node.size()) + "\n" + node + "\n";
+
+  Write(record);
+}
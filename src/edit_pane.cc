@@ -7,6 +7,7 @@
 
 #include "wx/xrc/xmlres.h"
 
+#include "spananalyzer/reliability_dialog.h"
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_doc.h"
 #include "spananalyzer/span_analyzer_doc_commands.h"
@@ -21,14 +22,16 @@
 
 /// context menu enum
 enum {
-  kTreeItemActivate = 0,
-  kTreeItemCopy = 1,
-  kTreeItemDeactivate = 2,
-  kTreeItemDelete = 3,
-  kTreeItemEdit = 4,
-  kTreeItemMoveDown = 5,
-  kTreeItemMoveUp = 6,
-  kTreeRootAdd = 7,
+  kListItemActivate = 0,
+  kListItemCopy = 1,
+  kListItemDeactivate = 2,
+  kListItemDelete = 3,
+  kListItemEdit = 4,
+  kListItemMoveDown = 5,
+  kListItemMoveUp = 6,
+  kListItemReliability = 7,
+  kListAdd = 8,
+  kListDeleteAll = 9,
 };
 
 BEGIN_EVENT_TABLE(EditPane, wxPanel)
@@ -38,25 +41,23 @@ BEGIN_EVENT_TABLE(EditPane, wxPanel)
   EVT_BUTTON(XRCID("button_edit"), EditPane::OnButtonEdit)
   EVT_BUTTON(XRCID("button_move_down"), EditPane::OnButtonMoveDown)
   EVT_BUTTON(XRCID("button_move_up"), EditPane::OnButtonMoveUp)
+  EVT_CONTEXT_MENU(EditPane::OnContextMenu)
+  EVT_LIST_ITEM_ACTIVATED(wxID_ANY, EditPane::OnItemActivate)
   EVT_MENU(wxID_ANY, EditPane::OnContextMenuSelect)
-  EVT_TREE_ITEM_ACTIVATED(wxID_ANY, EditPane::OnItemActivate)
-  EVT_TREE_ITEM_MENU(wxID_ANY, EditPane::OnItemMenu)
 END_EVENT_TABLE()
 
 EditPane::EditPane(wxWindow* parent, wxView* view) {
   // loads dialog from virtual xrc file system
   wxXmlResource::Get()->LoadPanel(this, parent, "edit_pane");
 
-  // initializes
-  index_bold_ = -1;
-
   // saves view reference
   view_ = view;
 
-  // sets up treectrl
-  treectrl_ = XRCCTRL(*this, "treectrl", wxTreeCtrl);
-  treectrl_->AddRoot("Spans");
-  treectrl_->SetIndent(2);
+  // creates the span list and adds it to the sizer
+  listctrl_ = new SpanListCtrl(this);
+
+  wxBoxSizer* sizer = dynamic_cast<wxBoxSizer*>(GetSizer());
+  sizer->Add(listctrl_, 1, wxEXPAND);
 
   // creates an imagelist for the button bitmaps
   wxImageList images(32, 32, true);
@@ -95,7 +96,7 @@ void EditPane::Update(wxObject* hint) {
   // interprets hint
   const UpdateHint* hint_update = dynamic_cast<UpdateHint*>(hint);
   if (hint_update == nullptr) {
-    InitializeTreeCtrl();
+    UpdateSpanRows(nullptr);
   } else if (hint_update->type()
       == UpdateHint::Type::kAnalysisFilterGroupEdit) {
     // do nothing
@@ -111,34 +112,24 @@ void EditPane::Update(wxObject* hint) {
   } else if (hint_update->type() == UpdateHint::Type::kPreferencesEdit) {
     // do nothing
   } else if (hint_update->type() == UpdateHint::Type::kSpansEdit) {
-    UpdateTreeCtrlSpanItems(hint_update);
+    UpdateSpanRows(hint_update);
   } else if (hint_update->type() == UpdateHint::Type::kWeathercasesEdit) {
     // do nothing
   }
 }
 
-void EditPane::ActivateSpan(const wxTreeItemId& id) {
-  if (id.IsOk() == false) {
-    return;
-  }
-
-  if (id == treectrl_->GetRootItem()) {
+void EditPane::ActivateSpan(const int& index) {
+  if (listctrl_->IsValidRow(index) == false) {
     return;
   }
 
-  // gets span index
-  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
-  auto iter = data->iter();
-  const int index = doc->IndexSpan(&(*iter));
-
   // logs
   std::string message = "Activating span at index " + std::to_string(index)
                       + ".";
   wxLogVerbose(message.c_str());
 
   // updates document
+  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
   doc->set_index_activated(index);
 
   // posts a view update
@@ -147,8 +138,8 @@ void EditPane::ActivateSpan(const wxTreeItemId& id) {
   hint.set_name_command("Activate Span");
   doc->UpdateAllViews(nullptr, &hint);
 
-  // updates treectrl focus
-  FocusTreeCtrlSpanItem(index);
+  // updates list focus
+  FocusSpanRow(index);
 }
 
 void EditPane::AddSpan() {
@@ -180,104 +171,133 @@ void EditPane::AddSpan() {
     return;
   }
 
+  const units::UnitSystem units_display = wxGetApp().config()->units;
   SpanEditorDialog dialog(view_->GetFrame(),
                           &cablefiles,
                           &weathercases,
-                          wxGetApp().config()->units,
+                          units_display,
                           &span);
   if (dialog.ShowModal() != wxID_OK) {
     return;
   }
 
+  // converts span to 'consistent' unit style and the model unit system
+  SpanUnitConverter::ConvertUnitStyleToConsistent(0, units_display, true,
+                                                  span);
+  SpanUnitConverter::ConvertUnitSystem(units_display,
+                                       wxGetApp().units_model(), true, span);
+
   // updates document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
 
   SpanCommand* command = new SpanCommand(SpanCommand::kNameInsert);
   command->set_index(doc->spans().size());
 
-  wxXmlNode* node = SpanCommand::SaveSpanToXml(span);
-  command->set_node_span(node);
+  command->set_span(span);
 
   doc->GetCommandProcessor()->Submit(command);
 
-  // adjusts treectrl focus
-  FocusTreeCtrlSpanItem(command->index());
+  // adjusts list focus
+  FocusSpanRow(command->index());
 }
 
-void EditPane::CopySpan(const wxTreeItemId& id) {
-  // gets tree item data
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
-
+void EditPane::CopySpan(const int& index) {
   // copies span and updates name
-  Span span = *(data->iter());
+  const Span* span_doc = listctrl_->SpanRow(index);
+  if (span_doc == nullptr) {
+    return;
+  }
+
+  Span span = *span_doc;
   span.name = NameVersioned(span.name);
 
   // updates document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
 
   SpanCommand* command = new SpanCommand(SpanCommand::kNameInsert);
-  const int index = std::distance(doc->spans().cbegin(), data->iter()) + 1;
-  command->set_index(index);
+  command->set_index(index + 1);
 
-  wxXmlNode* node = SpanCommand::SaveSpanToXml(span);
-  command->set_node_span(node);
+  command->set_span(span);
 
   doc->GetCommandProcessor()->Submit(command);
 
-  // adjusts treectrl focus
-  FocusTreeCtrlSpanItem(command->index());
+  // adjusts list focus
+  FocusSpanRow(command->index());
 }
 
-void EditPane::DeactivateSpan(const wxTreeItemId& id) {
+void EditPane::DeactivateSpan(const int& index) {
   wxLogVerbose("Deactivating span.");
 
-  // gets iterator to span
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
-  auto iter = data->iter();
-
   // updates document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
   doc->set_index_activated(-1);
 
   // posts a view update
   UpdateHint hint(UpdateHint::Type::kSpansEdit);
-  hint.set_index_span(index_bold_);
+  hint.set_index_span(listctrl_->index_bold());
   hint.set_name_command("Deactivate Span");
   doc->UpdateAllViews(nullptr, &hint);
 
-  // updates treectrl focus
-  const int index = std::distance(doc->spans().cbegin(), iter);
-  FocusTreeCtrlSpanItem(index);
+  // updates list focus
+  FocusSpanRow(index);
 }
 
-void EditPane::DeleteSpan(const wxTreeItemId& id) {
-  // gets tree item data
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
+void EditPane::DeleteSpan(const int& index) {
+  if (listctrl_->IsValidRow(index) == false) {
+    return;
+  }
 
   // updates document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  const int index = std::distance(doc->spans().cbegin(), data->iter());
 
   SpanCommand* command = new SpanCommand(SpanCommand::kNameDelete);
   command->set_index(index);
 
   doc->GetCommandProcessor()->Submit(command);
 
-  // adjusts treectrl focus
-  FocusTreeCtrlSpanItem(command->index() - 1);
+  // adjusts list focus
+  FocusSpanRow(command->index() - 1);
 }
 
-void EditPane::EditSpan(const wxTreeItemId& id) {
-  // gets tree item data and copies span
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
-  Span span = *(data->iter());
+void EditPane::DeleteSpansAll() {
+  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
+  const int kSizeSpans = doc->spans().size();
+  if (kSizeSpans == 0) {
+    return;
+  }
+
+  // confirms with the user
+  std::string message = "Delete all " + std::to_string(kSizeSpans)
+                        + " spans?";
+  if (wxMessageBox(message, "Delete All Spans", wxYES_NO | wxICON_QUESTION,
+                   this) != wxYES) {
+    return;
+  }
+
+  // deletes from the end so the indexes stay valid as the batch is applied
+  SpanBatchCommand* command = new SpanBatchCommand("Delete All Spans");
+  for (int index = kSizeSpans - 1; 0 <= index; index--) {
+    SpanCommand* command_span = new SpanCommand(SpanCommand::kNameDelete);
+    command_span->set_index(index);
+    command->Add(command_span);
+  }
 
-  // converts span to 'different' unit style
-  SpanUnitConverter::ConvertUnitStyleToDifferent(wxGetApp().config()->units,
+  doc->GetCommandProcessor()->Submit(command);
+}
+
+void EditPane::EditSpan(const int& index) {
+  // copies span
+  const Span* span_doc = listctrl_->SpanRow(index);
+  if (span_doc == nullptr) {
+    return;
+  }
+  Span span = *span_doc;
+
+  // converts span to the display unit system and 'different' unit style
+  const units::UnitSystem units_display = wxGetApp().config()->units;
+  SpanUnitConverter::ConvertUnitSystem(wxGetApp().units_model(),
+                                       units_display, true, span);
+  SpanUnitConverter::ConvertUnitStyleToDifferent(units_display,
                                                  true,
                                                  span);
 
@@ -301,133 +321,80 @@ void EditPane::EditSpan(const wxTreeItemId& id) {
   SpanEditorDialog dialog(view_->GetFrame(),
                           &cablefiles,
                           &weathercases,
-                          wxGetApp().config()->units,
+                          units_display,
                           &span);
   if (dialog.ShowModal() != wxID_OK) {
     return;
   }
 
-  // converts span to 'consistent' unit style
+  // converts span to 'consistent' unit style and the model unit system
   SpanUnitConverter::ConvertUnitStyleToConsistent(0,
-                                                  wxGetApp().config()->units,
+                                                  units_display,
                                                   true,
                                                   span);
+  SpanUnitConverter::ConvertUnitSystem(units_display,
+                                       wxGetApp().units_model(), true, span);
 
   // updates document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
 
   SpanCommand* command = new SpanCommand(SpanCommand::kNameModify);
-  const int index = std::distance(doc->spans().cbegin(), data->iter());
   command->set_index(index);
 
-  wxXmlNode* node = SpanCommand::SaveSpanToXml(span);
-  command->set_node_span(node);
+  command->set_span(span);
 
   doc->GetCommandProcessor()->Submit(command);
 
-  // adjusts treectrl focus
-  FocusTreeCtrlSpanItem(command->index());
+  // adjusts list focus
+  FocusSpanRow(command->index());
 }
 
-void EditPane::FocusTreeCtrlSpanItem(const int& index) {
-  // gets the treectrl item
-  wxTreeItemId id;
-  wxTreeItemIdValue cookie;
-  for (auto i = 0; i <= index; i++) {
-    if (i == 0) {
-      id = treectrl_->GetFirstChild(treectrl_->GetRootItem(), cookie);
-    } else {
-      id = treectrl_->GetNextSibling(id);
-    }
-  }
-
-  if (id.IsOk() == true) {
-    // sets focus
-    treectrl_->SetFocusedItem(id);
-
-    // sets selection
-    treectrl_->UnselectAll();
-    treectrl_->SelectItem(id);
-
-    // sets application focus
-    treectrl_->SetFocus();
+void EditPane::FocusSpanRow(const int& index) {
+  if (listctrl_->IsValidRow(index) == false) {
+    return;
   }
-}
 
-void EditPane::InitializeTreeCtrl() {
-  // gets root
-  wxTreeItemId root = treectrl_->GetRootItem();
+  // sets selection and scrolls the row into view
+  listctrl_->SelectRow(index);
 
-  // adds items for all spans in document
-  UpdateTreeCtrlSpanItems(nullptr);
-
-  // expands to show all spans
-  treectrl_->Expand(root);
+  // sets application focus
+  listctrl_->SetFocus();
 }
 
-wxTreeItemId EditPane::InsertTreeCtrlItem(const int& index) {
-  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  auto iter = std::next(doc->spans().cbegin(), index);
-  const Span& span = *iter;
-
-  // inserts
-  wxTreeItemId item = treectrl_->InsertItem(treectrl_->GetRootItem(), index,
-                                            span.name);
-
-  // adds item data
-  SpanTreeItemData* data = new SpanTreeItemData();
-  data->set_iter(iter);
-  treectrl_->SetItemData(item, data);
-
-  return item;
-}
-
-void EditPane::MoveSpanDown(const wxTreeItemId& id) {
-  // checks to make sure item isn't the last one
-  wxTreeItemId id_next = treectrl_->GetNextSibling(id);
-  if (id_next.IsOk() == false) {
+void EditPane::MoveSpanDown(const int& index) {
+  // checks to make sure row isn't the last one
+  if (listctrl_->IsValidRow(index + 1) == false) {
     return;
   }
 
-  // gets tree item data
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
-
   // updates document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  const int index = std::distance(doc->spans().cbegin(), data->iter());
 
   SpanCommand* command = new SpanCommand(SpanCommand::kNameMoveDown);
   command->set_index(index);
 
   doc->GetCommandProcessor()->Submit(command);
 
-  // adjusts treectrl focus
-  FocusTreeCtrlSpanItem(command->index());
+  // adjusts list focus
+  FocusSpanRow(command->index());
 }
 
-void EditPane::MoveSpanUp(const wxTreeItemId& id) {
-  // checks to make sure item isn't the first one
-  wxTreeItemId id_prev = treectrl_->GetPrevSibling(id);
-  if (id_prev.IsOk() == false) {
+void EditPane::MoveSpanUp(const int& index) {
+  // checks to make sure row isn't the first one
+  if ((listctrl_->IsValidRow(index) == false) || (index == 0)) {
     return;
   }
 
-  // gets tree item data
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
-
   // updates document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  const int index = std::distance(doc->spans().cbegin(), data->iter());
 
   SpanCommand* command = new SpanCommand(SpanCommand::kNameMoveUp);
   command->set_index(index);
 
   doc->GetCommandProcessor()->Submit(command);
 
-  // adjusts treectrl focus
-  FocusTreeCtrlSpanItem(command->index());
+  // adjusts list focus
+  FocusSpanRow(command->index());
 }
 
 std::string EditPane::NameVersioned(const std::string& name) const {
@@ -497,273 +464,240 @@ void EditPane::OnButtonAdd(wxCommandEvent& event) {
 void EditPane::OnButtonCopy(wxCommandEvent& event) {
   wxBusyCursor cursor;
 
-  // gets selected tree item
-  wxTreeItemId id_item = treectrl_->GetSelection();
-  if (id_item.IsOk() == false) {
-    return;
-  }
-
-  // checks to make sure item isn't root
-  if (id_item == treectrl_->GetRootItem()) {
+  // gets selected row
+  const int index = listctrl_->RowSelected();
+  if (index == -1) {
     return;
   }
 
   // copies span
-  CopySpan(id_item);
+  CopySpan(index);
 }
 
 void EditPane::OnButtonDelete(wxCommandEvent& event) {
   wxBusyCursor cursor;
 
-  // gets selected tree item
-  wxTreeItemId id_item = treectrl_->GetSelection();
-  if (id_item.IsOk() == false) {
-    return;
-  }
-
-  // checks to make sure item isn't root
-  if (id_item == treectrl_->GetRootItem()) {
+  // gets selected row
+  const int index = listctrl_->RowSelected();
+  if (index == -1) {
     return;
   }
 
   // deletes span
-  DeleteSpan(id_item);
+  DeleteSpan(index);
 }
 
 void EditPane::OnButtonEdit(wxCommandEvent& event) {
   // can't create busy cursor, a dialog is used further along
 
-  // gets selected tree item
-  wxTreeItemId id_item = treectrl_->GetSelection();
-  if (id_item.IsOk() == false) {
-    return;
-  }
-
-  // checks to make sure item isn't root
-  if (id_item == treectrl_->GetRootItem()) {
+  // gets selected row
+  const int index = listctrl_->RowSelected();
+  if (index == -1) {
     return;
   }
 
   // edits span
-  EditSpan(id_item);
+  EditSpan(index);
 }
 
 void EditPane::OnButtonMoveDown(wxCommandEvent& event) {
   wxBusyCursor cursor;
 
-  // gets selected tree item
-  wxTreeItemId id_item = treectrl_->GetSelection();
-  if (id_item.IsOk() == false) {
-    return;
-  }
-
-  // checks to make sure item isn't root
-  if (id_item == treectrl_->GetRootItem()) {
+  // gets selected row
+  const int index = listctrl_->RowSelected();
+  if (index == -1) {
     return;
   }
 
   // moves span
-  MoveSpanDown(id_item);
+  MoveSpanDown(index);
 }
 
 void EditPane::OnButtonMoveUp(wxCommandEvent& event) {
   wxBusyCursor cursor;
 
-  // gets selected tree item
-  wxTreeItemId id_item = treectrl_->GetSelection();
-  if (id_item.IsOk() == false) {
+  // gets selected row
+  const int index = listctrl_->RowSelected();
+  if (index == -1) {
     return;
   }
 
-  // checks to make sure item isn't root
-  if (id_item == treectrl_->GetRootItem()) {
+  // moves span
+  MoveSpanUp(index);
+}
+
+void EditPane::OnContextMenu(wxContextMenuEvent& event) {
+  // only shows a context menu for the span list
+  if (event.GetEventObject() != listctrl_) {
+    event.Skip();
     return;
   }
 
-  // moves span
-  MoveSpanUp(id_item);
+  // gets the row at the event position
+  // the position is the default position if the menu key was pressed
+  int index = -1;
+  const wxPoint point = event.GetPosition();
+  if (point == wxDefaultPosition) {
+    index = listctrl_->RowSelected();
+  } else {
+    int flags = 0;
+    index = listctrl_->HitTest(listctrl_->ScreenToClient(point), flags);
+  }
+
+  // displays a context menu based on the row that was right clicked
+  wxMenu menu;
+  if (listctrl_->IsValidRow(index) == false) {
+    menu.Append(kListAdd, "Add Span");
+    menu.Append(kListDeleteAll, "Delete All Spans");
+  } else {  // a span is selected
+    listctrl_->SelectRow(index);
+
+    // determines if the row is currently activated
+    if (index != listctrl_->index_bold()) {
+      menu.Append(kListItemActivate, "Activate");
+    } else {
+      menu.Append(kListItemDeactivate, "Deactivate");
+    }
+    menu.AppendSeparator();
+    menu.Append(kListItemEdit, "Edit");
+    menu.Append(kListItemCopy, "Copy");
+    menu.Append(kListItemDelete, "Delete");
+    menu.AppendSeparator();
+    menu.Append(kListItemMoveUp, "Move Up");
+    menu.Append(kListItemMoveDown, "Move Down");
+
+    // the reliability analysis uses the activated span line cable
+    if (index == listctrl_->index_bold()) {
+      menu.AppendSeparator();
+      menu.Append(kListItemReliability, "Reliability Analysis");
+    }
+  }
+
+  // shows context menu
+  // the event is caught by the edit panel
+  PopupMenu(&menu);
 }
 
 void EditPane::OnContextMenuSelect(wxCommandEvent& event) {
-  // gets selected tree item data
-  wxTreeItemId id_item = treectrl_->GetSelection();
-  if (id_item.IsOk() == false) {
+  // gets context menu selection and sends to handler function
+  const int id_event = event.GetId();
+  if (id_event == kListAdd) {
+    // can't create busy cursor, a dialog is used further along
+    AddSpan();
+    return;
+  } else if (id_event == kListDeleteAll) {
+    // can't create busy cursor, a dialog is used further along
+    DeleteSpansAll();
     return;
   }
 
-  // gets context menu selection and sends to handler function
-  const int id_event = event.GetId();
-  if (id_event == kTreeItemActivate) {
+  // gets selected row
+  const int index = listctrl_->RowSelected();
+  if (index == -1) {
+    return;
+  }
+
+  if (id_event == kListItemActivate) {
     wxBusyCursor cursor;
-    ActivateSpan(id_item);
-  } else if (id_event == kTreeItemCopy) {
+    ActivateSpan(index);
+  } else if (id_event == kListItemCopy) {
     wxBusyCursor cursor;
-    CopySpan(id_item);
-  } else if (id_event == kTreeItemDeactivate) {
+    CopySpan(index);
+  } else if (id_event == kListItemDeactivate) {
     wxBusyCursor cursor;
-    DeactivateSpan(id_item);
-  } else if (id_event == kTreeItemDelete) {
+    DeactivateSpan(index);
+  } else if (id_event == kListItemDelete) {
     wxBusyCursor cursor;
-    DeleteSpan(id_item);
-  } else if (id_event == kTreeItemEdit) {
+    DeleteSpan(index);
+  } else if (id_event == kListItemEdit) {
     // can't create busy cursor, a dialog is used further along
-    EditSpan(id_item);
-  } else if (id_event == kTreeItemMoveDown) {
+    EditSpan(index);
+  } else if (id_event == kListItemMoveDown) {
     wxBusyCursor cursor;
-    MoveSpanDown(id_item);
-  } else if (id_event == kTreeItemMoveUp) {
+    MoveSpanDown(index);
+  } else if (id_event == kListItemMoveUp) {
     wxBusyCursor cursor;
-    MoveSpanUp(id_item);
-  } else if (id_event == kTreeRootAdd) {
+    MoveSpanUp(index);
+  } else if (id_event == kListItemReliability) {
     // can't create busy cursor, a dialog is used further along
-    AddSpan();
+    RunReliabilityAnalysis(index);
   }
 }
 
-void EditPane::OnItemActivate(wxTreeEvent& event) {
+void EditPane::OnItemActivate(wxListEvent& event) {
   wxBusyCursor cursor;
 
-  // gets activated item from event
-  wxTreeItemId id = event.GetItem();
-  ActivateSpan(id);
+  // gets activated row from event
+  ActivateSpan(event.GetIndex());
 }
 
-void EditPane::OnItemMenu(wxTreeEvent& event) {
-  // gets item from event
-  wxTreeItemId id = event.GetItem();
-  treectrl_->SetFocusedItem(id);
-
-  // gets selected span item and the activated span (document)
-  // determines if the selected item is currently activated
-  SpanTreeItemData* data =
-      dynamic_cast<SpanTreeItemData*>(treectrl_->GetItemData(id));
-  const Span* span_selected = &(*data->iter());
-
+void EditPane::RunReliabilityAnalysis(const int& index) {
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  const Span* span_activated = doc->SpanActivated();
+  if (index != doc->index_activated()) {
+    return;
+  }
 
-  bool is_activated = false;
-  if (span_selected == span_activated) {
-    is_activated = true;
+  // checks the span before solving any samples
+  const Span* span = doc->SpanActivated();
+  if (span == nullptr) {
+    return;
   }
 
-  // displays a context menu based on the item that was right clicked
-  wxMenu menu;
-  if (id == treectrl_->GetRootItem()) {
-    menu.Append(kTreeRootAdd, "Add Span");
-  } else {  // a span is selected
-    if (is_activated == false) {
-      menu.Append(kTreeItemActivate, "Activate");
-    } else {
-      menu.Append(kTreeItemDeactivate, "Deactivate");
-    }
-    menu.AppendSeparator();
-    menu.Append(kTreeItemEdit, "Edit");
-    menu.Append(kTreeItemCopy, "Copy");
-    menu.Append(kTreeItemDelete, "Delete");
-    menu.AppendSeparator();
-    menu.Append(kTreeItemMoveUp, "Move Up");
-    menu.Append(kTreeItemMoveDown, "Move Down");
+  if (span->Validate(false, nullptr) == false) {
+    wxMessageBox("Span validation error(s) present. Fix before running a "
+                 "reliability analysis.");
+    return;
   }
 
-  // shows context menu
-  // the event is caught by the edit panel
-  PopupMenu(&menu, event.GetPoint());
+  // logs
+  std::string message = "Running reliability analysis for span at index "
+                        + std::to_string(index) + ".";
+  wxLogVerbose(message.c_str());
 
-  // stops processing event (needed to allow pop-up menu to catch its event)
-  event.Skip();
+  // shows the dialog, which runs the analysis
+  ReliabilityDialog dialog(view_->GetFrame(), span,
+                           wxGetApp().config()->units,
+                           doc->max_threads_analysis());
+  dialog.ShowModal();
 }
 
-void EditPane::UpdateTreeCtrlBoldItem() {
-  wxTreeItemId root = treectrl_->GetRootItem();
-  wxTreeItemIdValue cookie;
-
-  // unbolds existing selection
-  if (0 <= index_bold_) {
-    wxTreeItemId item_unbold = treectrl_->GetFirstChild(root, cookie);
-    for (int i = 0; i < index_bold_; i++) {
-      item_unbold = treectrl_->GetNextSibling(item_unbold);
-    }
-
-    treectrl_->SetItemBold(item_unbold, false);
-  }
-
-  // bolds new selection
+void EditPane::UpdateBoldRow() {
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  if (0 <= doc->index_activated()) {
-    wxTreeItemId item_bold = treectrl_->GetFirstChild(root, cookie);
-    for (int i = 0; i < doc->index_activated(); i++) {
-      item_bold = treectrl_->GetNextSibling(item_bold);
-    }
-
-    treectrl_->SetItemBold(item_bold, true);
-    index_bold_ = doc->index_activated();
-  }
+  listctrl_->set_index_bold(doc->index_activated());
 }
 
-void EditPane::UpdateTreeCtrlSpanItems(const UpdateHint* hint) {
-  treectrl_->Freeze();
-
-  // gets information from document and treectrl
+void EditPane::UpdateSpanRows(const UpdateHint* hint) {
+  // gets information from document
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
   const std::list<Span>& spans = doc->spans();
-  wxTreeItemId root = treectrl_->GetRootItem();
 
-  // updates treectrl
+  // updates list
   if ((hint == nullptr) || (hint->name_command() == "")) {
-    // rebuilds treectrl
-
-    // clears treectrl
-    treectrl_->DeleteChildren(root);
-
-    // repopulates treectrl
-    for (auto iter = spans.cbegin(); iter != spans.cend(); iter++) {
-      const Span* span = &(*iter);
-
-      wxTreeItemId item = treectrl_->AppendItem(root, span->name);
-
-      SpanTreeItemData* data = new SpanTreeItemData();
-      data->set_iter(iter);
-      treectrl_->SetItemData(item, data);
-    }
-
-    // expands treectrl root
-    treectrl_->Expand(root);
-  } else {
-    // partially updates treectrl
-
-    // gets the treectrl item that matches the index
-    wxTreeItemIdValue cookie;
-    wxTreeItemId item = treectrl_->GetFirstChild(root, cookie);
-
-    for (int i = 0; i < hint->index_span(); i++) {
-      item = treectrl_->GetNextSibling(item);
-    }
-
-    // modifies existing treectrl items
-    if (hint->name_command() == "Activate Span") {
-      UpdateTreeCtrlBoldItem();
-    } else if (hint->name_command() == "Deactivate Span") {
-      UpdateTreeCtrlBoldItem();
-    } else if (hint->name_command() == SpanCommand::kNameDelete) {
-      treectrl_->Delete(item);
-    } else if (hint->name_command() == SpanCommand::kNameInsert) {
-      InsertTreeCtrlItem(hint->index_span());
-    } else if (hint->name_command() == SpanCommand::kNameModify) {
-      const Span& span = *std::next(spans.cbegin(), hint->index_span());
-      treectrl_->SetItemText(item, span.name);
-    } else if (hint->name_command() == SpanCommand::kNameMoveDown) {
-      wxTreeItemId item_prev = treectrl_->GetPrevSibling(item);
-      treectrl_->Delete(item_prev);
-      InsertTreeCtrlItem(hint->index_span());
-      UpdateTreeCtrlBoldItem();
-    } else if (hint->name_command() == SpanCommand::kNameMoveUp) {
-      wxTreeItemId item_next = treectrl_->GetNextSibling(item);
-      treectrl_->Delete(item_next);
-      InsertTreeCtrlItem(hint->index_span());
-      UpdateTreeCtrlBoldItem();
-    }
+    // rebuilds the row index, which doesn't create any list items
+    listctrl_->RebuildRows(spans);
+    UpdateBoldRow();
+    return;
   }
 
-  treectrl_->Thaw();
+  // partially updates the row index
+  const int index = hint->index_span();
+  if (hint->name_command() == "Activate Span") {
+    UpdateBoldRow();
+  } else if (hint->name_command() == "Deactivate Span") {
+    UpdateBoldRow();
+  } else if (hint->name_command() == SpanCommand::kNameDelete) {
+    listctrl_->DeleteRow(index);
+    UpdateBoldRow();
+  } else if (hint->name_command() == SpanCommand::kNameInsert) {
+    listctrl_->InsertRow(index, spans);
+    UpdateBoldRow();
+  } else if (hint->name_command() == SpanCommand::kNameModify) {
+    listctrl_->RefreshRow(index);
+  } else if (hint->name_command() == SpanCommand::kNameMoveDown) {
+    listctrl_->SwapRows(index - 1, index);
+    UpdateBoldRow();
+  } else if (hint->name_command() == SpanCommand::kNameMoveUp) {
+    listctrl_->SwapRows(index, index + 1);
+    UpdateBoldRow();
+  }
 }
@@ -9,12 +9,16 @@
 #include "appcommon/widgets/status_bar_log.h"
 #include "wx/dir.h"
 #include "wx/filename.h"
+#include "wx/wfstream.h"
 #include "wx/xml/xml.h"
 
 #include "spananalyzer/cable_file_xml_handler.h"
+#include "spananalyzer/display_unit_converter.h"
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_config_xml_handler.h"
 #include "spananalyzer/span_analyzer_data_xml_handler.h"
+#include "spananalyzer/span_analyzer_doc_xml_handler.h"
+#include "spananalyzer/xml_stream_writer.h"
 
 int FileHandler::LoadAppData(const std::string& filepath,
                              const units::UnitSystem& units,
@@ -77,8 +81,9 @@ int FileHandler::LoadAppData(const std::string& filepath,
   const bool status_node = SpanAnalyzerDataXmlHandler::ParseNode(
       root, filepath, units_file, data);
 
-  // converts unit systems if the file doesn't match applicaton config
-  if (units_file != wxGetApp().config()->units) {
+  // converts unit systems if the file doesn't match the requested system
+  // cable files are converted when they are loaded
+  if (units_file != units) {
     for (auto iter = data.weathercases.begin();
           iter != data.weathercases.end(); iter++) {
       WeatherLoadCase* weathercase = *iter;
@@ -87,6 +92,12 @@ int FileHandler::LoadAppData(const std::string& filepath,
           units,
           *weathercase);
     }
+
+    for (auto iter = data.constraints.begin(); iter != data.constraints.end();
+         iter++) {
+      CableConstraint& constraint = *iter;
+      DisplayUnitConverter::ConvertUnitSystem(units_file, units, constraint);
+    }
   }
 
   // resets statusbar
@@ -162,10 +173,10 @@ int FileHandler::LoadCable(const std::string& filepath,
       true,
       cable);
 
-  // converts unit systems if the file doesn't match applicaton config
-  units::UnitSystem units_config = wxGetApp().config()->units;
-  if (units_file != units_config) {
-    CableUnitConverter::ConvertUnitSystem(units_file, units_config,
+  // converts unit systems if the file doesn't match the model
+  const units::UnitSystem units_model = wxGetApp().units_model();
+  if (units_file != units_model) {
+    CableUnitConverter::ConvertUnitSystem(units_file, units_model,
                                           true, cable);
   }
 
@@ -266,9 +277,6 @@ int FileHandler::LoadConfigFile(const std::string& filepath,
   }
 }
 
-/// To avoid re-allocating all of the app data for a different unit style,
-/// this function will convert the data to the different unit style and
-/// then back to the consistent unit style.
 void FileHandler::SaveAppData(const std::string& filepath,
                               const SpanAnalyzerData& data,
                               const units::UnitSystem& units) {
@@ -277,45 +285,9 @@ void FileHandler::SaveAppData(const std::string& filepath,
   wxLogVerbose(message.c_str());
   status_bar_log::PushText(message, 0);
 
-  // cables are stored in individual files, and are not included in the app
-  // data file
-
-  // converts weathercases to 'different' unit style
-  for (auto iter = data.weathercases.begin();
-        iter != data.weathercases.end(); iter++) {
-    WeatherLoadCase* weathercase = *iter;
-    WeatherLoadCaseUnitConverter::ConvertUnitStyleToDifferent(
-        units,
-        *weathercase);
-  }
-
-  // generates an xml node
-  wxXmlNode* root = SpanAnalyzerDataXmlHandler::CreateNode(
-      data, units, units::UnitStyle::kDifferent);
-
-  // creates any directories that are needed
-  wxFileName filename(filepath);
-  if (filename.DirExists() == false) {
-    filename.Mkdir(wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
-  }
-
-  // creates an xml document and saves
-  wxXmlDocument doc;
-  doc.SetRoot(root);
-  bool status = doc.Save(filepath, 2);
-  if (status == false) {
-    wxLogError("File didn't save");
-  }
-
-  // converts weathercases to 'consistent' unit style
-  for (auto iter = data.weathercases.begin();
-        iter != data.weathercases.end(); iter++) {
-    WeatherLoadCase* weathercase = *iter;
-    WeatherLoadCaseUnitConverter::ConvertUnitStyleToConsistent(
-        0,
-        units,
-        *weathercase);
-  }
+  // writes the file
+  // the data is converted to the 'different' unit style as it is written
+  WriteAppData(filepath, data, units);
 
   // resets statusbar
   status_bar_log::PopText(0);
@@ -384,3 +356,68 @@ void FileHandler::SaveConfigFile(const std::string& filepath,
   // resets statusbar
   status_bar_log::PopText(0);
 }
+
+bool FileHandler::WriteAppData(const std::string& filepath,
+                               const SpanAnalyzerData& data,
+                               const units::UnitSystem& units) {
+  // cables are stored in individual files, and are not included in the app
+  // data file
+
+  // streams the xml to a temporary file
+  const std::string filepath_temp = TempFilepath(filepath);
+  bool status = false;
+  {
+    wxFileOutputStream stream(filepath_temp);
+    if (stream.IsOk() == true) {
+      XmlStreamWriter writer(stream);
+      writer.StartDocument();
+      SpanAnalyzerDataXmlHandler::WriteNode(
+          data, units, units::UnitStyle::kDifferent, writer);
+      status = writer.EndDocument() && stream.Close();
+    }
+  }
+
+  return ReplaceFile(filepath_temp, filepath, status);
+}
+
+bool FileHandler::WriteDocument(const std::string& filepath,
+                                const std::list<Span>& spans,
+                                const units::UnitSystem& units) {
+  // streams the xml to a temporary file
+  const std::string filepath_temp = TempFilepath(filepath);
+  bool status = false;
+  {
+    wxFileOutputStream stream(filepath_temp);
+    if (stream.IsOk() == true) {
+      XmlStreamWriter writer(stream);
+      writer.StartDocument();
+      SpanAnalyzerDocXmlHandler::WriteNode(spans, units, writer);
+      status = writer.EndDocument() && stream.Close();
+    }
+  }
+
+  return ReplaceFile(filepath_temp, filepath, status);
+}
+
+bool FileHandler::ReplaceFile(const std::string& filepath_temp,
+                              const std::string& filepath,
+                              const bool& status) {
+  if ((status == false)
+      || (wxRenameFile(filepath_temp, filepath, true) == false)) {
+    wxLogError("File didn't save");
+    wxRemoveFile(filepath_temp);
+    return false;
+  }
+
+  return true;
+}
+
+std::string FileHandler::TempFilepath(const std::string& filepath) {
+  // creates any directories that are needed
+  wxFileName filename(filepath);
+  if (filename.DirExists() == false) {
+    filename.Mkdir(wxS_DIR_DEFAULT, wxPATH_MKDIR_FULL);
+  }
+
+  return filepath + ".tmp";
+}
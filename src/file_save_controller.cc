@@ -0,0 +1,265 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/file_save_controller.h"
+
+#include "wx/wx.h"
+
+#include "spananalyzer/file_handler.h"
+
+FileSaveSnapshot::FileSaveSnapshot() {
+  type_ = Type::kNull;
+}
+
+FileSaveSnapshot::~FileSaveSnapshot() {
+}
+
+void FileSaveSnapshot::CaptureData(const SpanAnalyzerData& data) {
+  type_ = Type::kAppData;
+
+  // copies cable files
+  for (auto iter = data.cablefiles.cbegin(); iter != data.cablefiles.cend();
+       iter++) {
+    const CableFile* cablefile = *iter;
+    cablefiles_.push_back(*cablefile);
+
+    CableFile* cablefile_copy = &cablefiles_.back();
+    map_cables_[&cablefile->cable] = &cablefile_copy->cable;
+    data_.cablefiles.push_back(cablefile_copy);
+  }
+
+  // copies weathercases
+  for (auto iter = data.weathercases.cbegin();
+       iter != data.weathercases.cend(); iter++) {
+    const WeatherLoadCase* weathercase = *iter;
+    data_.weathercases.push_back(CopyWeathercase(weathercase));
+  }
+
+  // copies constraints and redirects weathercase references
+  for (auto iter = data.constraints.cbegin(); iter != data.constraints.cend();
+       iter++) {
+    CableConstraint constraint = *iter;
+    constraint.case_weather = CopyWeathercase(constraint.case_weather);
+    data_.constraints.push_back(constraint);
+  }
+
+  // copies analysis filter groups and redirects weathercase references
+  for (auto iter = data.groups_filters.cbegin();
+       iter != data.groups_filters.cend(); iter++) {
+    AnalysisFilterGroup group = *iter;
+    for (auto it = group.filters.begin(); it != group.filters.end(); it++) {
+      AnalysisFilter& filter = *it;
+      filter.weathercase = CopyWeathercase(filter.weathercase);
+    }
+    data_.groups_filters.push_back(group);
+  }
+}
+
+void FileSaveSnapshot::CaptureSpans(const std::list<Span>& spans) {
+  type_ = Type::kDocument;
+
+  for (auto iter = spans.cbegin(); iter != spans.cend(); iter++) {
+    // copies span and removes connections
+    spans_.push_back(*iter);
+    Span& span = spans_.back();
+    LineCable& linecable = span.linecable;
+    linecable.ClearConnections();
+
+    // redirects cable and weathercase references
+    linecable.set_cable(CopyCable(linecable.cable()));
+
+    CableConstraint constraint = linecable.constraint();
+    constraint.case_weather = CopyWeathercase(constraint.case_weather);
+    linecable.set_constraint(constraint);
+
+    linecable.set_weathercase_stretch_creep(
+        CopyWeathercase(linecable.weathercase_stretch_creep()));
+    linecable.set_weathercase_stretch_load(
+        CopyWeathercase(linecable.weathercase_stretch_load()));
+  }
+}
+
+const SpanAnalyzerData& FileSaveSnapshot::data() const {
+  return data_;
+}
+
+const std::list<Span>& FileSaveSnapshot::spans() const {
+  return spans_;
+}
+
+FileSaveSnapshot::Type FileSaveSnapshot::type() const {
+  return type_;
+}
+
+Cable* FileSaveSnapshot::CopyCable(const Cable* cable) {
+  if (cable == nullptr) {
+    return nullptr;
+  }
+
+  // searches for an existing copy
+  auto iter = map_cables_.find(cable);
+  if (iter != map_cables_.end()) {
+    return iter->second;
+  }
+
+  // copies the cable
+  cables_.push_back(*cable);
+  Cable* cable_copy = &cables_.back();
+  map_cables_[cable] = cable_copy;
+
+  return cable_copy;
+}
+
+WeatherLoadCase* FileSaveSnapshot::CopyWeathercase(
+    const WeatherLoadCase* weathercase) {
+  if (weathercase == nullptr) {
+    return nullptr;
+  }
+
+  // searches for an existing copy
+  auto iter = map_weathercases_.find(weathercase);
+  if (iter != map_weathercases_.end()) {
+    return iter->second;
+  }
+
+  // copies the weathercase
+  weathercases_.push_back(*weathercase);
+  WeatherLoadCase* weathercase_copy = &weathercases_.back();
+  map_weathercases_[weathercase] = weathercase_copy;
+
+  return weathercase_copy;
+}
+
+FileSaveThread::FileSaveThread(const std::string& filepath,
+                               const units::UnitSystem& units,
+                               FileSaveSnapshot* snapshot,
+                               const std::string& filepath_journal,
+                               wxEvtHandler* handler)
+    : wxThread(wxTHREAD_JOINABLE) {
+  filepath_ = filepath;
+  filepath_journal_ = filepath_journal;
+  handler_ = handler;
+  snapshot_.reset(snapshot);
+  status_ = false;
+  units_ = units;
+}
+
+const std::string& FileSaveThread::filepath() const {
+  return filepath_;
+}
+
+bool FileSaveThread::status() const {
+  return status_;
+}
+
+wxThread::ExitCode FileSaveThread::Entry() {
+  // writes the snapshot
+  if (snapshot_->type() == FileSaveSnapshot::Type::kAppData) {
+    status_ = FileHandler::WriteAppData(filepath_, snapshot_->data(), units_);
+  } else if (snapshot_->type() == FileSaveSnapshot::Type::kDocument) {
+    status_ = FileHandler::WriteDocument(filepath_, snapshot_->spans(),
+                                         units_);
+  }
+
+  if (status_ == false) {
+    std::string message = filepath_ + "  --  "
+                          "File couldn't be saved in the background.";
+    wxLogError(message.c_str());
+  } else if (filepath_journal_.empty() == false) {
+    // removes the journal, as its edits are now in the file
+    wxRemoveFile(filepath_journal_);
+  }
+
+  // releases the snapshot memory before the thread is joined
+  snapshot_.reset();
+
+  // notifies the handler on the main thread
+  if (handler_ != nullptr) {
+    wxThreadEvent* event = new wxThreadEvent(wxEVT_THREAD);
+    event->SetInt(status_);
+    event->SetString(filepath_);
+    wxQueueEvent(handler_, event);
+  }
+
+  return (wxThread::ExitCode)0;
+}
+
+FileSaveController::FileSaveController() {
+  status_ = true;
+  thread_ = nullptr;
+}
+
+FileSaveController::~FileSaveController() {
+  Wait();
+}
+
+bool FileSaveController::IsSaving() const {
+  return (thread_ != nullptr) && (thread_->IsAlive() == true);
+}
+
+bool FileSaveController::SaveAppData(const std::string& filepath,
+                                     const SpanAnalyzerData& data,
+                                     const units::UnitSystem& units) {
+  // logs
+  std::string message = "Saving application data file: " + filepath;
+  wxLogVerbose(message.c_str());
+
+  // captures a snapshot and writes it on a worker thread
+  FileSaveSnapshot* snapshot = new FileSaveSnapshot();
+  snapshot->CaptureData(data);
+
+  return Start(filepath, units, snapshot, "", nullptr);
+}
+
+bool FileSaveController::SaveDocument(const std::string& filepath,
+                                      const std::list<Span>& spans,
+                                      const units::UnitSystem& units,
+                                      const std::string& filepath_journal,
+                                      wxEvtHandler* handler) {
+  // logs
+  std::string message = "Saving document file: " + filepath;
+  wxLogVerbose(message.c_str());
+
+  // captures a snapshot and writes it on a worker thread
+  FileSaveSnapshot* snapshot = new FileSaveSnapshot();
+  snapshot->CaptureSpans(spans);
+
+  return Start(filepath, units, snapshot, filepath_journal, handler);
+}
+
+bool FileSaveController::Wait() {
+  if (thread_ == nullptr) {
+    return status_;
+  }
+
+  // joins the worker thread back into the calling thread
+  thread_->Wait();
+  status_ = thread_->status();
+
+  delete thread_;
+  thread_ = nullptr;
+
+  return status_;
+}
+
+bool FileSaveController::Start(const std::string& filepath,
+                               const units::UnitSystem& units,
+                               FileSaveSnapshot* snapshot,
+                               const std::string& filepath_journal,
+                               wxEvtHandler* handler) {
+  // waits for the previous save so files are written in order
+  Wait();
+
+  // starts the worker thread
+  thread_ = new FileSaveThread(filepath, units, snapshot, filepath_journal,
+                               handler);
+  if (thread_->Run() != wxTHREAD_NO_ERROR) {
+    wxLogError("Couldn't start file save thread.");
+    delete thread_;
+    thread_ = nullptr;
+    status_ = false;
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,506 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/line_section_solver.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+
+#include "models/sagtension/line_cable_reloader.h"
+#include "models/transmissionline/catenary.h"
+
+namespace {
+
+/// \var kIterationsMax
+///   The maximum number of equilibrium iterations.
+const int kIterationsMax = 50;
+
+/// \var kIterationsMaxTension
+///   The maximum number of iterations for a span tension solve.
+const int kIterationsMaxTension = 100;
+
+/// \var kStepStiffness
+///   The relative spacing step used to solve the span stiffness.
+const double kStepStiffness = 1e-4;
+
+/// \var kToleranceSwing
+///   The equilibrium tolerance, relative to the insulator length.
+const double kToleranceSwing = 1e-6;
+
+/// \var kToleranceTension
+///   The relative tolerance of a span tension solve.
+const double kToleranceTension = 1e-12;
+
+}  // namespace
+
+LineSectionThread::LineSectionThread() {
+  index_begin_ = 0;
+  index_end_ = 0;
+  is_solved_ = true;
+  lengths_reference_ = nullptr;
+  model_ = nullptr;
+  spacings_ = nullptr;
+  state_ = nullptr;
+  stiffnesses_ = nullptr;
+  tensions_ = nullptr;
+}
+
+void LineSectionThread::Process() {
+  is_solved_ = true;
+  for (int i = index_begin_; i < index_end_; i++) {
+    const Vector3d& spacing = spacings_->at(i);
+    const double& length_reference = lengths_reference_->at(i);
+
+    // solves the tension at the span spacing
+    double tension = 0;
+    if (SolveTension(spacing, length_reference, tensions_->at(i),
+                     tension) == false) {
+      is_solved_ = false;
+      continue;
+    }
+
+    // solves the tension at a slightly longer spacing to get the stiffness
+    const double step = kStepStiffness * spacing.x();
+    Vector3d spacing_step = spacing;
+    spacing_step.set_x(spacing.x() + step);
+    double tension_step = 0;
+    if (SolveTension(spacing_step, length_reference, tension,
+                     tension_step) == false) {
+      is_solved_ = false;
+      continue;
+    }
+
+    tensions_->at(i) = tension;
+    stiffnesses_->at(i) = (tension_step - tension) / step;
+  }
+}
+
+bool LineSectionThread::is_solved() const {
+  return is_solved_;
+}
+
+void LineSectionThread::set_indexes(const int& index_begin,
+                                    const int& index_end) {
+  index_begin_ = index_begin;
+  index_end_ = index_end;
+}
+
+void LineSectionThread::set_lengths_reference(
+    const std::vector<double>* lengths_reference) {
+  lengths_reference_ = lengths_reference;
+}
+
+void LineSectionThread::set_model(const CompiledCableModel* model) {
+  model_ = model;
+}
+
+void LineSectionThread::set_spacings(const std::vector<Vector3d>* spacings) {
+  spacings_ = spacings;
+}
+
+void LineSectionThread::set_state(const LineSectionState* state) {
+  state_ = state;
+}
+
+void LineSectionThread::set_stiffnesses(std::vector<double>* stiffnesses) {
+  stiffnesses_ = stiffnesses;
+}
+
+void LineSectionThread::set_tensions(std::vector<double>* tensions) {
+  tensions_ = tensions;
+}
+
+double LineSectionThread::LengthResidual(const Vector3d& spacing,
+                                         const double& length_reference,
+                                         const double& tension_horizontal) {
+  Catenary3d catenary;
+  catenary.set_spacing_endpoints(spacing);
+  catenary.set_tension_horizontal(tension_horizontal);
+  catenary.set_weight_unit(state_->weight_unit);
+
+  const double strain = model_->Strain(
+      CableElongationModel::ComponentType::kCombined,
+      catenary.TensionAverage());
+
+  return catenary.Length() - length_reference * (1 + strain);
+}
+
+bool LineSectionThread::SolveTension(const Vector3d& spacing,
+                                     const double& length_reference,
+                                     const double& tension_guess,
+                                     double& tension) {
+  // brackets the solution around the guess
+  // the residual decreases as the tension increases
+  double tension_low = tension_guess;
+  if (tension_low <= 0) {
+    tension_low = 1;
+  }
+  double residual_low = LengthResidual(spacing, length_reference, tension_low);
+
+  double tension_high = tension_low;
+  double residual_high = residual_low;
+
+  int iter = 0;
+  while ((0 < residual_high) && (iter < kIterationsMaxTension)) {
+    tension_low = tension_high;
+    residual_low = residual_high;
+    tension_high = tension_high * 2;
+    residual_high = LengthResidual(spacing, length_reference, tension_high);
+    iter++;
+  }
+
+  while ((residual_low < 0) && (iter < kIterationsMaxTension)) {
+    tension_high = tension_low;
+    residual_high = residual_low;
+    tension_low = tension_low / 2;
+    residual_low = LengthResidual(spacing, length_reference, tension_low);
+    iter++;
+  }
+
+  // checks if the residual changes sign within the bracket
+  if ((0 < residual_high) || (residual_low < 0)) {
+    return false;
+  }
+
+  // solves with a regula falsi (illinois) iteration
+  // the retained end point is weighted so the bracket keeps shrinking
+  tension = tension_low;
+  int side = 0;
+  for (iter = 0; iter < kIterationsMaxTension; iter++) {
+    if (residual_high == residual_low) {
+      break;
+    }
+
+    tension = (tension_low * residual_high - tension_high * residual_low)
+              / (residual_high - residual_low);
+    const double residual = LengthResidual(spacing, length_reference,
+                                           tension);
+
+    if ((std::abs(residual) <= kToleranceTension * length_reference)
+        || ((tension_high - tension_low) <= kToleranceTension * tension)) {
+      break;
+    }
+
+    if (0 < residual) {
+      tension_low = tension;
+      residual_low = residual;
+      if (side == 1) {
+        residual_high = residual_high / 2;
+      }
+      side = 1;
+    } else {
+      tension_high = tension;
+      residual_high = residual;
+      if (side == -1) {
+        residual_low = residual_low / 2;
+      }
+      side = -1;
+    }
+  }
+
+  return true;
+}
+
+
+LineSectionSolver::LineSectionSolver() {
+  cache_models_ = nullptr;
+  insulator_ = nullptr;
+  line_cable_ = nullptr;
+
+  max_threads_ = WorkerPool::NumThreads(0);
+}
+
+LineSectionSolver::~LineSectionSolver() {
+}
+
+bool LineSectionSolver::Initialize() {
+  std::string message;
+
+  lengths_reference_.clear();
+
+  // checks spans and line cable
+  if ((spans_.empty() == true) || (line_cable_ == nullptr)) {
+    wxLogError("Line section doesn't have any spans.");
+    return false;
+  }
+
+  // solves the ruling span at the constraint
+  const CableConstraint& constraint = line_cable_->constraint();
+
+  LineCableReloader reloader;
+  reloader.set_line_cable(line_cable_);
+  reloader.set_condition_reloaded(constraint.condition);
+  reloader.set_weathercase_reloaded(constraint.case_weather);
+  if (reloader.Validate(false, nullptr) == false) {
+    message = "Span: " + spans_.front()->name + "  --  "
+              "Constraint couldn't be solved. Line section can't be solved.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  const Catenary3d catenary_constraint = reloader.CatenaryReloaded();
+
+  // initializes the elongation model at the constraint
+  CableStretchState state_stretch;
+  if (constraint.condition == CableConditionType::kCreep) {
+    state_stretch = reloader.StretchStateCreep();
+  } else if (constraint.condition == CableConditionType::kLoad) {
+    state_stretch = reloader.StretchStateLoad();
+  } else {
+    state_stretch.load = 0;
+    state_stretch.temperature = 0;
+    state_stretch.type_polynomial =
+        SagTensionCableComponent::PolynomialType::kLoadStrain;
+  }
+
+  const std::shared_ptr<const CompiledCableModel> model =
+      Model(reloader.StateReloaded(), state_stretch);
+  if (model == nullptr) {
+    message = "Span: " + spans_.front()->name + "  --  "
+              "Cable model is invalid. Line section can't be solved.";
+    wxLogError(message.c_str());
+    return false;
+  }
+
+  // solves the reference length of each span
+  // all spans have the constraint horizontal tension
+  lengths_reference_.reserve(spans_.size());
+  for (auto iter = spans_.cbegin(); iter != spans_.cend(); iter++) {
+    const Span* span = *iter;
+
+    Catenary3d catenary;
+    catenary.set_spacing_endpoints(span->spacing_attachments);
+    catenary.set_tension_horizontal(catenary_constraint.tension_horizontal());
+    catenary.set_weight_unit(catenary_constraint.weight_unit());
+
+    const double strain = model->Strain(
+        CableElongationModel::ComponentType::kCombined,
+        catenary.TensionAverage());
+
+    lengths_reference_.push_back(catenary.Length() / (1 + strain));
+  }
+
+  return true;
+}
+
+bool LineSectionSolver::Solve(const SagTensionAnalysisResult& result_rulingspan,
+                              const CableStretchState& state_stretch,
+                              LineSectionResult& result) const {
+  // checks if initialized
+  const int kSizeSpans = spans_.size();
+  if ((kSizeSpans == 0) || (line_cable_ == nullptr)
+      || (static_cast<int>(lengths_reference_.size()) != kSizeSpans)) {
+    return false;
+  }
+
+  // initializes the loaded state
+  LineSectionState state;
+  state.state = result_rulingspan.state;
+  state.state_stretch = state_stretch;
+  state.weight_unit = result_rulingspan.weight_unit;
+
+  // gets the compiled cable model, which is shared by all iterations and
+  // threads
+  const std::shared_ptr<const CompiledCableModel> model =
+      Model(state.state, state.state_stretch);
+  if (model == nullptr) {
+    return false;
+  }
+
+  // gets the insulator properties
+  double length_insulator = 0;
+  double weight_insulator = 0;
+  if (insulator_ != nullptr) {
+    length_insulator = insulator_->length;
+    weight_insulator = insulator_->weight;
+  }
+
+  // the insulator displacements include the fixed dead-end structures
+  std::vector<double> swings(kSizeSpans + 1, 0);
+  std::vector<Vector3d> spacings(kSizeSpans);
+  std::vector<double> stiffnesses(kSizeSpans, 0);
+  std::vector<double> tensions(kSizeSpans,
+                               result_rulingspan.tension_horizontal);
+
+  // the tridiagonal jacobian, residual, and update
+  const int kSizeSwings = kSizeSpans - 1;
+  std::vector<double> a(kSizeSwings, 0);
+  std::vector<double> b(kSizeSwings, 0);
+  std::vector<double> c(kSizeSwings, 0);
+  std::vector<double> g(kSizeSwings, 0);
+
+  const double tolerance = kToleranceSwing * length_insulator;
+
+  // creates threads with contiguous span ranges
+  // the threads are started once and reused by every iteration
+  const int num_threads = std::min(max_threads_, kSizeSpans);
+
+  WorkerPool pool;
+  for (int i = 0; i < num_threads; i++) {
+    LineSectionThread* thread = new LineSectionThread();
+    thread->set_indexes(kSizeSpans * i / num_threads,
+                        kSizeSpans * (i + 1) / num_threads);
+    thread->set_lengths_reference(&lengths_reference_);
+    thread->set_model(model.get());
+    thread->set_spacings(&spacings);
+    thread->set_state(&state);
+    thread->set_stiffnesses(&stiffnesses);
+    thread->set_tensions(&tensions);
+    pool.Add(thread);
+  }
+
+  pool.Start();
+
+  const std::vector<WorkerThread*>& threads = pool.threads();
+
+  result.is_converged = false;
+  result.iterations = 0;
+  for (int iter = 1; iter <= kIterationsMax; iter++) {
+    result.iterations = iter;
+
+    // updates the span spacings with the insulator displacements
+    for (int i = 0; i < kSizeSpans; i++) {
+      spacings[i] = spans_[i]->spacing_attachments;
+      spacings[i].set_x(spacings[i].x() + swings[i + 1] - swings[i]);
+    }
+
+    // solves the span tensions and stiffnesses
+    pool.RunPass();
+
+    for (auto it = threads.cbegin(); it != threads.cend(); it++) {
+      const LineSectionThread* thread =
+          static_cast<const LineSectionThread*>(*it);
+      if (thread->is_solved() == false) {
+        std::string message = result_rulingspan.weathercase->description
+                              + "  --  Line section span tension couldn't "
+                              "be solved.";
+        wxLogError(message.c_str());
+        return false;
+      }
+    }
+
+    // without suspension insulators the spans are independent
+    if ((kSizeSwings == 0) || (length_insulator <= 0)) {
+      result.is_converged = true;
+      break;
+    }
+
+    // builds the insulator equilibrium residuals and jacobian
+    // insulator j is between span j and span j + 1
+    double residual_max = 0;
+    for (int j = 0; j < kSizeSwings; j++) {
+      const double tension_difference = tensions[j + 1] - tensions[j];
+
+      // gets the load that restores the insulator to plumb
+      const double span_weight = (spacings[j].x() + spacings[j + 1].x()) / 2;
+      const double load_vertical = state.weight_unit.z() * span_weight
+                                   + weight_insulator / 2;
+      const double load_transverse = state.weight_unit.y() * span_weight;
+      const double load_squared = load_vertical * load_vertical
+                                  + load_transverse * load_transverse;
+
+      const double denominator = std::sqrt(
+          tension_difference * tension_difference + load_squared);
+      const double swing = length_insulator * tension_difference
+                           / denominator;
+      const double slope = length_insulator * load_squared
+                           / (denominator * denominator * denominator);
+
+      g[j] = swings[j + 1] - swing;
+      a[j] = -slope * stiffnesses[j];
+      b[j] = 1 + slope * (stiffnesses[j] + stiffnesses[j + 1]);
+      c[j] = -slope * stiffnesses[j + 1];
+
+      residual_max = std::max(residual_max, std::abs(g[j]));
+    }
+
+    if (residual_max <= tolerance) {
+      result.is_converged = true;
+      break;
+    }
+
+    // solves the tridiagonal system with the thomas algorithm
+    for (int j = 1; j < kSizeSwings; j++) {
+      const double factor = a[j] / b[j - 1];
+      b[j] = b[j] - factor * c[j - 1];
+      g[j] = g[j] - factor * g[j - 1];
+    }
+
+    g[kSizeSwings - 1] = g[kSizeSwings - 1] / b[kSizeSwings - 1];
+    for (int j = kSizeSwings - 2; 0 <= j; j--) {
+      g[j] = (g[j] - c[j] * g[j + 1]) / b[j];
+    }
+
+    // updates the insulator displacements
+    // the displacement can't exceed the insulator length
+    const double swing_limit = length_insulator * 0.99;
+    for (int j = 0; j < kSizeSwings; j++) {
+      double swing = swings[j + 1] - g[j];
+      swing = std::min(swing, swing_limit);
+      swing = std::max(swing, -swing_limit);
+      swings[j + 1] = swing;
+    }
+  }
+
+  // copies the solution
+  result.swings.assign(swings.cbegin() + 1, swings.cend() - 1);
+  result.tensions_horizontal = tensions;
+
+  return true;
+}
+
+const Hardware* LineSectionSolver::insulator() const {
+  return insulator_;
+}
+
+const LineCable* LineSectionSolver::line_cable() const {
+  return line_cable_;
+}
+
+int LineSectionSolver::max_threads() const {
+  return max_threads_;
+}
+
+void LineSectionSolver::set_cache_models(CableModelCache* cache_models) {
+  cache_models_ = cache_models;
+}
+
+void LineSectionSolver::set_insulator(const Hardware* insulator) {
+  insulator_ = insulator;
+}
+
+void LineSectionSolver::set_line_cable(const LineCable* line_cable) {
+  line_cable_ = line_cable;
+  lengths_reference_.clear();
+}
+
+void LineSectionSolver::set_max_threads(const int& max_threads) {
+  max_threads_ = WorkerPool::NumThreads(max_threads);
+}
+
+void LineSectionSolver::set_spans(const std::vector<const Span*>& spans) {
+  spans_ = spans;
+  lengths_reference_.clear();
+}
+
+const std::vector<const Span*>& LineSectionSolver::spans() const {
+  return spans_;
+}
+
+std::shared_ptr<const CompiledCableModel> LineSectionSolver::Model(
+    const CableState& state, const CableStretchState& state_stretch) const {
+  const Cable* cable = line_cable_->cable();
+  if (cache_models_ != nullptr) {
+    return cache_models_->Model(cable, state, state_stretch, false);
+  }
+
+  // compiles a model that isn't cached
+  std::shared_ptr<CompiledCableModel> model(new CompiledCableModel());
+  if (model->Compile(cable, state, state_stretch, false) == false) {
+    return nullptr;
+  }
+
+  return model;
+}
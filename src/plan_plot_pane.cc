@@ -4,6 +4,7 @@
 #include "spananalyzer/plan_plot_pane.h"
 
 #include <algorithm>
+#include <vector>
 
 #include "appcommon/graphics/line_renderer_2d.h"
 #include "appcommon/graphics/text_renderer_2d.h"
@@ -11,6 +12,8 @@
 #include "models/base/helper.h"
 #include "wx/dcbuffer.h"
 
+#include "spananalyzer/catenary_batch.h"
+#include "spananalyzer/display_unit_converter.h"
 #include "spananalyzer/plan_plot_options_dialog.h"
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_doc.h"
@@ -180,11 +183,15 @@ void PlanPlotPane::OnMouse(wxMouseEvent& event) {
   point_graphics.y = event.GetY();
   const Point2d<float> point_data = plot_.PointGraphicsToData(point_graphics);
 
-  // logs to status bar
+  // logs to status bar in the display unit system
+  const double x = DisplayUnitConverter::ToDisplay(
+      DisplayUnitConverter::QuantityType::kLength, point_data.x);
+  const double y = DisplayUnitConverter::ToDisplay(
+      DisplayUnitConverter::QuantityType::kLength, point_data.y);
   std::string str = "X="
-                    + helper::DoubleToString(point_data.x, 2, true)
+                    + helper::DoubleToString(x, 2, true)
                     + "   Y="
-                    + helper::DoubleToString(point_data.y, 2, true);
+                    + helper::DoubleToString(y, 2, true);
 
   status_bar_log::SetText(str, 1);
 }
@@ -237,14 +244,17 @@ void PlanPlotPane::RenderAfter(wxDC& dc) {
 
 void PlanPlotPane::UpdateDatasetCatenary(const Catenary3d& catenary) {
   // calculates points
-  std::list<Point3d<double>> points;
+  // the points are solved in a single batch
+  std::vector<double> positions;
   const int i_max = 100;
   for (int i = 0; i <= i_max; i++) {
     double pos = static_cast<double>(i) / static_cast<double>(i_max);
-    Point3d<double> p = catenary.Coordinate(pos);
-    points.push_back(p);
+    positions.push_back(pos);
   }
 
+  std::vector<Point3d<double>> points;
+  CatenaryBatch::Coordinates(catenary, positions, points);
+
   // converts points to lines and adds to dataset
   for (auto iter = points.cbegin(); iter != std::prev(points.cend(), 1);
        iter++) {
@@ -294,7 +304,11 @@ void PlanPlotPane::UpdateDatasetDimensions(const Catenary3d& catenary) {
 
   text = new Text2d();
   text->angle = 0;
-  text->message = helper::DoubleToString(spacing.x(), 2, true);
+  text->message = helper::DoubleToString(
+      DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kLength,
+          spacing.x()),
+      2, true);
   text->offset = Point2d<int>(0, 5);
   text->point = point;
   text->position = Text2d::BoundaryPosition::kCenterLower;
@@ -318,7 +332,11 @@ void PlanPlotPane::UpdateDatasetDimensions(const Catenary3d& catenary) {
 
     text = new Text2d();
     text->angle = 0;
-    text->message = helper::DoubleToString(line->p0.y - line->p1.y, 2, true);
+    text->message = helper::DoubleToString(
+        DisplayUnitConverter::ToDisplay(
+            DisplayUnitConverter::QuantityType::kLength,
+            line->p0.y - line->p1.y),
+        2, true);
     text->offset = Point2d<int>(5, 0);
     text->point = point;
     text->position = Text2d::BoundaryPosition::kLeftCenter;
@@ -349,11 +367,11 @@ void PlanPlotPane::UpdatePlotDatasets() {
 
   // gets filtered result from doc
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  const SagTensionAnalysisResult* result = doc->Result(index,
-                                                       filter->condition);
-  if (result == nullptr) {
+  SagTensionAnalysisResult result_filter;
+  if (doc->Result(index, filter->condition, result_filter) == false) {
     return;
   }
+  const SagTensionAnalysisResult* result = &result_filter;
 
   // gets span from document
   const Span* span = doc->SpanActivated();
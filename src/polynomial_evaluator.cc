@@ -0,0 +1,76 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/polynomial_evaluator.h"
+
+PolynomialEvaluator::PolynomialEvaluator() {
+  Compile(std::vector<double>());
+}
+
+PolynomialEvaluator::~PolynomialEvaluator() {
+}
+
+void PolynomialEvaluator::Compile(const std::vector<double>& coefficients) {
+  // trims the trailing zero coefficients
+  coefficients_ = coefficients;
+  while ((1 < coefficients_.size()) && (coefficients_.back() == 0)) {
+    coefficients_.pop_back();
+  }
+  if (coefficients_.empty() == true) {
+    coefficients_.push_back(0);
+  }
+
+  // solves the derivative coefficients
+  coefficients_slope_.clear();
+  for (unsigned int i = 1; i < coefficients_.size(); i++) {
+    coefficients_slope_.push_back(i * coefficients_[i]);
+  }
+  if (coefficients_slope_.empty() == true) {
+    coefficients_slope_.push_back(0);
+  }
+
+  // selects the evaluation form
+  form_ = Select(degree());
+}
+
+double PolynomialEvaluator::ValueGeneric(const double& x) const {
+  return EvaluateGeneric(coefficients_.data(), degree(), x);
+}
+
+int PolynomialEvaluator::degree() const {
+  return coefficients_.size() - 1;
+}
+
+PolynomialEvaluator::FormType PolynomialEvaluator::form() const {
+  return form_;
+}
+
+double PolynomialEvaluator::EvaluateGeneric(const double* c,
+                                            const int& degree,
+                                            const double& x) {
+  double value = c[degree];
+  for (int i = degree - 1; 0 <= i; i--) {
+    value = value * x + c[i];
+  }
+  return value;
+}
+
+PolynomialEvaluator::FormType PolynomialEvaluator::Select(
+    const int& degree) {
+  if (degree == 4) {
+    return FormType::kEstrin;
+  } else if (degree <= kDegreeMax) {
+    return FormType::kHorner;
+  } else {
+    return FormType::kGeneric;
+  }
+}
+
+void CablePolynomials::Compile(const Cable& cable) {
+  core_creep.Compile(cable.component_core.coefficients_polynomial_creep);
+  core_loadstrain.Compile(
+      cable.component_core.coefficients_polynomial_loadstrain);
+  shell_creep.Compile(cable.component_shell.coefficients_polynomial_creep);
+  shell_loadstrain.Compile(
+      cable.component_shell.coefficients_polynomial_loadstrain);
+}
@@ -3,8 +3,10 @@
 
 #include "spananalyzer/preferences_dialog.h"
 
+#include "models/base/helper.h"
 #include "wx/clrpicker.h"
 #include "wx/filepicker.h"
+#include "wx/spinctrl.h"
 #include "wx/xrc/xmlres.h"
 
 BEGIN_EVENT_TABLE(PreferencesDialog, wxDialog)
@@ -50,6 +52,38 @@ PreferencesDialog::PreferencesDialog(
       XRCCTRL(*this, "colorpicker_background", wxColourPickerCtrl);
   pickerctrl->SetColour(config_->color_background);
 
+  // sets the result cache options
+  wxSpinCtrl* spinctrl = XRCCTRL(*this, "spinctrl_cache_memory", wxSpinCtrl);
+  spinctrl->SetValue(config_->options_cache_results.size_memory);
+
+  wxCheckBox* checkbox = XRCCTRL(*this, "checkbox_cache_spilling",
+                                 wxCheckBox);
+  checkbox->SetValue(config_->options_cache_results.is_spilling);
+
+  // sets the temperature sweep surrogate options
+  // the tolerance is displayed as a percentage
+  checkbox = XRCCTRL(*this, "checkbox_surrogate", wxCheckBox);
+  checkbox->SetValue(config_->options_surrogate.is_enabled);
+
+  wxTextCtrl* textctrl = XRCCTRL(*this, "textctrl_surrogate_tolerance",
+                                 wxTextCtrl);
+  textctrl->SetValue(helper::DoubleToString(
+      config_->options_surrogate.tolerance * 100, 4, false));
+
+  // sets the analysis thread options
+  spinctrl = XRCCTRL(*this, "spinctrl_threads", wxSpinCtrl);
+  spinctrl->SetValue(config_->options_threads.max_threads);
+
+  checkbox = XRCCTRL(*this, "checkbox_threads_pinned", wxCheckBox);
+  checkbox->SetValue(config_->options_threads.is_pinned);
+
+  checkbox = XRCCTRL(*this, "checkbox_threads_background", wxCheckBox);
+  checkbox->SetValue(config_->options_threads.is_background);
+
+  // sets the undo history options
+  spinctrl = XRCCTRL(*this, "spinctrl_undo_memory", wxSpinCtrl);
+  spinctrl->SetValue(config_->size_memory_undo);
+
   // fits the dialog around the sizers
   this->Fit();
 }
@@ -92,6 +126,42 @@ void PreferencesDialog::OnButtonOk(wxCommandEvent& event) {
       XRCCTRL(*this, "colorpicker_background", wxColourPickerCtrl);
   config_->color_background = pickerctrl->GetColour();
 
+  // transfers result cache options
+  wxSpinCtrl* spinctrl = XRCCTRL(*this, "spinctrl_cache_memory", wxSpinCtrl);
+  config_->options_cache_results.size_memory = spinctrl->GetValue();
+
+  wxCheckBox* checkbox = XRCCTRL(*this, "checkbox_cache_spilling",
+                                 wxCheckBox);
+  config_->options_cache_results.is_spilling = checkbox->GetValue();
+
+  // transfers temperature sweep surrogate options
+  checkbox = XRCCTRL(*this, "checkbox_surrogate", wxCheckBox);
+  config_->options_surrogate.is_enabled = checkbox->GetValue();
+
+  wxTextCtrl* textctrl = XRCCTRL(*this, "textctrl_surrogate_tolerance",
+                                 wxTextCtrl);
+  double tolerance = -9999;
+  if ((textctrl->GetValue().ToDouble(&tolerance) == true)
+      && (0 < tolerance)) {
+    config_->options_surrogate.tolerance = tolerance / 100;
+  } else {
+    wxLogWarning("Invalid surrogate tolerance. Keeping previous setting.");
+  }
+
+  // transfers analysis thread options
+  spinctrl = XRCCTRL(*this, "spinctrl_threads", wxSpinCtrl);
+  config_->options_threads.max_threads = spinctrl->GetValue();
+
+  checkbox = XRCCTRL(*this, "checkbox_threads_pinned", wxCheckBox);
+  config_->options_threads.is_pinned = checkbox->GetValue();
+
+  checkbox = XRCCTRL(*this, "checkbox_threads_background", wxCheckBox);
+  config_->options_threads.is_background = checkbox->GetValue();
+
+  // transfers undo history options
+  spinctrl = XRCCTRL(*this, "spinctrl_undo_memory", wxSpinCtrl);
+  config_->size_memory_undo = spinctrl->GetValue();
+
   EndModal(wxID_OK);
 }
 
@@ -4,6 +4,7 @@
 #include "spananalyzer/profile_plot_pane.h"
 
 #include <algorithm>
+#include <vector>
 
 #include "appcommon/graphics/line_renderer_2d.h"
 #include "appcommon/graphics/text_renderer_2d.h"
@@ -11,6 +12,8 @@
 #include "models/base/helper.h"
 #include "wx/dcbuffer.h"
 
+#include "spananalyzer/catenary_batch.h"
+#include "spananalyzer/display_unit_converter.h"
 #include "spananalyzer/profile_plot_options_dialog.h"
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_doc.h"
@@ -124,6 +127,7 @@ void ProfilePlotPane::ClearDataSets() {
   dataset_catenary_.Clear();
   dataset_dimension_lines_.Clear();
   dataset_dimension_text_.Clear();
+  dataset_profile_.Clear();
 }
 
 void ProfilePlotPane::OnContextMenuSelect(wxCommandEvent& event) {
@@ -180,11 +184,15 @@ void ProfilePlotPane::OnMouse(wxMouseEvent& event) {
   point_graphics.y = event.GetY();
   const Point2d<float> point_data = plot_.PointGraphicsToData(point_graphics);
 
-  // logs to status bar
+  // logs to status bar in the display unit system
+  const double x = DisplayUnitConverter::ToDisplay(
+      DisplayUnitConverter::QuantityType::kLength, point_data.x);
+  const double y = DisplayUnitConverter::ToDisplay(
+      DisplayUnitConverter::QuantityType::kLength, point_data.y);
   std::string str = "X="
-                    + helper::DoubleToString(point_data.x, 2, true)
+                    + helper::DoubleToString(x, 2, true)
                     + "   Z="
-                    + helper::DoubleToString(point_data.y, 2, true);
+                    + helper::DoubleToString(y, 2, true);
 
   status_bar_log::SetText(str, 1);
 }
@@ -237,14 +245,17 @@ void ProfilePlotPane::RenderAfter(wxDC& dc) {
 
 void ProfilePlotPane::UpdateDatasetCatenary(const Catenary3d& catenary) {
   // calculates points
-  std::list<Point3d<double>> points;
+  // the points are solved in a single batch
+  std::vector<double> positions;
   const int i_max = 100;
   for (int i = 0; i <= i_max; i++) {
     double pos = static_cast<double>(i) / static_cast<double>(i_max);
-    Point3d<double> p = catenary.Coordinate(pos);
-    points.push_back(p);
+    positions.push_back(pos);
   }
 
+  std::vector<Point3d<double>> points;
+  CatenaryBatch::Coordinates(catenary, positions, points);
+
   // converts points to lines and adds to dataset
   dataset_catenary_.Clear();
   for (auto iter = points.cbegin(); iter != std::prev(points.cend(), 1);
@@ -301,7 +312,11 @@ void ProfilePlotPane::UpdateDatasetDimensions(const Catenary3d& catenary) {
 
   text = new Text2d();
   text->angle = 0;
-  text->message = helper::DoubleToString(spacing.x(), 2, true);
+  text->message = helper::DoubleToString(
+      DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kLength,
+          spacing.x()),
+      2, true);
   text->offset = Point2d<int>(0, 5);
   text->point = point;
   text->position = Text2d::BoundaryPosition::kCenterLower;
@@ -322,7 +337,11 @@ void ProfilePlotPane::UpdateDatasetDimensions(const Catenary3d& catenary) {
 
     text = new Text2d();
     text->angle = 0;
-    text->message = helper::DoubleToString(spacing.y(), 2, true);
+    text->message = helper::DoubleToString(
+        DisplayUnitConverter::ToDisplay(
+            DisplayUnitConverter::QuantityType::kLength,
+            spacing.y()),
+        2, true);
     text->offset = Point2d<int>(5, 0);
     text->point = point;
     text->position = Text2d::BoundaryPosition::kLeftCenter;
@@ -341,7 +360,11 @@ void ProfilePlotPane::UpdateDatasetDimensions(const Catenary3d& catenary) {
 
     text = new Text2d();
     text->angle = 0;
-    text->message = helper::DoubleToString(spacing.y(), 2, true);
+    text->message = helper::DoubleToString(
+        DisplayUnitConverter::ToDisplay(
+            DisplayUnitConverter::QuantityType::kLength,
+            spacing.y()),
+        2, true);
     text->offset = Point2d<int>(-5, 0);
     text->point = point;
     text->position = Text2d::BoundaryPosition::kRightCenter;
@@ -367,13 +390,52 @@ void ProfilePlotPane::UpdateDatasetDimensions(const Catenary3d& catenary) {
 
   text = new Text2d();
   text->angle = 0;
-  text->message = helper::DoubleToString(line->p0.y - line->p1.y, 2, true);
+  text->message = helper::DoubleToString(
+      DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kLength,
+          line->p0.y - line->p1.y),
+      2, true);
   text->offset = Point2d<int>(5, 0);
   text->point = point;
   text->position = Text2d::BoundaryPosition::kLeftCenter;
   dataset_dimension_text_.Add(text);
 }
 
+void ProfilePlotPane::UpdateDatasetProfile(const Span& span) {
+  // gets the points within the span, sorted by station
+  std::vector<ProfilePoint> points;
+  for (auto iter = span.profile.cbegin(); iter != span.profile.cend();
+       iter++) {
+    const ProfilePoint& point = *iter;
+    if ((point.station < 0)
+        || (span.spacing_attachments.x() < point.station)) {
+      continue;
+    }
+
+    points.push_back(point);
+  }
+
+  std::sort(points.begin(), points.end(),
+            [](const ProfilePoint& a, const ProfilePoint& b) {
+              return a.station < b.station;
+            });
+
+  // converts points to lines and adds to dataset
+  dataset_profile_.Clear();
+  for (unsigned int i = 1; i < points.size(); i++) {
+    const ProfilePoint& p0 = points.at(i - 1);
+    const ProfilePoint& p1 = points.at(i);
+
+    Line2d* line = new Line2d();
+    line->p0.x = p0.station;
+    line->p0.y = p0.elevation;
+    line->p1.x = p1.station;
+    line->p1.y = p1.elevation;
+
+    dataset_profile_.Add(line);
+  }
+}
+
 void ProfilePlotPane::UpdatePlotDatasets() {
   ClearDataSets();
 
@@ -397,11 +459,11 @@ void ProfilePlotPane::UpdatePlotDatasets() {
 
   // gets filtered result from doc
   SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  const SagTensionAnalysisResult* result = doc->Result(index,
-                                                       filter->condition);
-  if (result == nullptr) {
+  SagTensionAnalysisResult result_filter;
+  if (doc->Result(index, filter->condition, result_filter) == false) {
     return;
   }
+  const SagTensionAnalysisResult* result = &result_filter;
 
   // gets span from document
   const Span* span = doc->SpanActivated();
@@ -415,6 +477,7 @@ void ProfilePlotPane::UpdatePlotDatasets() {
   // updates datasets
   UpdateDatasetCatenary(catenary);
   UpdateDatasetDimensions(catenary);
+  UpdateDatasetProfile(*span);
 }
 
 void ProfilePlotPane::UpdatePlotRenderers() {
@@ -439,6 +502,15 @@ void ProfilePlotPane::UpdatePlotRenderers() {
   renderer_line->set_pen(pen);
   plot_.AddRenderer(renderer_line);
 
+  // adds profile renderer
+  if (dataset_profile_.data()->empty() == false) {
+    pen = wxThePenList->FindOrCreatePen(wxColour(0, 160, 0), 1);
+    renderer_line = new LineRenderer2d();
+    renderer_line->set_dataset(&dataset_profile_);
+    renderer_line->set_pen(pen);
+    plot_.AddRenderer(renderer_line);
+  }
+
   // adds dimension line renderer
   pen = wxThePenList->FindOrCreatePen(*wxWHITE,
                                       1,
@@ -0,0 +1,560 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/reliability_analyzer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "appcommon/widgets/status_bar_log.h"
+#include "appcommon/widgets/timer.h"
+#include "models/base/helper.h"
+#include "models/transmissionline/catenary.h"
+
+namespace {
+
+/// \var kNumBins
+///   The number of accumulator bins.
+const int kNumBins = 4096;
+
+/// \var kNumRandomSample
+///   The number of random numbers that are reserved for each sample.
+const uint64_t kNumRandomSample = 6;
+
+/// \var kSizeBatch
+///   The number of samples in a batch.
+const long kSizeBatch = 256;
+
+/// \var kSizePilot
+///   The number of pilot samples that size the accumulator bins.
+const long kSizePilot = 256;
+
+/// \brief Mixes a 64-bit value with the SplitMix64 finalizer.
+/// \param[in] value
+///   The value.
+/// \return The mixed value.
+uint64_t Mix(uint64_t value) {
+  value += 0x9E3779B97F4A7C15ull;
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+  return value ^ (value >> 31);
+}
+
+/// \brief Gets a uniform random number for a counter.
+/// \param[in] key
+///   The mixed seed.
+/// \param[in] counter
+///   The counter.
+/// \return A uniform random number in (0, 1).
+double Uniform(const uint64_t& key, const uint64_t& counter) {
+  // uses the upper 53 bits and offsets by half a step, so zero and one are
+  // never returned
+  const uint64_t bits = Mix(key ^ Mix(counter)) >> 11;
+  return (static_cast<double>(bits) + 0.5) * (1.0 / 9007199254740992.0);
+}
+
+}  // namespace
+
+double WeatherDistribution::Sample(const double& u1, const double& u2) const {
+  if (type == Type::kConstant) {
+    return parameter_a;
+  } else if (type == Type::kGumbel) {
+    return parameter_a - parameter_b * std::log(-std::log(u1));
+  } else if (type == Type::kNormal) {
+    // uses the Box-Muller transform
+    const double kPi = 3.14159265358979323846;
+    return parameter_a + parameter_b * std::sqrt(-2 * std::log(u1))
+                         * std::cos(2 * kPi * u2);
+  } else if (type == Type::kUniform) {
+    return parameter_a + (parameter_b - parameter_a) * u1;
+  } else {
+    return 0;
+  }
+}
+
+ExceedanceAccumulator::ExceedanceAccumulator() {
+  Reset(0, 0);
+}
+
+void ExceedanceAccumulator::Add(const double& value) {
+  // updates the running mean and squares
+  count_++;
+  const double delta = value - mean_;
+  mean_ += delta / count_;
+  squares_ += delta * (value - mean_);
+
+  if ((count_ == 1) || (max_ < value)) {
+    max_ = value;
+  }
+
+  // counts the value in a bin
+  if ((counts_.empty() == true) || (std::isfinite(value) == false)) {
+    return;
+  }
+
+  // grows the bins until the value fits
+  const int num_bins = counts_.size();
+  while (width_bin_ * num_bins <= value) {
+    Grow();
+  }
+
+  int index = std::max(static_cast<int>(value / width_bin_), 0);
+  index = std::min(index, num_bins - 1);
+  counts_[index]++;
+}
+
+void ExceedanceAccumulator::Merge(const ExceedanceAccumulator& other) {
+  if (other.count_ == 0) {
+    return;
+  }
+
+  MergeBins(other);
+
+  // merges the mean and squares with the parallel variance formula
+  const long count = count_ + other.count_;
+  const double delta = other.mean_ - mean_;
+  squares_ += other.squares_
+              + delta * delta * count_ * other.count_ / count;
+  mean_ += delta * other.count_ / count;
+
+  if ((count_ == 0) || (max_ < other.max_)) {
+    max_ = other.max_;
+  }
+
+  count_ = count;
+}
+
+void ExceedanceAccumulator::MergeBins(const ExceedanceAccumulator& other) {
+  if ((counts_.empty() == true) || (counts_.size() != other.counts_.size())) {
+    return;
+  }
+
+  // grows the narrower bins so the bin widths match
+  // the widths are the initial width doubled, so they match exactly
+  while (width_bin_ < other.width_bin_) {
+    Grow();
+  }
+
+  const ExceedanceAccumulator* source = &other;
+  ExceedanceAccumulator other_grown;
+  if (other.width_bin_ < width_bin_) {
+    other_grown = other;
+    while (other_grown.width_bin_ < width_bin_) {
+      other_grown.Grow();
+    }
+    source = &other_grown;
+  }
+
+  for (unsigned int i = 0; i < counts_.size(); i++) {
+    counts_[i] += source->counts_[i];
+  }
+}
+
+void ExceedanceAccumulator::Reset(const double& value_max,
+                                  const int& num_bins) {
+  count_ = 0;
+  max_ = 0;
+  mean_ = 0;
+  squares_ = 0;
+
+  counts_.clear();
+  width_bin_ = 0;
+  if ((0 < value_max) && (0 < num_bins)) {
+    counts_.resize(num_bins, 0);
+    width_bin_ = value_max / num_bins;
+  }
+}
+
+double ExceedanceAccumulator::StandardDeviation() const {
+  if (count_ < 2) {
+    return 0;
+  }
+
+  return std::sqrt(squares_ / (count_ - 1));
+}
+
+double ExceedanceAccumulator::ValueExceeded(const double& probability) const {
+  if ((count_ == 0) || (counts_.empty() == true)) {
+    return max_;
+  }
+
+  // walks down from the last bin until the exceeding count is reached
+  const double count_target = probability * count_;
+  if (count_target <= 0) {
+    return max_;
+  }
+
+  double count_exceeding = 0;
+  for (int i = counts_.size() - 1; 0 <= i; i--) {
+    const double count_bin = counts_[i];
+    if (count_target <= count_exceeding + count_bin) {
+      // interpolates within the bin
+      const double fraction = (count_target - count_exceeding) / count_bin;
+      return std::min(width_bin_ * (i + 1 - fraction), max_);
+    }
+
+    count_exceeding += count_bin;
+  }
+
+  return 0;
+}
+
+long ExceedanceAccumulator::count() const {
+  return count_;
+}
+
+double ExceedanceAccumulator::max() const {
+  return max_;
+}
+
+double ExceedanceAccumulator::mean() const {
+  return mean_;
+}
+
+void ExceedanceAccumulator::Grow() {
+  // merges each pair of bins into the lower half of the bins
+  const int num_bins = counts_.size();
+  for (int i = 0; i < num_bins; i++) {
+    const int index_low = 2 * i;
+    const int index_high = 2 * i + 1;
+
+    long count = 0;
+    if (index_low < num_bins) {
+      count += counts_[index_low];
+    }
+    if (index_high < num_bins) {
+      count += counts_[index_high];
+    }
+    counts_[i] = count;
+  }
+
+  width_bin_ = width_bin_ * 2;
+}
+
+ReliabilityThread::ReliabilityThread() {
+  batches_ = nullptr;
+  index_batch_ = nullptr;
+  index_begin_ = 0;
+  index_end_ = 0;
+  line_cable_ = nullptr;
+  num_failures_ = 0;
+  settings_ = nullptr;
+  spacing_ = nullptr;
+}
+
+void ReliabilityThread::Initialize() {
+  weathercase_.description = "Reliability";
+  weathercase_.density_ice = settings_->density_ice;
+
+  reloader_.set_line_cable(line_cable_);
+  reloader_.set_condition_reloaded(settings_->condition);
+  reloader_.set_weathercase_reloaded(&weathercase_);
+}
+
+void ReliabilityThread::Process() {
+  Initialize();
+
+  // claims batches until all samples are solved
+  while (true) {
+    const long index_batch = index_batch_->fetch_add(1);
+    const long index_first = index_begin_ + index_batch * kSizeBatch;
+    if (index_end_ <= index_first) {
+      break;
+    }
+
+    // the batch results are only written by the thread that claims it
+    ReliabilityBatch& batch = batches_->at(index_batch);
+
+    const long index_last = std::min(index_first + kSizeBatch, index_end_);
+    for (long i = index_first; i < index_last; i++) {
+      double sag = 0;
+      double tension = 0;
+      if (SolveSample(i, sag, tension) == true) {
+        batch.sag.Add(sag);
+        batch.tension.Add(tension);
+        sag_.Add(sag);
+        tension_.Add(tension);
+      } else {
+        num_failures_++;
+      }
+    }
+  }
+}
+
+bool ReliabilityThread::SolveSample(const long& index, double& sag,
+                                    double& tension) {
+  // generates the random numbers for the sample
+  const uint64_t key = Mix(settings_->seed);
+  const uint64_t counter = static_cast<uint64_t>(index) * kNumRandomSample;
+  const double u[kNumRandomSample] = {
+      Uniform(key, counter), Uniform(key, counter + 1),
+      Uniform(key, counter + 2), Uniform(key, counter + 3),
+      Uniform(key, counter + 4), Uniform(key, counter + 5)};
+
+  // samples the weathercase
+  // ice and wind can't be negative, so samples are clipped at zero
+  weathercase_.thickness_ice = std::max(
+      settings_->distribution_ice.Sample(u[0], u[1]), 0.0);
+  weathercase_.pressure_wind = std::max(
+      settings_->distribution_wind.Sample(u[2], u[3]), 0.0);
+  weathercase_.temperature_cable =
+      settings_->distribution_temperature.Sample(u[4], u[5]);
+
+  // the weathercase is modified in place, so the reloader is reset
+  reloader_.set_weathercase_reloaded(&weathercase_);
+  if (reloader_.Validate(false, nullptr) == false) {
+    return false;
+  }
+
+  // creates a catenary for the span with the reloaded parameters
+  const Catenary3d catenary_reloaded = reloader_.CatenaryReloaded();
+
+  Catenary3d catenary;
+  catenary.set_spacing_endpoints(*spacing_);
+  catenary.set_tension_horizontal(catenary_reloaded.tension_horizontal());
+  catenary.set_weight_unit(catenary_reloaded.weight_unit());
+  if (catenary.Validate(false, nullptr) == false) {
+    return false;
+  }
+
+  sag = catenary.Sag();
+  tension = catenary.TensionMax();
+  return true;
+}
+
+long ReliabilityThread::num_failures() const {
+  return num_failures_;
+}
+
+const ExceedanceAccumulator& ReliabilityThread::sag() const {
+  return sag_;
+}
+
+void ReliabilityThread::set_accumulators(
+    const ExceedanceAccumulator& sag,
+    const ExceedanceAccumulator& tension) {
+  sag_ = sag;
+  tension_ = tension;
+}
+
+void ReliabilityThread::set_batches(
+    std::vector<ReliabilityBatch>* batches) {
+  batches_ = batches;
+}
+
+void ReliabilityThread::set_index_batch(std::atomic<long>* index_batch) {
+  index_batch_ = index_batch;
+}
+
+void ReliabilityThread::set_indexes(const long& index_begin,
+                                    const long& index_end) {
+  index_begin_ = index_begin;
+  index_end_ = index_end;
+}
+
+void ReliabilityThread::set_line_cable(const LineCable* line_cable) {
+  line_cable_ = line_cable;
+}
+
+void ReliabilityThread::set_settings(const ReliabilitySettings* settings) {
+  settings_ = settings;
+}
+
+void ReliabilityThread::set_spacing(const Vector3d* spacing) {
+  spacing_ = spacing;
+}
+
+const ExceedanceAccumulator& ReliabilityThread::tension() const {
+  return tension_;
+}
+
+ReliabilityAnalyzer::ReliabilityAnalyzer() {
+  span_ = nullptr;
+
+  settings_.condition = CableConditionType::kInitial;
+  settings_.density_ice = 0;
+  settings_.distribution_ice.type = WeatherDistribution::Type::kConstant;
+  settings_.distribution_ice.parameter_a = 0;
+  settings_.distribution_ice.parameter_b = 0;
+  settings_.distribution_temperature = settings_.distribution_ice;
+  settings_.distribution_wind = settings_.distribution_ice;
+  settings_.num_samples = 0;
+  settings_.seed = 0;
+
+  max_threads_ = WorkerPool::NumThreads(0);
+}
+
+ReliabilityAnalyzer::~ReliabilityAnalyzer() {
+}
+
+bool ReliabilityAnalyzer::Run(ReliabilityResult& result) const {
+  result.num_failures = 0;
+  result.sag.Reset(0, 0);
+  result.tension.Reset(0, 0);
+  result.time = 0;
+
+  // checks span
+  if (span_ == nullptr) {
+    return false;
+  }
+
+  if (settings_.num_samples <= 0) {
+    return false;
+  }
+
+  Timer timer;
+  timer.Start();
+
+  // solves the pilot samples on this thread
+  const long num_pilot = std::min(kSizePilot, settings_.num_samples);
+
+  ReliabilityThread pilot;
+  pilot.set_line_cable(&span_->linecable);
+  pilot.set_settings(&settings_);
+  pilot.set_spacing(&span_->spacing_attachments);
+  pilot.Initialize();
+
+  std::vector<double> sags;
+  std::vector<double> tensions;
+  sags.reserve(num_pilot);
+  tensions.reserve(num_pilot);
+  for (long i = 0; i < num_pilot; i++) {
+    double sag = 0;
+    double tension = 0;
+    if (pilot.SolveSample(i, sag, tension) == true) {
+      sags.push_back(sag);
+      tensions.push_back(tension);
+    } else {
+      result.num_failures++;
+    }
+  }
+
+  if (sags.empty() == true) {
+    wxLogError("Couldn't solve any reliability samples");
+    return false;
+  }
+
+  // sizes the initial bins from the pilot maximums, with headroom for the
+  // tails
+  // the bins grow if later samples exceed them
+  result.sag.Reset(2 * *std::max_element(sags.cbegin(), sags.cend()),
+                   kNumBins);
+  result.tension.Reset(
+      2 * *std::max_element(tensions.cbegin(), tensions.cend()), kNumBins);
+
+  // the empty accumulators are copied to the threads before the pilot
+  // samples are added, so the bins match when merging
+  const ExceedanceAccumulator sag_empty = result.sag;
+  const ExceedanceAccumulator tension_empty = result.tension;
+  for (unsigned int i = 0; i < sags.size(); i++) {
+    result.sag.Add(sags[i]);
+    result.tension.Add(tensions[i]);
+  }
+
+  // determines the number of threads for the remaining samples
+  const long num_remaining = settings_.num_samples - num_pilot;
+  const long num_batches = (num_remaining + kSizeBatch - 1) / kSizeBatch;
+  const int num_threads = static_cast<int>(
+      std::min(static_cast<long>(max_threads_), num_batches));
+
+  // creates threads that share the batch counter and results
+  std::atomic<long> index_batch(0);
+  std::vector<ReliabilityBatch> batches(num_batches);
+
+  WorkerPool pool;
+  for (int i = 0; i < num_threads; i++) {
+    ReliabilityThread* thread = new ReliabilityThread();
+    thread->set_accumulators(sag_empty, tension_empty);
+    thread->set_batches(&batches);
+    thread->set_index_batch(&index_batch);
+    thread->set_indexes(num_pilot, settings_.num_samples);
+    thread->set_line_cable(&span_->linecable);
+    thread->set_settings(&settings_);
+    thread->set_spacing(&span_->spacing_attachments);
+    pool.Add(thread);
+  }
+
+  // logs analysis start
+  std::string message = "Calculating "
+                        + std::to_string(settings_.num_samples)
+                        + " reliability samples using "
+                        + std::to_string(std::max(num_threads, 1))
+                        + " threads.";
+  wxLogVerbose(message.c_str());
+  status_bar_log::PushText("Running reliability analysis...", 0);
+
+  // solves the batches
+  // the main thread blocks instead of polling the threads for progress, and
+  // claims the batches of any thread that can't be started
+  pool.Start();
+  pool.RunPass();
+
+  // merges the batch means and variances in batch order, so they don't
+  // depend on which thread solved each batch
+  for (auto iter = batches.cbegin(); iter != batches.cend(); iter++) {
+    const ReliabilityBatch& batch = *iter;
+    result.sag.Merge(batch.sag);
+    result.tension.Merge(batch.tension);
+  }
+
+  // merges the thread bin counts
+  const std::vector<WorkerThread*>& threads = pool.threads();
+  for (auto iter = threads.cbegin(); iter != threads.cend(); iter++) {
+    const ReliabilityThread* thread =
+        static_cast<const ReliabilityThread*>(*iter);
+    result.num_failures += thread->num_failures();
+    result.sag.MergeBins(thread->sag());
+    result.tension.MergeBins(thread->tension());
+  }
+
+  // stops timer and logs
+  timer.Stop();
+  result.time = timer.Duration();
+
+  message = "Reliability analysis time = "
+            + helper::DoubleToString(result.time, 3, true) + "s.";
+  wxLogVerbose(message.c_str());
+
+  if (0 < result.time) {
+    message = "Reliability analysis rate = "
+              + helper::DoubleToString(settings_.num_samples / result.time,
+                                       0, true)
+              + " samples/s.";
+    wxLogVerbose(message.c_str());
+  }
+
+  if (0 < result.num_failures) {
+    message = std::to_string(result.num_failures)
+              + " reliability sample(s) couldn't be solved.";
+    wxLogError(message.c_str());
+  }
+
+  status_bar_log::PopText(0);
+
+  return true;
+}
+
+int ReliabilityAnalyzer::max_threads() const {
+  return max_threads_;
+}
+
+void ReliabilityAnalyzer::set_max_threads(const int& max_threads) {
+  max_threads_ = WorkerPool::NumThreads(max_threads);
+}
+
+void ReliabilityAnalyzer::set_settings(const ReliabilitySettings& settings) {
+  settings_ = settings;
+}
+
+void ReliabilityAnalyzer::set_span(const Span* span) {
+  span_ = span;
+}
+
+const ReliabilitySettings& ReliabilityAnalyzer::settings() const {
+  return settings_;
+}
+
+const Span* ReliabilityAnalyzer::span() const {
+  return span_;
+}
@@ -0,0 +1,394 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/reliability_dialog.h"
+
+#include <string>
+
+#include "appcommon/units/weather_load_case_unit_converter.h"
+#include "models/base/helper.h"
+#include "wx/valnum.h"
+#include "wx/xrc/xmlres.h"
+
+#include "spananalyzer/display_unit_converter.h"
+#include "spananalyzer/span_analyzer_app.h"
+
+BEGIN_EVENT_TABLE(ReliabilityDialog, wxDialog)
+  EVT_BUTTON(XRCID("button_run"), ReliabilityDialog::OnButtonRun)
+  EVT_BUTTON(wxID_CANCEL, ReliabilityDialog::OnCancel)
+  EVT_CLOSE(ReliabilityDialog::OnClose)
+END_EVENT_TABLE()
+
+ReliabilityDialog::ReliabilityDialog(wxWindow* parent, const Span* span,
+                                     const units::UnitSystem& units,
+                                     const int& max_threads) {
+  // loads dialog from virtual xrc file system
+  wxXmlResource::Get()->LoadDialog(this, parent, "reliability_dialog");
+
+  // gets listctrl reference
+  listctrl_ = XRCCTRL(*this, "listctrl", wxListCtrl);
+
+  // saves constructor parameters
+  span_ = span;
+  units_ = &units;
+  units_model_ = wxGetApp().units_model();
+
+  analyzer_.set_max_threads(max_threads);
+  analyzer_.set_span(span_);
+
+  // initializes the settings in the display unit system
+  settings_.condition = CableConditionType::kInitial;
+  settings_.distribution_ice.type = WeatherDistribution::Type::kConstant;
+  settings_.distribution_ice.parameter_a = 0;
+  settings_.distribution_ice.parameter_b = 0;
+  settings_.distribution_wind = settings_.distribution_ice;
+  settings_.distribution_temperature.type =
+      WeatherDistribution::Type::kUniform;
+  settings_.num_samples = 100000;
+  settings_.seed = 1;
+
+  if (*units_ == units::UnitSystem::kMetric) {
+    settings_.density_ice = 8954;
+    settings_.distribution_temperature.parameter_a = -20;
+    settings_.distribution_temperature.parameter_b = 40;
+  } else {
+    settings_.density_ice = 57;
+    settings_.distribution_temperature.parameter_a = 0;
+    settings_.distribution_temperature.parameter_b = 100;
+  }
+
+  seed_ = settings_.seed;
+
+  // inits form controls
+  InitChoiceControls();
+
+  // sets form validators to transfer between controls data and controls
+  SetValidators();
+
+  // transfers non-validator data to the window
+  TransferCustomDataToWindow();
+
+  // updates unit system labels
+  SetUnitsStaticText(*units_);
+
+  // fits the dialog around the sizers
+  this->Fit();
+}
+
+ReliabilityDialog::~ReliabilityDialog() {
+}
+
+void ReliabilityDialog::ConvertSettingsToModel(
+    ReliabilitySettings& settings) const {
+  WeatherDistribution& ice = settings.distribution_ice;
+  WeatherDistribution& temperature = settings.distribution_temperature;
+  WeatherDistribution& wind = settings.distribution_wind;
+
+  // creates weathercases from the first and second parameters
+  // the second parameter is a scale for Gumbel and normal distributions, so
+  // it is offset from the first parameter and converted as a difference
+  WeatherLoadCase weathercase_a;
+  weathercase_a.density_ice = settings.density_ice;
+  weathercase_a.pressure_wind = wind.parameter_a;
+  weathercase_a.temperature_cable = temperature.parameter_a;
+  weathercase_a.thickness_ice = ice.parameter_a;
+
+  WeatherLoadCase weathercase_b = weathercase_a;
+  weathercase_b.pressure_wind = wind.parameter_b;
+  weathercase_b.temperature_cable = temperature.parameter_b;
+  weathercase_b.thickness_ice = ice.parameter_b;
+  if (wind.type != WeatherDistribution::Type::kUniform) {
+    weathercase_b.pressure_wind += wind.parameter_a;
+  }
+  if (temperature.type != WeatherDistribution::Type::kUniform) {
+    weathercase_b.temperature_cable += temperature.parameter_a;
+  }
+  if (ice.type != WeatherDistribution::Type::kUniform) {
+    weathercase_b.thickness_ice += ice.parameter_a;
+  }
+
+  // converts weathercases to consistent unit style and the model unit system
+  WeatherLoadCaseUnitConverter::ConvertUnitStyleToConsistent(
+      0, *units_, weathercase_a);
+  WeatherLoadCaseUnitConverter::ConvertUnitSystem(*units_, units_model_,
+                                                  weathercase_a);
+  WeatherLoadCaseUnitConverter::ConvertUnitStyleToConsistent(
+      0, *units_, weathercase_b);
+  WeatherLoadCaseUnitConverter::ConvertUnitSystem(*units_, units_model_,
+                                                  weathercase_b);
+
+  // transfers converted values back to the settings
+  settings.density_ice = weathercase_a.density_ice;
+  ice.parameter_a = weathercase_a.thickness_ice;
+  ice.parameter_b = weathercase_b.thickness_ice;
+  temperature.parameter_a = weathercase_a.temperature_cable;
+  temperature.parameter_b = weathercase_b.temperature_cable;
+  wind.parameter_a = weathercase_a.pressure_wind;
+  wind.parameter_b = weathercase_b.pressure_wind;
+
+  if (ice.type != WeatherDistribution::Type::kUniform) {
+    ice.parameter_b -= ice.parameter_a;
+  }
+  if (temperature.type != WeatherDistribution::Type::kUniform) {
+    temperature.parameter_b -= temperature.parameter_a;
+  }
+  if (wind.type != WeatherDistribution::Type::kUniform) {
+    wind.parameter_b -= wind.parameter_a;
+  }
+}
+
+void ReliabilityDialog::InitChoiceControls() {
+  wxChoice* choice = nullptr;
+
+  // populates distribution choice controls
+  const char* names[] = {"choice_ice", "choice_wind",
+                         "choice_temperature"};
+  for (const char* name : names) {
+    choice = XRCCTRL(*this, name, wxChoice);
+    choice->Append("Constant");
+    choice->Append("Gumbel");
+    choice->Append("Normal");
+    choice->Append("Uniform");
+  }
+
+  // populates condition choice control
+  choice = XRCCTRL(*this, "choice_condition", wxChoice);
+  choice->Append("Initial");
+  choice->Append("Load");
+  choice->Append("Creep");
+}
+
+void ReliabilityDialog::OnButtonRun(wxCommandEvent& event) {
+  // validates data from form
+  if (this->Validate() == false) {
+    wxMessageBox("Errors on form");
+    return;
+  }
+
+  // transfers data from dialog controls
+  TransferDataFromWindow();
+  TransferCustomDataFromWindow();
+
+  if (settings_.num_samples <= 0) {
+    wxMessageBox("Number of samples must be greater than zero.");
+    return;
+  }
+
+  wxBusyCursor cursor;
+
+  // converts a copy of the settings and runs the analysis
+  ReliabilitySettings settings = settings_;
+  settings.seed = seed_;
+  ConvertSettingsToModel(settings);
+  analyzer_.set_settings(settings);
+
+  ReliabilityResult result;
+  if (analyzer_.Run(result) == false) {
+    listctrl_->DeleteAllItems();
+    wxMessageBox("Reliability analysis couldn't be solved. See logs.");
+    return;
+  }
+
+  UpdateListCtrl(result);
+}
+
+void ReliabilityDialog::OnCancel(wxCommandEvent& event) {
+  EndModal(wxID_CANCEL);
+}
+
+void ReliabilityDialog::OnClose(wxCloseEvent& event) {
+  EndModal(wxID_CLOSE);
+}
+
+void ReliabilityDialog::SetUnitsStaticText(const units::UnitSystem& units) {
+  if (units == units::UnitSystem::kImperial) {
+    XRCCTRL(*this, "statictext_ice_units", wxStaticText)->SetLabel("[in]");
+    XRCCTRL(*this, "statictext_wind_units", wxStaticText)->SetLabel("[psf]");
+    XRCCTRL(*this, "statictext_temperature_units", wxStaticText)
+        ->SetLabel("[deg F]");
+    XRCCTRL(*this, "statictext_density_ice_units", wxStaticText)
+        ->SetLabel("[pcf]");
+  } else if (units == units::UnitSystem::kMetric) {
+    XRCCTRL(*this, "statictext_ice_units", wxStaticText)->SetLabel("[mm]");
+    XRCCTRL(*this, "statictext_wind_units", wxStaticText)->SetLabel("[Pa]");
+    XRCCTRL(*this, "statictext_temperature_units", wxStaticText)
+        ->SetLabel("[deg C]");
+    XRCCTRL(*this, "statictext_density_ice_units", wxStaticText)
+        ->SetLabel("[N/m^3]");
+  }
+}
+
+void ReliabilityDialog::SetValidators() {
+  // variables used for creating validators
+  int style = wxNUM_VAL_NO_TRAILING_ZEROES;
+  double* value_num = nullptr;
+  int precision = 0;
+  wxTextCtrl* textctrl = nullptr;
+
+  // ice thickness
+  precision = 3;
+  value_num = &settings_.distribution_ice.parameter_a;
+  textctrl = XRCCTRL(*this, "textctrl_ice_a", wxTextCtrl);
+  textctrl->SetValidator(
+      wxFloatingPointValidator<double>(precision, value_num, style));
+
+  value_num = &settings_.distribution_ice.parameter_b;
+  textctrl = XRCCTRL(*this, "textctrl_ice_b", wxTextCtrl);
+  textctrl->SetValidator(
+      wxFloatingPointValidator<double>(precision, value_num, style));
+
+  // wind pressure
+  precision = 2;
+  value_num = &settings_.distribution_wind.parameter_a;
+  textctrl = XRCCTRL(*this, "textctrl_wind_a", wxTextCtrl);
+  textctrl->SetValidator(
+      wxFloatingPointValidator<double>(precision, value_num, style));
+
+  value_num = &settings_.distribution_wind.parameter_b;
+  textctrl = XRCCTRL(*this, "textctrl_wind_b", wxTextCtrl);
+  textctrl->SetValidator(
+      wxFloatingPointValidator<double>(precision, value_num, style));
+
+  // temperature
+  precision = 1;
+  value_num = &settings_.distribution_temperature.parameter_a;
+  textctrl = XRCCTRL(*this, "textctrl_temperature_a", wxTextCtrl);
+  textctrl->SetValidator(
+      wxFloatingPointValidator<double>(precision, value_num, style));
+
+  value_num = &settings_.distribution_temperature.parameter_b;
+  textctrl = XRCCTRL(*this, "textctrl_temperature_b", wxTextCtrl);
+  textctrl->SetValidator(
+      wxFloatingPointValidator<double>(precision, value_num, style));
+
+  // ice density
+  precision = 2;
+  value_num = &settings_.density_ice;
+  textctrl = XRCCTRL(*this, "textctrl_density_ice", wxTextCtrl);
+  textctrl->SetValidator(
+      wxFloatingPointValidator<double>(precision, value_num, style));
+
+  // samples
+  textctrl = XRCCTRL(*this, "textctrl_samples", wxTextCtrl);
+  textctrl->SetValidator(
+      wxIntegerValidator<long>(&settings_.num_samples));
+
+  // seed
+  textctrl = XRCCTRL(*this, "textctrl_seed", wxTextCtrl);
+  textctrl->SetValidator(wxIntegerValidator<unsigned long>(&seed_));
+}
+
+void ReliabilityDialog::TransferCustomDataFromWindow() {
+  wxChoice* choice = nullptr;
+  wxString str;
+
+  // transfers distribution types
+  WeatherDistribution* distributions[] = {
+      &settings_.distribution_ice, &settings_.distribution_wind,
+      &settings_.distribution_temperature};
+  const char* names[] = {"choice_ice", "choice_wind",
+                         "choice_temperature"};
+  for (int i = 0; i < 3; i++) {
+    choice = XRCCTRL(*this, names[i], wxChoice);
+    str = choice->GetStringSelection();
+    if (str == "Constant") {
+      distributions[i]->type = WeatherDistribution::Type::kConstant;
+    } else if (str == "Gumbel") {
+      distributions[i]->type = WeatherDistribution::Type::kGumbel;
+    } else if (str == "Normal") {
+      distributions[i]->type = WeatherDistribution::Type::kNormal;
+    } else if (str == "Uniform") {
+      distributions[i]->type = WeatherDistribution::Type::kUniform;
+    } else {
+      distributions[i]->type = WeatherDistribution::Type::kNull;
+    }
+  }
+
+  // transfers condition
+  choice = XRCCTRL(*this, "choice_condition", wxChoice);
+  str = choice->GetStringSelection();
+  if (str == "Initial") {
+    settings_.condition = CableConditionType::kInitial;
+  } else if (str == "Load") {
+    settings_.condition = CableConditionType::kLoad;
+  } else if (str == "Creep") {
+    settings_.condition = CableConditionType::kCreep;
+  } else {
+    settings_.condition = CableConditionType::kNull;
+  }
+}
+
+void ReliabilityDialog::TransferCustomDataToWindow() {
+  wxChoice* choice = nullptr;
+
+  // transfers distribution types
+  const WeatherDistribution* distributions[] = {
+      &settings_.distribution_ice, &settings_.distribution_wind,
+      &settings_.distribution_temperature};
+  const char* names[] = {"choice_ice", "choice_wind",
+                         "choice_temperature"};
+  for (int i = 0; i < 3; i++) {
+    choice = XRCCTRL(*this, names[i], wxChoice);
+    const WeatherDistribution::Type& type = distributions[i]->type;
+    if (type == WeatherDistribution::Type::kConstant) {
+      choice->SetStringSelection("Constant");
+    } else if (type == WeatherDistribution::Type::kGumbel) {
+      choice->SetStringSelection("Gumbel");
+    } else if (type == WeatherDistribution::Type::kNormal) {
+      choice->SetStringSelection("Normal");
+    } else if (type == WeatherDistribution::Type::kUniform) {
+      choice->SetStringSelection("Uniform");
+    }
+  }
+
+  // transfers condition
+  choice = XRCCTRL(*this, "choice_condition", wxChoice);
+  if (settings_.condition == CableConditionType::kInitial) {
+    choice->SetStringSelection("Initial");
+  } else if (settings_.condition == CableConditionType::kLoad) {
+    choice->SetStringSelection("Load");
+  } else if (settings_.condition == CableConditionType::kCreep) {
+    choice->SetStringSelection("Creep");
+  }
+}
+
+void ReliabilityDialog::UpdateListCtrl(const ReliabilityResult& result) {
+  listctrl_->DeleteAllItems();
+
+  // adds a row to the listctrl
+  auto add_row = [&](const std::string& str_label, const double& tension,
+                    const double& sag) {
+    const long index = listctrl_->GetItemCount();
+    wxListItem item;
+    item.SetId(index);
+    listctrl_->InsertItem(item);
+
+    listctrl_->SetItem(index, 0, str_label);
+    listctrl_->SetItem(index, 1, helper::DoubleToString(
+        DisplayUnitConverter::ToDisplay(
+            DisplayUnitConverter::QuantityType::kForce, tension),
+        1, true));
+    listctrl_->SetItem(index, 2, helper::DoubleToString(
+        DisplayUnitConverter::ToDisplay(
+            DisplayUnitConverter::QuantityType::kLength, sag),
+        2, true));
+  };
+
+  add_row("Mean", result.tension.mean(), result.sag.mean());
+
+  // adds exceedance probabilities until fewer than ten samples exceed them
+  const long count = result.tension.count();
+  const double probabilities[] = {0.5, 0.1, 0.01, 0.001, 0.0001, 0.00001};
+  for (const double& probability : probabilities) {
+    if (probability * count < 10) {
+      break;
+    }
+
+    const std::string str_label =
+        helper::DoubleToString(100 * probability, 3, true) + "%";
+    add_row(str_label, result.tension.ValueExceeded(probability),
+           result.sag.ValueExceeded(probability));
+  }
+
+  add_row("Max", result.tension.max(), result.sag.max());
+}
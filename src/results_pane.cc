@@ -3,14 +3,33 @@
 
 #include "spananalyzer/results_pane.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "appcommon/units/weather_load_case_unit_converter.h"
 #include "models/base/helper.h"
+#include "models/base/units.h"
 #include "models/transmissionline/catenary.h"
 #include "wx/xrc/xmlres.h"
 
+#include "spananalyzer/catenary_batch.h"
+#include "spananalyzer/clearance_solver.h"
+#include "spananalyzer/display_unit_converter.h"
+#include "spananalyzer/line_section_solver.h"
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_doc.h"
 #include "spananalyzer/span_analyzer_view.h"
 
+namespace {
+
+/// \var kSizeSweepMax
+///   The maximum number of temperatures in a temperature sweep report. Wider
+///   temperature ranges are swept in coarser steps.
+const int kSizeSweepMax = 41;
+
+}  // namespace
+
 BEGIN_EVENT_TABLE(ResultsPane, wxPanel)
   EVT_CHOICE(XRCID("choice_filter_group"), ResultsPane::OnChoiceFilterGroup)
   EVT_CHOICE(XRCID("choice_report"), ResultsPane::OnChoiceReport)
@@ -33,7 +52,11 @@ ResultsPane::ResultsPane(wxWindow* parent, wxView* view) {
   choice->Append("Tension Distribution");
   choice->Append("Catenary - Curve");
   choice->Append("Catenary - Endpoints");
+  choice->Append("Clearance");
   choice->Append("Length");
+  choice->Append("Line Section");
+  choice->Append("Solver Statistics");
+  choice->Append("Temperature Sweep");
   choice->SetSelection(0);
 
   // initializes filter group choice
@@ -120,8 +143,16 @@ void ResultsPane::OnChoiceReport(wxCommandEvent& event) {
     type_report_ = ReportType::kCatenary;
   } else if (str == "Catenary - Endpoints") {
     type_report_ = ReportType::kCatenaryEndpoints;
+  } else if (str == "Clearance") {
+    type_report_ = ReportType::kClearance;
   } else if (str == "Length") {
     type_report_ = ReportType::kLength;
+  } else if (str == "Line Section") {
+    type_report_ = ReportType::kLineSection;
+  } else if (str == "Solver Statistics") {
+    type_report_ = ReportType::kSolverStatistics;
+  } else if (str == "Temperature Sweep") {
+    type_report_ = ReportType::kTemperatureSweep;
   } else {
     return;
   }
@@ -205,7 +236,7 @@ void ResultsPane::OnListCtrlSelect(wxListEvent& event) {
   view_->GetDocument()->UpdateAllViews(nullptr, &hint);
 }
 
-std::list<const SagTensionAnalysisResult*> ResultsPane::Results() {
+std::list<SagTensionAnalysisResult> ResultsPane::Results() {
   // gets view display information
   SpanAnalyzerView* view = dynamic_cast<SpanAnalyzerView*>(view_);
   const AnalysisFilterGroup* group_filters = view->group_filters();
@@ -219,15 +250,18 @@ std::list<const SagTensionAnalysisResult*> ResultsPane::Results() {
   // creates a list of results depending on filter
   const SpanAnalyzerDoc* doc =
       dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
-  std::list<const SagTensionAnalysisResult*> results;
-
-  if (filters != nullptr) {
-    for (auto iter = filters->cbegin(); iter != filters->cend(); iter++) {
+  std::list<SagTensionAnalysisResult> results;
+
+  // uses the weathercase indexes that the view resolved for the filter group
+  const std::vector<int>& indexes = view->indexes_weathercases_filters();
+  if ((filters != nullptr) && (indexes.size() == filters->size())) {
+    auto it = indexes.cbegin();
+    for (auto iter = filters->cbegin(); iter != filters->cend();
+         iter++, it++) {
       const AnalysisFilter& filter = *iter;
-      const int index = view->IndexWeathercase(filter);
-      const SagTensionAnalysisResult* result = doc->Result(index,
-                                                           filter.condition);
-      if (result != nullptr) {
+      const int index = *it;
+      SagTensionAnalysisResult result;
+      if (doc->Result(index, filter.condition, result) == true) {
         results.push_back(result);
       }
     }
@@ -330,12 +364,20 @@ void ResultsPane::UpdateReportData() {
     UpdateReportDataCatenaryCurve();
   } else if (type_report_ == ReportType::kCatenaryEndpoints) {
     UpdateReportDataCatenaryEndpoints();
+  } else if (type_report_ == ReportType::kClearance) {
+    UpdateReportDataClearance();
   } else if (type_report_ == ReportType::kConstraint) {
     UpdateReportDataConstraint();
   } else if (type_report_ == ReportType::kLength) {
     UpdateReportDataLength();
+  } else if (type_report_ == ReportType::kLineSection) {
+    UpdateReportDataLineSection();
   } else if (type_report_ == ReportType::kSagTension) {
     UpdateReportDataSagTension();
+  } else if (type_report_ == ReportType::kSolverStatistics) {
+    UpdateReportDataSolverStatistics();
+  } else if (type_report_ == ReportType::kTemperatureSweep) {
+    UpdateReportDataTemperatureSweep();
   } else if (type_report_ == ReportType::kTensionDistribution) {
     UpdateReportDataTensionDistribution();
   }
@@ -393,7 +435,7 @@ void ResultsPane::UpdateReportDataConstraint() {
   const std::list<const CableConstraint*>& constraints = doc->Constraints();
 
   // gets filtered results
-  const std::list<const SagTensionAnalysisResult*>& results = Results();
+  const std::list<SagTensionAnalysisResult>& results = Results();
 
   // checks if results has any data
   if (results.empty() == true) {
@@ -407,7 +449,8 @@ void ResultsPane::UpdateReportDataConstraint() {
     const CableConstraint* constraint = *std::next(constraints.cbegin(), i);
 
     // gets result
-    const SagTensionAnalysisResult* result = *std::next(results.cbegin(), i);
+    const SagTensionAnalysisResult* result =
+        &(*std::next(results.cbegin(), i));
 
     // creates a report row, which will be filled out by each result
     ReportRow row;
@@ -457,7 +500,9 @@ void ResultsPane::UpdateReportDataConstraint() {
     }
 
     // adds limit
-    value = constraint->limit;
+    const DisplayUnitConverter::QuantityType type_limit =
+        DisplayUnitConverter::QuantityTypeLimit(constraint->type_limit);
+    value = DisplayUnitConverter::ToDisplay(type_limit, constraint->limit);
     str = helper::DoubleToString(value, 2, true);
     row.values.push_back(str);
 
@@ -476,11 +521,13 @@ void ResultsPane::UpdateReportDataConstraint() {
       value = catenary.TensionMax();
     }
 
+    const double actual = value;
+    value = DisplayUnitConverter::ToDisplay(type_limit, actual);
     str = helper::DoubleToString(value, 2, true);
     row.values.push_back(str);
 
     // adds usage
-    value = 100 * (value / constraint->limit);
+    value = 100 * (actual / constraint->limit);
     str = helper::DoubleToString(value, 2, true);
     row.values.push_back(str);
 
@@ -542,7 +589,7 @@ void ResultsPane::UpdateReportDataCatenaryCurve() {
   data_.headers.push_back(header);
 
   // gets filtered results
-  const std::list<const SagTensionAnalysisResult*>& results = Results();
+  const std::list<SagTensionAnalysisResult>& results = Results();
 
   // checks if results has any data
   if (results.empty() == true) {
@@ -556,7 +603,7 @@ void ResultsPane::UpdateReportDataCatenaryCurve() {
 
   // fills each row with data
   for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
-    const SagTensionAnalysisResult* result = *iter;
+    const SagTensionAnalysisResult* result = &(*iter);
 
     // creates a report row, which will be filled out by each result
     ReportRow row;
@@ -590,32 +637,44 @@ void ResultsPane::UpdateReportDataCatenaryCurve() {
     row.values.push_back(str_condition);
 
     // adds H
-    value = catenary.tension_horizontal();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        catenary.tension_horizontal());
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
     // adds w
-    value = catenary.weight_unit().Magnitude();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kWeightUnit,
+        catenary.weight_unit().Magnitude());
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
     // adds H/w
-    value = catenary.Constant();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        catenary.Constant());
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
     // adds sag
-    value = catenary.Sag();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        catenary.Sag());
     str = helper::DoubleToString(value, 2, true);
     row.values.push_back(str);
 
     // adds L
-    value = catenary.Length();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        catenary.Length());
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
     // adds Ls
-    value = catenary.LengthSlack();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        catenary.LengthSlack());
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
@@ -682,7 +741,7 @@ void ResultsPane::UpdateReportDataCatenaryEndpoints() {
   data_.headers.push_back(header);
 
   // gets filtered results
-  const std::list<const SagTensionAnalysisResult*>& results = Results();
+  const std::list<SagTensionAnalysisResult>& results = Results();
 
   // checks if results has any data
   if (results.empty() == true) {
@@ -697,7 +756,7 @@ void ResultsPane::UpdateReportDataCatenaryEndpoints() {
 
   // fills each row with data
   for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
-    const SagTensionAnalysisResult* result = *iter;
+    const SagTensionAnalysisResult* result = &(*iter);
 
     // creates a report row, which will be filled out by each result
     ReportRow row;
@@ -731,12 +790,16 @@ void ResultsPane::UpdateReportDataCatenaryEndpoints() {
     row.values.push_back(str_condition);
 
     // adds Ts
-    value = catenary.Tension(0);
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        catenary.Tension(0));
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
     // adds Tv
-    value = catenary.Tension(0, AxisDirectionType::kPositive).z();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        catenary.Tension(0, AxisDirectionType::kPositive).z());
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
@@ -749,12 +812,16 @@ void ResultsPane::UpdateReportDataCatenaryEndpoints() {
     row.values.push_back("");
 
     // adds Ts
-    value = catenary.Tension(1);
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        catenary.Tension(1));
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
     // adds Tv
-    value = catenary.Tension(1, AxisDirectionType::kNegative).z();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        catenary.Tension(1, AxisDirectionType::kNegative).z());
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
@@ -768,6 +835,159 @@ void ResultsPane::UpdateReportDataCatenaryEndpoints() {
   }
 }
 
+void ResultsPane::UpdateReportDataClearance() {
+  // initializes data
+  data_.headers.clear();
+  data_.rows.clear();
+
+  // fills column headers
+  ReportColumnHeader header;
+  header.title = "Weathercase";
+  header.format = wxLIST_FORMAT_LEFT;
+  header.width = 200;
+  data_.headers.push_back(header);
+
+  header.title = "Condition";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Points";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Station";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Clearance";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Required";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Margin";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Violations";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  // gets filtered results
+  const std::list<SagTensionAnalysisResult>& results = Results();
+
+  // checks if results has any data
+  if (results.empty() == true) {
+    return;
+  }
+
+  // gets the activated span from the document
+  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
+  const Span* span = doc->SpanActivated();
+  if (span == nullptr) {
+    return;
+  }
+
+  if (span->profile.empty() == true) {
+    return;
+  }
+
+  // solves the clearance for all results
+  // the profile points are indexed once and shared by the solver threads
+  const std::vector<SagTensionAnalysisResult> results_analysis(
+      results.cbegin(), results.cend());
+  std::vector<ClearanceResult> results_clearance;
+
+  ClearanceSolver solver;
+  solver.set_max_threads(doc->max_threads_analysis());
+  solver.set_span(span);
+  if (solver.Solve(results_analysis, results_clearance) == false) {
+    return;
+  }
+
+  // fills each row with data
+  for (unsigned int i = 0; i < results_analysis.size(); i++) {
+    const SagTensionAnalysisResult* result = &results_analysis.at(i);
+    const ClearanceResult& result_clearance = results_clearance.at(i);
+
+    // skips results that don't have any points within the span
+    if (result_clearance.num_points == 0) {
+      continue;
+    }
+
+    // creates a report row, which will be filled out by each result
+    ReportRow row;
+
+    // gets the weathercase string
+    const std::string& str_weathercase = result->weathercase->description;
+
+    // gets condition string
+    std::string str_condition;
+    if (result->condition == CableConditionType::kCreep) {
+      str_condition = "Creep";
+    } else if (result->condition == CableConditionType::kInitial) {
+      str_condition = "Initial";
+    } else if (result->condition == CableConditionType::kLoad) {
+      str_condition = "Load";
+    }
+
+    double value;
+    std::string str;
+
+    // adds weathercase
+    row.values.push_back(str_weathercase);
+
+    // adds condition
+    row.values.push_back(str_condition);
+
+    // adds points
+    row.values.push_back(std::to_string(result_clearance.num_points));
+
+    // adds station
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        result_clearance.station);
+    str = helper::DoubleToString(value, 2, true);
+    row.values.push_back(str);
+
+    // adds clearance
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        result_clearance.clearance);
+    str = helper::DoubleToString(value, 2, true);
+    row.values.push_back(str);
+
+    // adds required clearance
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        result_clearance.clearance_required);
+    str = helper::DoubleToString(value, 2, true);
+    row.values.push_back(str);
+
+    // adds margin
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        result_clearance.clearance - result_clearance.clearance_required);
+    str = helper::DoubleToString(value, 2, true);
+    row.values.push_back(str);
+
+    // adds violations
+    row.values.push_back(std::to_string(result_clearance.num_violations));
+
+    // appends row to list
+    data_.rows.push_back(row);
+  }
+}
+
 void ResultsPane::UpdateReportDataLength() {
   // initializes data
   data_.headers.clear();
@@ -796,7 +1016,7 @@ void ResultsPane::UpdateReportDataLength() {
   data_.headers.push_back(header);
 
   // gets filtered results
-  const std::list<const SagTensionAnalysisResult*>& results = Results();
+  const std::list<SagTensionAnalysisResult>& results = Results();
 
   // checks if results has any data
   if (results.empty() == true) {
@@ -811,7 +1031,7 @@ void ResultsPane::UpdateReportDataLength() {
 
   // fills each row with data
   for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
-    const SagTensionAnalysisResult* result = *iter;
+    const SagTensionAnalysisResult* result = &(*iter);
 
     // creates a report row, which will be filled out by each result
     ReportRow row;
@@ -845,15 +1065,204 @@ void ResultsPane::UpdateReportDataLength() {
     row.values.push_back(str_condition);
 
     // adds Lu
-    value = result->length_unloaded;
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        result->length_unloaded);
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
     // adds Ll
-    value = catenary.Length();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        catenary.Length());
+    str = helper::DoubleToString(value, 3, true);
+    row.values.push_back(str);
+
+    // appends row to list
+    data_.rows.push_back(row);
+  }
+}
+
+void ResultsPane::UpdateReportDataLineSection() {
+  // initializes data
+  data_.headers.clear();
+  data_.rows.clear();
+
+  // fills column headers
+  ReportColumnHeader header;
+  header.title = "Weathercase";
+  header.format = wxLIST_FORMAT_LEFT;
+  header.width = 200;
+  data_.headers.push_back(header);
+
+  header.title = "Condition";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Spans";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "H-min";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "H-max";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Swing";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Angle";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Iterations";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  // gets filtered results
+  const std::list<SagTensionAnalysisResult>& results = Results();
+
+  // checks if results has any data
+  if (results.empty() == true) {
+    return;
+  }
+
+  // initializes the line section solver for the activated span
+  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
+  const Span* span_activated = doc->SpanActivated();
+  if (span_activated == nullptr) {
+    return;
+  }
+
+  LineSectionSolver solver;
+  solver.set_cache_models(doc->cache_models());
+  solver.set_insulator(doc->hardware_suspension());
+  solver.set_line_cable(&span_activated->linecable);
+  solver.set_max_threads(doc->max_threads_analysis());
+  solver.set_spans(doc->SpansLineSection());
+  if (solver.Initialize() == false) {
+    return;
+  }
+
+  const int kSizeSpans = solver.spans().size();
+  const double length_insulator = doc->hardware_suspension()->length;
+
+  // fills each row with data
+  for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
+    const SagTensionAnalysisResult* result = &(*iter);
+
+    // solves the line section
+    const CableStretchState* state_stretch =
+        doc->StretchState(result->condition);
+    if (state_stretch == nullptr) {
+      continue;
+    }
+
+    LineSectionResult result_section;
+    if (solver.Solve(*result, *state_stretch, result_section) == false) {
+      continue;
+    }
+
+    if (result_section.is_converged == false) {
+      std::string message = result->weathercase->description + "  --  "
+                            "Line section insulator equilibrium didn't "
+                            "converge.";
+      wxLogWarning(message.c_str());
+    }
+
+    // creates a report row, which will be filled out by each result
+    ReportRow row;
+
+    // gets the weathercase string
+    const std::string& str_weathercase = result->weathercase->description;
+
+    // gets condition string
+    std::string str_condition;
+    if (result->condition == CableConditionType::kCreep) {
+      str_condition = "Creep";
+    } else if (result->condition == CableConditionType::kInitial) {
+      str_condition = "Initial";
+    } else if (result->condition == CableConditionType::kLoad) {
+      str_condition = "Load";
+    }
+
+    // gets the tension range and largest insulator swing
+    const std::vector<double>& tensions = result_section.tensions_horizontal;
+    const double tension_min = *std::min_element(tensions.cbegin(),
+                                                 tensions.cend());
+    const double tension_max = *std::max_element(tensions.cbegin(),
+                                                 tensions.cend());
+
+    double swing_max = 0;
+    for (auto it = result_section.swings.cbegin();
+         it != result_section.swings.cend(); it++) {
+      if (std::abs(swing_max) < std::abs(*it)) {
+        swing_max = *it;
+      }
+    }
+
+    double angle_max = 0;
+    if (0 < length_insulator) {
+      angle_max = units::ConvertAngle(
+          std::asin(swing_max / length_insulator),
+          units::AngleConversionType::kRadiansToDegrees);
+    }
+
+    double value;
+    std::string str;
+
+    // adds weathercase
+    row.values.push_back(str_weathercase);
+
+    // adds condition
+    row.values.push_back(str_condition);
+
+    // adds spans
+    row.values.push_back(std::to_string(kSizeSpans));
+
+    // adds H-min
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        tension_min);
+    str = helper::DoubleToString(value, 1, true);
+    row.values.push_back(str);
+
+    // adds H-max
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        tension_max);
+    str = helper::DoubleToString(value, 1, true);
+    row.values.push_back(str);
+
+    // adds swing
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        swing_max);
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
+    // adds angle
+    str = helper::DoubleToString(angle_max, 2, true);
+    row.values.push_back(str);
+
+    // adds iterations
+    str = std::to_string(result_section.iterations);
+    if (result_section.is_converged == false) {
+      str += "*";
+    }
+    row.values.push_back(str);
+
     // appends row to list
     data_.rows.push_back(row);
   }
@@ -902,7 +1311,7 @@ void ResultsPane::UpdateReportDataSagTension() {
   data_.headers.push_back(header);
 
   // gets filtered results
-  const std::list<const SagTensionAnalysisResult*>& results = Results();
+  const std::list<SagTensionAnalysisResult>& results = Results();
 
   // checks if results has any data
   if (results.empty() == true) {
@@ -911,7 +1320,7 @@ void ResultsPane::UpdateReportDataSagTension() {
 
   // fills each row with data
   for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
-    const SagTensionAnalysisResult* result = *iter;
+    const SagTensionAnalysisResult* result = &(*iter);
 
     // creates a report row, which will be filled out by each result
     ReportRow row;
@@ -939,27 +1348,37 @@ void ResultsPane::UpdateReportDataSagTension() {
     row.values.push_back(str_condition);
 
     // adds Wv
-    value = result->weight_unit.z();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kWeightUnit,
+        result->weight_unit.z());
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
     // adds Wt
-    value = result->weight_unit.y();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kWeightUnit,
+        result->weight_unit.y());
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
     // adds Wr
-    value = result->weight_unit.Magnitude();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kWeightUnit,
+        result->weight_unit.Magnitude());
     str = helper::DoubleToString(value, 3, true);
     row.values.push_back(str);
 
     // adds H
-    value = result->tension_horizontal;
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        result->tension_horizontal);
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
     // adds H/w
-    value = result->tension_horizontal / result->weight_unit.Magnitude();
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kLength,
+        result->tension_horizontal / result->weight_unit.Magnitude());
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
@@ -968,6 +1387,286 @@ void ResultsPane::UpdateReportDataSagTension() {
   }
 }
 
+void ResultsPane::UpdateReportDataSolverStatistics() {
+  // initializes data
+  data_.headers.clear();
+  data_.rows.clear();
+
+  // fills column headers
+  ReportColumnHeader header;
+  header.title = "Weathercase";
+  header.format = wxLIST_FORMAT_LEFT;
+  header.width = 200;
+  data_.headers.push_back(header);
+
+  header.title = "Condition";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Reloader (ms)";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Unloader (ms)";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Residual";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  // gets filtered results
+  const std::list<SagTensionAnalysisResult>& results = Results();
+
+  // checks if results has any data
+  if (results.empty() == true) {
+    return;
+  }
+
+  // fills each row with data
+  for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
+    const SagTensionAnalysisResult* result = &(*iter);
+
+    // creates a report row, which will be filled out by each result
+    ReportRow row;
+
+    // gets the weathercase string
+    const std::string& str_weathercase = result->weathercase->description;
+
+    // gets condition string
+    std::string str_condition;
+    if (result->condition == CableConditionType::kCreep) {
+      str_condition = "Creep";
+    } else if (result->condition == CableConditionType::kInitial) {
+      str_condition = "Initial";
+    } else if (result->condition == CableConditionType::kLoad) {
+      str_condition = "Load";
+    }
+
+    double value;
+    std::string str;
+
+    // adds weathercase
+    row.values.push_back(str_weathercase);
+
+    // adds condition
+    row.values.push_back(str_condition);
+
+    // adds reloader solve time
+    value = result->time_solve_reloader * 1000;
+    str = helper::DoubleToString(value, 3, true);
+    row.values.push_back(str);
+
+    // adds unloader solve time
+    value = result->time_solve_unloader * 1000;
+    str = helper::DoubleToString(value, 3, true);
+    row.values.push_back(str);
+
+    // adds length residual
+    value = result->residual_length;
+    str = helper::DoubleToString(value, 9, true);
+    row.values.push_back(str);
+
+    // appends row to list
+    data_.rows.push_back(row);
+  }
+}
+
+void ResultsPane::UpdateReportDataTemperatureSweep() {
+  // initializes data
+  data_.headers.clear();
+  data_.rows.clear();
+
+  // fills column headers
+  ReportColumnHeader header;
+  header.title = "Weathercase";
+  header.format = wxLIST_FORMAT_LEFT;
+  header.width = 200;
+  data_.headers.push_back(header);
+
+  header.title = "Condition";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Temperature";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "H";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Support";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  header.title = "Sag";
+  header.format = wxLIST_FORMAT_CENTER;
+  header.width = wxLIST_AUTOSIZE;
+  data_.headers.push_back(header);
+
+  // gets filtered results
+  const std::list<SagTensionAnalysisResult>& results = Results();
+
+  // checks if results has any data
+  if (results.empty() == true) {
+    return;
+  }
+
+  // gets the activated span from the document
+  SpanAnalyzerDoc* doc = dynamic_cast<SpanAnalyzerDoc*>(view_->GetDocument());
+  const Span* span = doc->SpanActivated();
+  if (span == nullptr) {
+    return;
+  }
+
+  // gets the sweep temperatures, which span the weathercase temperatures in
+  // whole degree steps that are coarsened to limit the number of points
+  const std::list<WeatherLoadCase*>& weathercases =
+      wxGetApp().data()->weathercases;
+  double temperature_min = 0;
+  double temperature_max = 0;
+  for (auto iter = weathercases.cbegin(); iter != weathercases.cend();
+       iter++) {
+    const WeatherLoadCase* weathercase = *iter;
+    if (iter == weathercases.cbegin()) {
+      temperature_min = weathercase->temperature_cable;
+      temperature_max = weathercase->temperature_cable;
+    } else {
+      temperature_min = std::min(temperature_min,
+                                 weathercase->temperature_cable);
+      temperature_max = std::max(temperature_max,
+                                 weathercase->temperature_cable);
+    }
+  }
+
+  std::vector<double> temperatures;
+  temperature_min = std::floor(temperature_min);
+  temperature_max = std::ceil(temperature_max);
+  // leaves room for the maximum temperature if the steps don't land on it
+  const double step = std::max(
+      std::ceil((temperature_max - temperature_min) / (kSizeSweepMax - 2)),
+      1.0);
+  for (double temperature = temperature_min; temperature <= temperature_max;
+       temperature += step) {
+    temperatures.push_back(temperature);
+  }
+  if (temperatures.back() < temperature_max) {
+    temperatures.push_back(temperature_max);
+  }
+
+  // gets the display temperatures
+  const units::UnitSystem units_model = wxGetApp().units_model();
+  const units::UnitSystem units_display = wxGetApp().config()->units;
+  std::vector<std::string> strs_temperature;
+  for (auto iter = temperatures.cbegin(); iter != temperatures.cend();
+       iter++) {
+    WeatherLoadCase weathercase;
+    weathercase.density_ice = 0;
+    weathercase.pressure_wind = 0;
+    weathercase.temperature_cable = *iter;
+    weathercase.thickness_ice = 0;
+    WeatherLoadCaseUnitConverter::ConvertUnitSystem(units_model,
+                                                    units_display,
+                                                    weathercase);
+    WeatherLoadCaseUnitConverter::ConvertUnitStyleToDifferent(units_display,
+                                                              weathercase);
+    strs_temperature.push_back(
+        helper::DoubleToString(weathercase.temperature_cable, 0, true));
+  }
+
+  // fills rows for each result
+  for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
+    const SagTensionAnalysisResult* result = &(*iter);
+
+    // solves the sweep
+    TemperatureSweepResult result_sweep;
+    if (doc->SolveTemperatureSweep(*result->weathercase, result->condition,
+                                   temperatures, result_sweep) == false) {
+      continue;
+    }
+
+    // gets the weathercase string
+    const std::string& str_weathercase = result->weathercase->description;
+
+    // gets condition string
+    std::string str_condition;
+    if (result->condition == CableConditionType::kCreep) {
+      str_condition = "Creep";
+    } else if (result->condition == CableConditionType::kInitial) {
+      str_condition = "Initial";
+    } else if (result->condition == CableConditionType::kLoad) {
+      str_condition = "Load";
+    }
+
+    // solves the sweep catenaries in a batch
+    CatenaryBatch batch;
+    batch.Reserve(temperatures.size());
+    for (unsigned int i = 0; i < temperatures.size(); i++) {
+      Catenary3d catenary;
+      catenary.set_spacing_endpoints(span->spacing_attachments);
+      catenary.set_tension_horizontal(
+          result_sweep.tensions_horizontal.at(i));
+      catenary.set_weight_unit(result_sweep.weight_unit);
+      batch.Append(catenary);
+    }
+
+    std::vector<double> sags;
+    std::vector<double> tensions_max;
+    batch.Sags(sags);
+    batch.TensionsMax(tensions_max);
+
+    for (unsigned int i = 0; i < temperatures.size(); i++) {
+      // creates a report row, which will be filled out by each result
+      ReportRow row;
+
+      double value;
+      std::string str;
+
+      // adds weathercase
+      row.values.push_back(str_weathercase);
+
+      // adds condition
+      row.values.push_back(str_condition);
+
+      // adds temperature
+      row.values.push_back(strs_temperature.at(i));
+
+      // adds horizontal tension
+      value = DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kForce,
+          result_sweep.tensions_horizontal.at(i));
+      str = helper::DoubleToString(value, 1, true);
+      row.values.push_back(str);
+
+      // adds support tension
+      value = DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kForce,
+          tensions_max.at(i));
+      str = helper::DoubleToString(value, 1, true);
+      row.values.push_back(str);
+
+      // adds sag
+      value = DisplayUnitConverter::ToDisplay(
+          DisplayUnitConverter::QuantityType::kLength,
+          sags.at(i));
+      str = helper::DoubleToString(value, 2, true);
+      row.values.push_back(str);
+
+      // appends row to list
+      data_.rows.push_back(row);
+    }
+  }
+}
+
 void ResultsPane::UpdateReportDataTensionDistribution() {
   // initializes data
   data_.headers.clear();
@@ -996,7 +1695,7 @@ void ResultsPane::UpdateReportDataTensionDistribution() {
   data_.headers.push_back(header);
 
   // gets filtered results
-  const std::list<const SagTensionAnalysisResult*>& results = Results();
+  const std::list<SagTensionAnalysisResult>& results = Results();
 
   // checks if results has any data
   if (results.empty() == true) {
@@ -1005,7 +1704,7 @@ void ResultsPane::UpdateReportDataTensionDistribution() {
 
   // fills each row with data
   for (auto iter = results.cbegin(); iter != results.cend(); iter++) {
-    const SagTensionAnalysisResult* result = *iter;
+    const SagTensionAnalysisResult* result = &(*iter);
 
     // creates a report row, which will be filled out by each result
     ReportRow row;
@@ -1033,12 +1732,16 @@ void ResultsPane::UpdateReportDataTensionDistribution() {
     row.values.push_back(str_condition);
 
     // adds Hs
-    value = result->tension_horizontal_shell;
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        result->tension_horizontal_shell);
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
     // adds Hc
-    value = result->tension_horizontal_core;
+    value = DisplayUnitConverter::ToDisplay(
+        DisplayUnitConverter::QuantityType::kForce,
+        result->tension_horizontal_core);
     str = helper::DoubleToString(value, 1, true);
     row.values.push_back(str);
 
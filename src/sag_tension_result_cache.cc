@@ -0,0 +1,204 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/sag_tension_result_cache.h"
+
+#include "wx/filename.h"
+#include "wx/wx.h"
+
+SagTensionResultCache::SagTensionResultCache() {
+  is_spilling_ = false;
+  num_spilled_ = 0;
+  size_budget_ = 0;
+  size_memory_ = 0;
+}
+
+SagTensionResultCache::~SagTensionResultCache() {
+  Clear();
+}
+
+void SagTensionResultCache::Clear() {
+  entries_.clear();
+  index_.clear();
+  num_spilled_ = 0;
+  size_memory_ = 0;
+
+  // deletes the spill file
+  if (file_spill_.IsOpened() == true) {
+    file_spill_.Close();
+  }
+
+  if (filepath_spill_.empty() == false) {
+    wxRemoveFile(filepath_spill_);
+    filepath_spill_.clear();
+  }
+}
+
+bool SagTensionResultCache::Extract(const void* key,
+                                    std::vector<char>& block) {
+  // searches for the entry
+  auto iter_index = index_.find(key);
+  if (iter_index == index_.end()) {
+    return false;
+  }
+
+  Entry& entry = *iter_index->second;
+
+  // gets the block from memory or the spill file
+  bool status = true;
+  if (entry.is_spilled == false) {
+    block.swap(entry.block);
+  } else {
+    block.resize(entry.size_spill);
+    if ((file_spill_.Seek(entry.offset_spill) == wxInvalidOffset)
+        || (file_spill_.Read(block.data(), entry.size_spill)
+            != static_cast<ssize_t>(entry.size_spill))) {
+      wxLogError("Couldn't read cached results from spill file.");
+      block.clear();
+      status = false;
+    }
+  }
+
+  Erase(iter_index->second);
+
+  return status;
+}
+
+void SagTensionResultCache::Insert(const void* key, std::vector<char>& block) {
+  // removes any existing entry
+  Remove(key);
+
+  // adds entry as the most recently used
+  entries_.push_front(Entry());
+  Entry& entry = entries_.front();
+  entry.block.swap(block);
+  entry.is_spilled = false;
+  entry.key = key;
+  entry.offset_spill = 0;
+  entry.size_spill = 0;
+
+  size_memory_ += entry.block.size();
+  index_[key] = entries_.begin();
+
+  // enforces the memory budget
+  Evict();
+}
+
+void SagTensionResultCache::Remove(const void* key) {
+  auto iter_index = index_.find(key);
+  if (iter_index == index_.end()) {
+    return;
+  }
+
+  Erase(iter_index->second);
+}
+
+bool SagTensionResultCache::is_spilling() const {
+  return is_spilling_;
+}
+
+int SagTensionResultCache::num_blocks() const {
+  return entries_.size();
+}
+
+void SagTensionResultCache::set_is_spilling(const bool& is_spilling) {
+  is_spilling_ = is_spilling;
+  Evict();
+}
+
+void SagTensionResultCache::set_size_budget(const long& size_budget) {
+  size_budget_ = size_budget;
+  Evict();
+}
+
+long SagTensionResultCache::size_budget() const {
+  return size_budget_;
+}
+
+long SagTensionResultCache::size_memory() const {
+  return size_memory_;
+}
+
+void SagTensionResultCache::Evict() {
+  // walks from the least recently used entry
+  auto iter = entries_.end();
+  while ((size_budget_ < size_memory_) && (iter != entries_.begin())) {
+    iter--;
+
+    Entry& entry = *iter;
+    if (entry.is_spilled == true) {
+      continue;
+    }
+
+    // spills the block if possible, otherwise discards it
+    if ((is_spilling_ == true) && (Spill(entry) == true)) {
+      continue;
+    }
+
+    iter = std::next(iter);
+    Erase(std::prev(iter));
+  }
+}
+
+void SagTensionResultCache::Erase(std::list<Entry>::iterator iter) {
+  Entry& entry = *iter;
+  if (entry.is_spilled == true) {
+    num_spilled_--;
+  } else {
+    size_memory_ -= entry.block.size();
+  }
+
+  index_.erase(entry.key);
+  entries_.erase(iter);
+
+  // deletes the spill file once it doesn't contain any blocks, which reclaims
+  // the space of blocks that were extracted
+  if ((num_spilled_ == 0) && (filepath_spill_.empty() == false)) {
+    file_spill_.Close();
+    wxRemoveFile(filepath_spill_);
+    filepath_spill_.clear();
+  }
+}
+
+bool SagTensionResultCache::Spill(Entry& entry) {
+  // creates the spill file if needed
+  if (filepath_spill_.empty() == true) {
+    const wxString filepath = wxFileName::CreateTempFileName("spananalyzer");
+    if (filepath.empty() == true) {
+      wxLogError("Couldn't create results spill file.");
+      return false;
+    }
+
+    if (file_spill_.Open(filepath, wxFile::read_write) == false) {
+      wxLogError("Couldn't open results spill file.");
+      wxRemoveFile(filepath);
+      return false;
+    }
+
+    filepath_spill_ = filepath;
+  }
+
+  // appends the block to the end of the spill file
+  const wxFileOffset offset = file_spill_.SeekEnd();
+  if (offset == wxInvalidOffset) {
+    return false;
+  }
+
+  if (file_spill_.Write(entry.block.data(), entry.block.size())
+      != entry.block.size()) {
+    wxLogError("Couldn't write cached results to spill file.");
+    return false;
+  }
+
+  // releases the block memory
+  size_memory_ -= entry.block.size();
+
+  entry.is_spilled = true;
+  entry.offset_spill = offset;
+  entry.size_spill = entry.block.size();
+  std::vector<char>().swap(entry.block);
+
+  num_spilled_++;
+
+  return true;
+}
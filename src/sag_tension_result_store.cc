@@ -0,0 +1,351 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/sag_tension_result_store.h"
+
+#include <cstring>
+
+namespace {
+
+/// \var kSizeConditions
+///   The number of conditions along the condition axis.
+const int kSizeConditions = 3;
+
+/// \var kSizeWord
+///   The number of bits in a validity bitmap word.
+const int kSizeWord = 64;
+
+/// \brief Appends a column to a block.
+/// \param[in] column
+///   The column.
+/// \param[in,out] block
+///   The block.
+template<typename T>
+void AppendColumn(const std::vector<T>& column, std::vector<char>& block) {
+  const size_t size = column.size() * sizeof(T);
+  const size_t offset = block.size();
+  block.resize(offset + size);
+  if (0 < size) {
+    std::memcpy(block.data() + offset, column.data(), size);
+  }
+}
+
+/// \brief Reads a column from a block.
+/// \param[in] block
+///   The block.
+/// \param[in] size_column
+///   The number of column elements.
+/// \param[in,out] offset
+///   The block offset, which is advanced past the column.
+/// \param[out] column
+///   The column that is populated.
+/// \return If the column was read.
+template<typename T>
+bool ReadColumn(const std::vector<char>& block, const size_t& size_column,
+                size_t& offset, std::vector<T>& column) {
+  const size_t size = size_column * sizeof(T);
+  if (block.size() < offset + size) {
+    return false;
+  }
+
+  column.resize(size_column);
+  if (0 < size) {
+    std::memcpy(column.data(), block.data() + offset, size);
+  }
+  offset += size;
+  return true;
+}
+
+}  // namespace
+
+SagTensionResultStore::SagTensionResultStore() {
+  size_cases_ = 0;
+}
+
+SagTensionResultStore::~SagTensionResultStore() {
+}
+
+void SagTensionResultStore::Clear() {
+  size_cases_ = 0;
+
+  // swaps with empty containers so the memory is released
+  flags_valid_.reset();
+  std::vector<double>().swap(lengths_unloaded_);
+  std::vector<float>().swap(residuals_length_);
+  std::vector<double>().swap(temperatures_);
+  std::vector<double>().swap(tensions_average_);
+  std::vector<float>().swap(tensions_average_core_);
+  std::vector<float>().swap(tensions_average_shell_);
+  std::vector<double>().swap(tensions_horizontal_);
+  std::vector<float>().swap(tensions_horizontal_core_);
+  std::vector<float>().swap(tensions_horizontal_shell_);
+  std::vector<float>().swap(times_solve_reloader_);
+  std::vector<float>().swap(times_solve_unloader_);
+  std::vector<SagTensionCableComponent::PolynomialType>().swap(
+      types_polynomial_);
+  std::vector<const WeatherLoadCase*>().swap(weathercases_);
+  std::vector<double>().swap(weights_unit_);
+}
+
+bool SagTensionResultStore::Deserialize(const std::vector<char>& block) {
+  // reads the number of cases and resizes
+  int size_cases = 0;
+  if (block.size() < sizeof(size_cases)) {
+    Clear();
+    return false;
+  }
+  std::memcpy(&size_cases, block.data(), sizeof(size_cases));
+  size_t offset = sizeof(size_cases);
+  if (size_cases < 0) {
+    Clear();
+    return false;
+  }
+
+  Reset(size_cases);
+
+  const size_t kSizeSlots = size_cases_ * kSizeConditions;
+  const size_t kSizeWords = (kSizeSlots + kSizeWord - 1) / kSizeWord;
+
+  // reads the validity bitmap
+  std::vector<uint64_t> words;
+  bool status = ReadColumn(block, kSizeWords, offset, words);
+  if (status == true) {
+    for (size_t i = 0; i < kSizeWords; i++) {
+      flags_valid_[i].store(words[i], std::memory_order_relaxed);
+    }
+  }
+
+  // reads columns
+  status = status
+      && ReadColumn(block, kSizeSlots, offset, lengths_unloaded_)
+      && ReadColumn(block, kSizeSlots, offset, residuals_length_)
+      && ReadColumn(block, kSizeSlots, offset, temperatures_)
+      && ReadColumn(block, kSizeSlots, offset, tensions_average_)
+      && ReadColumn(block, kSizeSlots, offset, tensions_average_core_)
+      && ReadColumn(block, kSizeSlots, offset, tensions_average_shell_)
+      && ReadColumn(block, kSizeSlots, offset, tensions_horizontal_)
+      && ReadColumn(block, kSizeSlots, offset, tensions_horizontal_core_)
+      && ReadColumn(block, kSizeSlots, offset, tensions_horizontal_shell_)
+      && ReadColumn(block, kSizeSlots, offset, times_solve_reloader_)
+      && ReadColumn(block, kSizeSlots, offset, times_solve_unloader_)
+      && ReadColumn(block, kSizeSlots, offset, types_polynomial_)
+      && ReadColumn(block, kSizeSlots * 3, offset, weights_unit_);
+
+  if (status == false) {
+    Clear();
+  }
+
+  return status;
+}
+
+bool SagTensionResultStore::IsValid(
+    const int& index_case,
+    const CableConditionType& condition) const {
+  const int index = IndexSlot(index_case, condition);
+  if (index == -1) {
+    return false;
+  }
+
+  const uint64_t word =
+      flags_valid_[index / kSizeWord].load(std::memory_order_acquire);
+  return (word & (uint64_t(1) << (index % kSizeWord))) != 0;
+}
+
+void SagTensionResultStore::Reset(const int& size_cases) {
+  const int kSizeSlots = size_cases * kSizeConditions;
+  const int kSizeWords = (kSizeSlots + kSizeWord - 1) / kSizeWord;
+
+  // reallocates the bitmap if the size changed, and clears all flags
+  if (size_cases_ != size_cases) {
+    flags_valid_.reset(new std::atomic<uint64_t>[kSizeWords]);
+  }
+  for (int i = 0; i < kSizeWords; i++) {
+    flags_valid_[i].store(0, std::memory_order_relaxed);
+  }
+
+  size_cases_ = size_cases;
+
+  // resizes columns
+  lengths_unloaded_.assign(kSizeSlots, 0);
+  residuals_length_.assign(kSizeSlots, 0);
+  temperatures_.assign(kSizeSlots, 0);
+  tensions_average_.assign(kSizeSlots, 0);
+  tensions_average_core_.assign(kSizeSlots, 0);
+  tensions_average_shell_.assign(kSizeSlots, 0);
+  tensions_horizontal_.assign(kSizeSlots, 0);
+  tensions_horizontal_core_.assign(kSizeSlots, 0);
+  tensions_horizontal_shell_.assign(kSizeSlots, 0);
+  times_solve_reloader_.assign(kSizeSlots, 0);
+  times_solve_unloader_.assign(kSizeSlots, 0);
+  types_polynomial_.assign(
+      kSizeSlots, SagTensionCableComponent::PolynomialType::kLoadStrain);
+  weathercases_.assign(size_cases, nullptr);
+  weights_unit_.assign(kSizeSlots * 3, 0);
+}
+
+bool SagTensionResultStore::Result(const int& index_case,
+                                   const CableConditionType& condition,
+                                   SagTensionAnalysisResult& result) const {
+  const int index = IndexSlot(index_case, condition);
+  if (index == -1) {
+    return false;
+  }
+
+  // populates data that is stored for valid and invalid results
+  result.time_solve_reloader = times_solve_reloader_[index];
+  result.time_solve_unloader = times_solve_unloader_[index];
+  result.weathercase = weathercases_[index_case];
+
+  if (IsValid(index_case, condition) == false) {
+    result.condition = CableConditionType::kNull;
+    result.length_unloaded = -999999;
+    result.residual_length = -999999;
+    result.state = CableState();
+    result.tension_average = -999999;
+    result.tension_average_core = -999999;
+    result.tension_average_shell = -999999;
+    result.tension_horizontal = -999999;
+    result.tension_horizontal_core = -999999;
+    result.tension_horizontal_shell = -999999;
+    result.weight_unit = Vector3d();
+    return false;
+  }
+
+  result.condition = condition;
+  result.length_unloaded = lengths_unloaded_[index];
+  result.residual_length = residuals_length_[index];
+  result.state.temperature = temperatures_[index];
+  result.state.type_polynomial = types_polynomial_[index];
+  result.tension_average = tensions_average_[index];
+  result.tension_average_core = tensions_average_core_[index];
+  result.tension_average_shell = tensions_average_shell_[index];
+  result.tension_horizontal = tensions_horizontal_[index];
+  result.tension_horizontal_core = tensions_horizontal_core_[index];
+  result.tension_horizontal_shell = tensions_horizontal_shell_[index];
+  result.weight_unit = Vector3d(weights_unit_[index * 3],
+                                weights_unit_[index * 3 + 1],
+                                weights_unit_[index * 3 + 2]);
+
+  return true;
+}
+
+void SagTensionResultStore::Serialize(std::vector<char>& block) const {
+  const size_t kSizeSlots = size_cases_ * kSizeConditions;
+  const size_t kSizeWords = (kSizeSlots + kSizeWord - 1) / kSizeWord;
+
+  block.clear();
+  block.reserve(sizeof(size_cases_) + SizeMemory());
+
+  // writes the number of cases
+  block.resize(sizeof(size_cases_));
+  std::memcpy(block.data(), &size_cases_, sizeof(size_cases_));
+
+  // writes the validity bitmap
+  std::vector<uint64_t> words(kSizeWords);
+  for (size_t i = 0; i < kSizeWords; i++) {
+    words[i] = flags_valid_[i].load(std::memory_order_acquire);
+  }
+  AppendColumn(words, block);
+
+  // writes columns
+  AppendColumn(lengths_unloaded_, block);
+  AppendColumn(residuals_length_, block);
+  AppendColumn(temperatures_, block);
+  AppendColumn(tensions_average_, block);
+  AppendColumn(tensions_average_core_, block);
+  AppendColumn(tensions_average_shell_, block);
+  AppendColumn(tensions_horizontal_, block);
+  AppendColumn(tensions_horizontal_core_, block);
+  AppendColumn(tensions_horizontal_shell_, block);
+  AppendColumn(times_solve_reloader_, block);
+  AppendColumn(times_solve_unloader_, block);
+  AppendColumn(types_polynomial_, block);
+  AppendColumn(weights_unit_, block);
+}
+
+void SagTensionResultStore::SetResult(const int& index_case,
+                                      const CableConditionType& condition,
+                                      const SagTensionAnalysisResult& result) {
+  const int index = IndexSlot(index_case, condition);
+  if (index == -1) {
+    return;
+  }
+
+  // solver statistics are stored for valid and invalid results
+  times_solve_reloader_[index] =
+      static_cast<float>(result.time_solve_reloader);
+  times_solve_unloader_[index] =
+      static_cast<float>(result.time_solve_unloader);
+
+  if (result.condition == CableConditionType::kNull) {
+    return;
+  }
+
+  lengths_unloaded_[index] = result.length_unloaded;
+  residuals_length_[index] = static_cast<float>(result.residual_length);
+  temperatures_[index] = result.state.temperature;
+  types_polynomial_[index] = result.state.type_polynomial;
+  tensions_average_[index] = result.tension_average;
+  tensions_average_core_[index] =
+      static_cast<float>(result.tension_average_core);
+  tensions_average_shell_[index] =
+      static_cast<float>(result.tension_average_shell);
+  tensions_horizontal_[index] = result.tension_horizontal;
+  tensions_horizontal_core_[index] =
+      static_cast<float>(result.tension_horizontal_core);
+  tensions_horizontal_shell_[index] =
+      static_cast<float>(result.tension_horizontal_shell);
+  weights_unit_[index * 3] = result.weight_unit.x();
+  weights_unit_[index * 3 + 1] = result.weight_unit.y();
+  weights_unit_[index * 3 + 2] = result.weight_unit.z();
+
+  // flags the slot as valid after the columns are written
+  flags_valid_[index / kSizeWord].fetch_or(
+      uint64_t(1) << (index % kSizeWord), std::memory_order_release);
+}
+
+void SagTensionResultStore::SetWeathercase(
+    const int& index_case,
+    const WeatherLoadCase* weathercase) {
+  if ((index_case < 0) || (size_cases_ <= index_case)) {
+    return;
+  }
+
+  weathercases_[index_case] = weathercase;
+}
+
+long SagTensionResultStore::SizeMemory() const {
+  const long kSizeSlots = static_cast<long>(size_cases_) * kSizeConditions;
+  const long kSizeWords = (kSizeSlots + kSizeWord - 1) / kSizeWord;
+
+  long size = kSizeWords * sizeof(uint64_t);
+  size += kSizeSlots * (sizeof(double) * 7 + sizeof(float) * 7
+                        + sizeof(SagTensionCableComponent::PolynomialType));
+  size += size_cases_ * sizeof(const WeatherLoadCase*);
+  return size;
+}
+
+int SagTensionResultStore::size_cases() const {
+  return size_cases_;
+}
+
+int SagTensionResultStore::IndexSlot(
+    const int& index_case,
+    const CableConditionType& condition) const {
+  if ((index_case < 0) || (size_cases_ <= index_case)) {
+    return -1;
+  }
+
+  int index_condition = -1;
+  if (condition == CableConditionType::kCreep) {
+    index_condition = 0;
+  } else if (condition == CableConditionType::kInitial) {
+    index_condition = 1;
+  } else if (condition == CableConditionType::kLoad) {
+    index_condition = 2;
+  } else {
+    return -1;
+  }
+
+  return index_condition * size_cases_ + index_case;
+}
@@ -34,6 +34,19 @@ bool Span::Validate(const bool& is_included_warnings,
     }
   }
 
+  // validates profile
+  for (auto iter = profile.cbegin(); iter != profile.cend(); iter++) {
+    const ProfilePoint& point = *iter;
+    if (point.clearance < 0) {
+      is_valid = false;
+      if (messages != nullptr) {
+        message.description = "Invalid profile point clearance";
+        messages->push_back(message);
+      }
+      break;
+    }
+  }
+
   // validates spacing-attachments
   if (spacing_attachments.x() < 0) {
     is_valid = false;
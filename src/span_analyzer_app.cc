@@ -7,8 +7,11 @@
 #include "wx/filename.h"
 #include "wx/fs_zip.h"
 #include "wx/stdpaths.h"
+#include "wx/tokenzr.h"
 #include "wx/xrc/xmlres.h"
 
+#include "spananalyzer/batch_runner.h"
+#include "spananalyzer/benchmark_runner.h"
 #include "spananalyzer/file_handler.h"
 #include "spananalyzer/span_analyzer_doc.h"
 #include "spananalyzer/span_analyzer_view.h"
@@ -24,6 +27,16 @@ IMPLEMENT_APP(SpanAnalyzerApp)
 SpanAnalyzerApp::SpanAnalyzerApp() {
   frame_ = nullptr;
   manager_doc_ = nullptr;
+  units_model_ = units::UnitSystem::kImperial;
+
+  options_threads_cmdline_.is_background = false;
+  options_threads_cmdline_.is_pinned = false;
+  options_threads_cmdline_.max_threads = -1;
+
+  index_begin_batch_ = -1;
+  index_end_batch_ = -1;
+  max_processes_batch_ = 0;
+  size_shard_batch_ = 1000;
 }
 
 SpanAnalyzerApp::~SpanAnalyzerApp() {
@@ -33,6 +46,11 @@ SpanAnalyzerDoc* SpanAnalyzerApp::GetDocument() const {
   return dynamic_cast<SpanAnalyzerDoc*>(manager_doc_->GetCurrentDocument());
 }
 
+bool SpanAnalyzerApp::IsHeadless() const {
+  return (filepath_benchmark_.empty() == false)
+         || (filepath_batch_.empty() == false);
+}
+
 bool SpanAnalyzerApp::OnCmdLineParsed(wxCmdLineParser& parser) {
   // gets the config file path
   wxString filepath_config;
@@ -75,6 +93,105 @@ bool SpanAnalyzerApp::OnCmdLineParsed(wxCmdLineParser& parser) {
     filepath_start_ = parser.GetParam(0);
   }
 
+  // gets the benchmark settings
+  wxString filepath_benchmark;
+  if (parser.Found("benchmark", &filepath_benchmark)) {
+    if (filepath_start_.empty() == true) {
+      wxLogError("A benchmark requires a document file.");
+      return false;
+    }
+
+    // converts filepath to absolute if needed
+    wxFileName path(filepath_benchmark);
+    if (path.IsAbsolute() == false) {
+      path.MakeAbsolute(wxEmptyString, wxPATH_NATIVE);
+    }
+
+    filepath_benchmark_ = path.GetFullPath();
+  }
+
+  wxString str_threads;
+  if (parser.Found("benchmark-threads", &str_threads)) {
+    wxStringTokenizer tokenizer(str_threads, ",");
+    while (tokenizer.HasMoreTokens() == true) {
+      long num_threads = -1;
+      if ((tokenizer.GetNextToken().ToLong(&num_threads) == false)
+          || (num_threads < 1)) {
+        wxLogError("Invalid benchmark thread count.");
+        return false;
+      }
+
+      threads_benchmark_.push_back(num_threads);
+    }
+  }
+
+  // gets the batch settings
+  wxString filepath_batch;
+  if (parser.Found("batch", &filepath_batch)) {
+    if (filepath_start_.empty() == true) {
+      wxLogError("A batch analysis requires a document file or directory.");
+      return false;
+    }
+
+    // converts filepaths to absolute if needed, as they are passed on to the
+    // shard processes
+    wxFileName path(filepath_batch);
+    if (path.IsAbsolute() == false) {
+      path.MakeAbsolute(wxEmptyString, wxPATH_NATIVE);
+    }
+    filepath_batch_ = path.GetFullPath();
+
+    path = wxFileName(filepath_start_);
+    if (path.IsAbsolute() == false) {
+      path.MakeAbsolute(wxEmptyString, wxPATH_NATIVE);
+    }
+    filepath_start_ = path.GetFullPath();
+  }
+
+  long value = -1;
+  if (parser.Found("batch-processes", &value)) {
+    max_processes_batch_ = value;
+  }
+
+  if (parser.Found("batch-spans", &value)) {
+    if (value < 1) {
+      wxLogError("Invalid batch shard span count.");
+      return false;
+    }
+
+    size_shard_batch_ = value;
+  }
+
+  wxString str_shard;
+  if (parser.Found("batch-shard", &str_shard)) {
+    long index_begin = -1;
+    long index_end = -1;
+    if ((str_shard.BeforeFirst(',').ToLong(&index_begin) == false)
+        || (str_shard.AfterFirst(',').ToLong(&index_end) == false)
+        || (index_begin < 0) || (index_end < index_begin)
+        || (filepath_batch_.empty() == true)) {
+      wxLogError("Invalid batch shard.");
+      return false;
+    }
+
+    index_begin_batch_ = index_begin;
+    index_end_batch_ = index_end;
+  }
+
+  // gets the analysis thread overrides
+  long max_threads = -1;
+  if (parser.Found("threads", &max_threads)) {
+    if (max_threads < 0) {
+      wxLogError("Invalid analysis thread count.");
+      return false;
+    }
+
+    options_threads_cmdline_.max_threads = max_threads;
+  }
+
+  options_threads_cmdline_.is_pinned = parser.Found("threads-pinned");
+  options_threads_cmdline_.is_background = parser.Found("threads-background");
+
   return true;
 }
 
@@ -82,8 +199,14 @@ int SpanAnalyzerApp::OnExit() {
   // disables logging because all windows are destroyed
   wxLog::EnableLogging(false);
 
+  // finishes any files that are being saved in the background
+  controller_save_.Wait();
+
   // saves config file
-  FileHandler::SaveConfigFile(filepath_config_, config_);
+  // shard processes share the config file, so only the batch saves it
+  if (index_begin_batch_ == -1) {
+    FileHandler::SaveConfigFile(filepath_config_, config_);
+  }
 
   // cleans up allocated resources
   delete config_.data_page;
@@ -139,8 +262,13 @@ bool SpanAnalyzerApp::OnInit() {
   SetTopWindow(frame_);
 
   // sets application logging to a modeless dialog managed by the frame
-  wxLogTextCtrl* log = new wxLogTextCtrl(frame_->pane_log()->textctrl());
-  wxLog::SetActiveTarget(log);
+  // a benchmark or batch logs to the console because the frame is never shown
+  if (IsHeadless() == false) {
+    wxLogTextCtrl* log = new wxLogTextCtrl(frame_->pane_log()->textctrl());
+    wxLog::SetActiveTarget(log);
+  } else {
+    wxLog::SetActiveTarget(new wxLogStderr());
+  }
 
   // manually initailizes application config defaults
   filename = wxFileName(filepath_config_);
@@ -154,6 +282,8 @@ bool SpanAnalyzerApp::OnInit() {
   config_.filepath_data = filename.GetPathWithSep() + "appdata.xml";
   config_.is_maximized_frame = true;
   config_.level_log = wxLOG_Message;
+  config_.options_cache_results.is_spilling = false;
+  config_.options_cache_results.size_memory = 256;
   config_.options_plot_cable.color_core = *wxRED;
   config_.options_plot_cable.color_markers = *wxGREEN;
   config_.options_plot_cable.color_shell = *wxBLUE;
@@ -167,8 +297,14 @@ bool SpanAnalyzerApp::OnInit() {
   config_.options_plot_profile.scale_horizontal = 1;
   config_.options_plot_profile.scale_vertical = 10;
   config_.options_plot_profile.thickness_line = 1;
+  config_.options_surrogate.is_enabled = false;
+  config_.options_surrogate.tolerance = 0.001;
+  config_.options_threads.is_background = false;
+  config_.options_threads.is_pinned = false;
+  config_.options_threads.max_threads = 0;
   config_.perspective = "";
   config_.size_frame = wxSize(400, 400);
+  config_.size_memory_undo = 64;
   config_.units = units::UnitSystem::kImperial;
 
   // loads config settings from file, or saves a file if it doesn't exist
@@ -236,13 +372,17 @@ bool SpanAnalyzerApp::OnInit() {
     frame_->Maximize();
   }
 
+  // fixes the model unit system for the session
+  // changing the unit system in the preferences only affects the display
+  units_model_ = config_.units;
+
   // loads app data from file, or saves a file if it doesn't exist
   // filehandler handles all logging
   filename = wxFileName(config_.filepath_data);
   if (filename.Exists() == true) {
     // loads application data file
     const int status_data = FileHandler::LoadAppData(config_.filepath_data,
-                                                     config_.units, data_);
+                                                     units_model_, data_);
     if ((status_data == -1) || (status_data == 1)) {
       // notifies user of error
       wxString message = config_.filepath_data + "  --  "
@@ -256,7 +396,15 @@ bool SpanAnalyzerApp::OnInit() {
     wxLogError(message.c_str());
 
     // saves new data file
-    FileHandler::SaveAppData(config_.filepath_data, data_, config_.units);
+    FileHandler::SaveAppData(config_.filepath_data, data_, units_model_);
+  }
+
+  // indexes the app data, so references can be resolved by name
+  index_data_.Build(data_);
+
+  // exits early for a benchmark or batch, which opens the documents itself
+  if (IsHeadless() == true) {
+    return true;
   }
 
   // loads a document if defined in command line
@@ -281,10 +429,71 @@ void SpanAnalyzerApp::OnInitCmdLine(wxCmdLineParser& parser) {
   parser.SetSwitchChars("--");
 }
 
+int SpanAnalyzerApp::OnRun() {
+  // runs a batch analysis, or a single shard of one
+  if (filepath_batch_.empty() == false) {
+    BatchRunner runner;
+    runner.set_filepath_config(filepath_config_);
+    runner.set_filepath_input(filepath_start_);
+    runner.set_filepath_results(filepath_batch_);
+    runner.set_max_processes(max_processes_batch_);
+    runner.set_size_shard(size_shard_batch_);
+
+    bool status = false;
+    if (index_begin_batch_ == -1) {
+      status = runner.Run();
+    } else {
+      status = runner.RunShard(index_begin_batch_, index_end_batch_);
+    }
+
+    if (status == true) {
+      return 0;
+    } else {
+      return 1;
+    }
+  }
+
+  // runs the main loop if a benchmark isn't specified
+  if (filepath_benchmark_.empty() == true) {
+    return wxApp::OnRun();
+  }
+
+  // runs the benchmark
+  BenchmarkRunner runner(manager_doc_);
+  runner.set_filepath_doc(filepath_start_);
+  runner.set_filepath_results(filepath_benchmark_);
+  runner.set_threads(threads_benchmark_);
+
+  if (runner.Run() == true) {
+    return 0;
+  } else {
+    return 1;
+  }
+}
+
+ThreadOptions SpanAnalyzerApp::OptionsThreads() const {
+  ThreadOptions options = config_.options_threads;
+  if (0 <= options_threads_cmdline_.max_threads) {
+    options.max_threads = options_threads_cmdline_.max_threads;
+  }
+  if (options_threads_cmdline_.is_background == true) {
+    options.is_background = true;
+  }
+  if (options_threads_cmdline_.is_pinned == true) {
+    options.is_pinned = true;
+  }
+
+  return options;
+}
+
 SpanAnalyzerConfig* SpanAnalyzerApp::config() {
   return &config_;
 }
 
+FileSaveController* SpanAnalyzerApp::controller_save() {
+  return &controller_save_;
+}
+
 SpanAnalyzerData* SpanAnalyzerApp::data() {
   return &data_;
 }
@@ -297,10 +506,18 @@ wxHtmlHelpController* SpanAnalyzerApp::help() {
   return help_;
 }
 
+DataIndex* SpanAnalyzerApp::index_data() {
+  return &index_data_;
+}
+
 wxDocManager* SpanAnalyzerApp::manager_doc() {
   return manager_doc_;
 }
 
+units::UnitSystem SpanAnalyzerApp::units_model() const {
+  return units_model_;
+}
+
 std::string SpanAnalyzerApp::version() const {
   return version_;
 }
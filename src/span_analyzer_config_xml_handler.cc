@@ -4,6 +4,7 @@
 #include "spananalyzer/span_analyzer_config_xml_handler.h"
 
 #include "appcommon/xml/color_xml_handler.h"
+#include "models/base/helper.h"
 #include "wx/filename.h"
 
 #include "spananalyzer/span_analyzer_app.h"
@@ -19,7 +20,7 @@ wxXmlNode* SpanAnalyzerConfigXmlHandler::CreateNode(
 
   // creates a node for the root
   node_root = new wxXmlNode(wxXML_ELEMENT_NODE, "span_analyzer_config");
-  node_root->AddAttribute("version", "2");
+  node_root->AddAttribute("version", "6");
 
   // adds child nodes for struct parameters
 
@@ -46,6 +47,22 @@ wxXmlNode* SpanAnalyzerConfigXmlHandler::CreateNode(
                                              "background");
   node_root->AddChild(node_element);
 
+  // creates options-cache-results node
+  title = "options_cache_results";
+  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
+
+  title = "is_spilling";
+  content = std::to_string(config.options_cache_results.is_spilling);
+  sub_node = CreateElementNodeWithContent(title, content);
+  node_element->AddChild(sub_node);
+
+  title = "size_memory";
+  content = std::to_string(config.options_cache_results.size_memory);
+  sub_node = CreateElementNodeWithContent(title, content);
+  node_element->AddChild(sub_node);
+
+  node_root->AddChild(node_element);
+
   // creates options-plot-cable node
   title = "options_plot_cable";
   node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
@@ -123,6 +140,44 @@ wxXmlNode* SpanAnalyzerConfigXmlHandler::CreateNode(
 
   node_root->AddChild(node_element);
 
+  // creates options-surrogate node
+  title = "options_surrogate";
+  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
+
+  title = "is_enabled";
+  content = std::to_string(config.options_surrogate.is_enabled);
+  sub_node = CreateElementNodeWithContent(title, content);
+  node_element->AddChild(sub_node);
+
+  title = "tolerance";
+  content = helper::DoubleToString(config.options_surrogate.tolerance, 6,
+                                   true);
+  sub_node = CreateElementNodeWithContent(title, content);
+  node_element->AddChild(sub_node);
+
+  node_root->AddChild(node_element);
+
+  // creates options-threads node
+  title = "options_threads";
+  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
+
+  title = "is_background";
+  content = std::to_string(config.options_threads.is_background);
+  sub_node = CreateElementNodeWithContent(title, content);
+  node_element->AddChild(sub_node);
+
+  title = "is_pinned";
+  content = std::to_string(config.options_threads.is_pinned);
+  sub_node = CreateElementNodeWithContent(title, content);
+  node_element->AddChild(sub_node);
+
+  title = "max_threads";
+  content = std::to_string(config.options_threads.max_threads);
+  sub_node = CreateElementNodeWithContent(title, content);
+  node_element->AddChild(sub_node);
+
+  node_root->AddChild(node_element);
+
   // creates perspective node
   title = "perspective";
   content = config.perspective;
@@ -143,6 +198,12 @@ wxXmlNode* SpanAnalyzerConfigXmlHandler::CreateNode(
   node_element->AddAttribute("is_maximized", str);
   node_root->AddChild(node_element);
 
+  // creates size-memory-undo node
+  title = "size_memory_undo";
+  content = std::to_string(config.size_memory_undo);
+  node_element = CreateElementNodeWithContent(title, content);
+  node_root->AddChild(node_element);
+
   // creates units node
   title = "units";
   if (config.units == units::UnitSystem::kMetric) {
@@ -184,6 +245,14 @@ bool SpanAnalyzerConfigXmlHandler::ParseNode(const wxXmlNode* root,
     return ParseNodeV1(root, filepath, config);
   } else if (kVersion == 2) {
     return ParseNodeV2(root, filepath, config);
+  } else if (kVersion == 3) {
+    return ParseNodeV3(root, filepath, config);
+  } else if (kVersion == 4) {
+    return ParseNodeV4(root, filepath, config);
+  } else if (kVersion == 5) {
+    return ParseNodeV5(root, filepath, config);
+  } else if (kVersion == 6) {
+    return ParseNodeV6(root, filepath, config);
   } else {
     message = FileAndLineNumber(filepath, root) +
               " Invalid version number. Aborting node parse.";
@@ -618,3 +687,1264 @@ bool SpanAnalyzerConfigXmlHandler::ParseNodeV2(const wxXmlNode* root,
 
   return status;
 }
+
+bool SpanAnalyzerConfigXmlHandler::ParseNodeV3(const wxXmlNode* root,
+                                               const std::string& filepath,
+                                               SpanAnalyzerConfig& config) {
+  bool status = true;
+  wxString message;
+
+  // evaluates each child node
+  const wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    const wxString title = node->GetName();
+    const wxString content = ParseElementNodeWithContent(node);
+
+    if ((title == "color") && (node->GetAttribute("name") == "background")) {
+      status = ColorXmlHandler::ParseNode(node, filepath,
+                                          config.color_background);
+    } else if (title == "filepath_data") {
+      if (content.empty() == false) {
+        config.filepath_data = content;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Application data file isn't defined. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "level_log") {
+      if (content == "Normal") {
+        config.level_log = wxLOG_Message;
+      } else if (content == "Verbose") {
+        config.level_log = wxLOG_Info;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Logging level isn't recognized. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "options_cache_results") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "is_spilling") {
+          if (sub_content == "0") {
+            config.options_cache_results.is_spilling = false;
+          } else if (sub_content == "1") {
+            config.options_cache_results.is_spilling = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid spilling indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "size_memory") {
+          if ((sub_content.ToLong(&value) == true) && (0 <= value)) {
+            config.options_cache_results.size_memory = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid memory size. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_cable") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "core") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_core);
+          } else if (sub_node->GetAttribute("name") == "markers") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_markers);
+          } else if (sub_node->GetAttribute("name") == "shell") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_shell);
+          } else if (sub_node->GetAttribute("name") == "total") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_total);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_cable.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_plan") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_plan.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_profile") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_profile.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "perspective") {
+      config.perspective = content;
+    } else if (title == "size_frame") {
+      std::string str;
+      int value;
+
+      str = node->GetAttribute("x");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetWidth(value);
+      }
+
+      str = node->GetAttribute("y");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetHeight(value);
+      }
+
+      str = node->GetAttribute("is_maximized");
+      if (str == "0") {
+        config.is_maximized_frame = false;
+      } else if (str =="1") {
+        config.is_maximized_frame = true;
+      }
+    } else if (title == "units") {
+      if (content == "Metric") {
+        config.units = units::UnitSystem::kMetric;
+      } else if (content == "Imperial") {
+        config.units = units::UnitSystem::kImperial;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Unit system isn't recognized. Keeping default setting.";
+        wxLogWarning(message);
+      }
+    } else {
+      message = FileAndLineNumber(filepath, node)
+                + "XML node isn't recognized. Skipping.";
+      wxLogError(message);
+      status = false;
+    }
+
+    node = node->GetNext();
+  }
+
+  return status;
+}
+
+bool SpanAnalyzerConfigXmlHandler::ParseNodeV4(const wxXmlNode* root,
+                                               const std::string& filepath,
+                                               SpanAnalyzerConfig& config) {
+  bool status = true;
+  wxString message;
+
+  // evaluates each child node
+  const wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    const wxString title = node->GetName();
+    const wxString content = ParseElementNodeWithContent(node);
+
+    if ((title == "color") && (node->GetAttribute("name") == "background")) {
+      status = ColorXmlHandler::ParseNode(node, filepath,
+                                          config.color_background);
+    } else if (title == "filepath_data") {
+      if (content.empty() == false) {
+        config.filepath_data = content;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Application data file isn't defined. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "level_log") {
+      if (content == "Normal") {
+        config.level_log = wxLOG_Message;
+      } else if (content == "Verbose") {
+        config.level_log = wxLOG_Info;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Logging level isn't recognized. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "options_cache_results") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "is_spilling") {
+          if (sub_content == "0") {
+            config.options_cache_results.is_spilling = false;
+          } else if (sub_content == "1") {
+            config.options_cache_results.is_spilling = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid spilling indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "size_memory") {
+          if ((sub_content.ToLong(&value) == true) && (0 <= value)) {
+            config.options_cache_results.size_memory = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid memory size. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_cable") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "core") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_core);
+          } else if (sub_node->GetAttribute("name") == "markers") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_markers);
+          } else if (sub_node->GetAttribute("name") == "shell") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_shell);
+          } else if (sub_node->GetAttribute("name") == "total") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_total);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_cable.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_plan") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_plan.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_profile") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_profile.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "perspective") {
+      config.perspective = content;
+    } else if (title == "size_memory_undo") {
+      long value = -9999;
+      if ((content.ToLong(&value) == true) && (0 <= value)) {
+        config.size_memory_undo = value;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Invalid undo memory size. Keeping default setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "size_frame") {
+      std::string str;
+      int value;
+
+      str = node->GetAttribute("x");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetWidth(value);
+      }
+
+      str = node->GetAttribute("y");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetHeight(value);
+      }
+
+      str = node->GetAttribute("is_maximized");
+      if (str == "0") {
+        config.is_maximized_frame = false;
+      } else if (str =="1") {
+        config.is_maximized_frame = true;
+      }
+    } else if (title == "units") {
+      if (content == "Metric") {
+        config.units = units::UnitSystem::kMetric;
+      } else if (content == "Imperial") {
+        config.units = units::UnitSystem::kImperial;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Unit system isn't recognized. Keeping default setting.";
+        wxLogWarning(message);
+      }
+    } else {
+      message = FileAndLineNumber(filepath, node)
+                + "XML node isn't recognized. Skipping.";
+      wxLogError(message);
+      status = false;
+    }
+
+    node = node->GetNext();
+  }
+
+  return status;
+}
+
+bool SpanAnalyzerConfigXmlHandler::ParseNodeV5(const wxXmlNode* root,
+                                               const std::string& filepath,
+                                               SpanAnalyzerConfig& config) {
+  bool status = true;
+  wxString message;
+
+  // evaluates each child node
+  const wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    const wxString title = node->GetName();
+    const wxString content = ParseElementNodeWithContent(node);
+
+    if ((title == "color") && (node->GetAttribute("name") == "background")) {
+      status = ColorXmlHandler::ParseNode(node, filepath,
+                                          config.color_background);
+    } else if (title == "filepath_data") {
+      if (content.empty() == false) {
+        config.filepath_data = content;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Application data file isn't defined. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "level_log") {
+      if (content == "Normal") {
+        config.level_log = wxLOG_Message;
+      } else if (content == "Verbose") {
+        config.level_log = wxLOG_Info;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Logging level isn't recognized. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "options_cache_results") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "is_spilling") {
+          if (sub_content == "0") {
+            config.options_cache_results.is_spilling = false;
+          } else if (sub_content == "1") {
+            config.options_cache_results.is_spilling = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid spilling indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "size_memory") {
+          if ((sub_content.ToLong(&value) == true) && (0 <= value)) {
+            config.options_cache_results.size_memory = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid memory size. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_cable") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "core") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_core);
+          } else if (sub_node->GetAttribute("name") == "markers") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_markers);
+          } else if (sub_node->GetAttribute("name") == "shell") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_shell);
+          } else if (sub_node->GetAttribute("name") == "total") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_total);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_cable.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_plan") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_plan.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_profile") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_profile.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_surrogate") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        double value = -9999;
+
+        if (sub_title == "is_enabled") {
+          if (sub_content == "0") {
+            config.options_surrogate.is_enabled = false;
+          } else if (sub_content == "1") {
+            config.options_surrogate.is_enabled = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid surrogate indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "tolerance") {
+          if ((sub_content.ToDouble(&value) == true) && (0 < value)) {
+            config.options_surrogate.tolerance = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid surrogate tolerance. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "perspective") {
+      config.perspective = content;
+    } else if (title == "size_memory_undo") {
+      long value = -9999;
+      if ((content.ToLong(&value) == true) && (0 <= value)) {
+        config.size_memory_undo = value;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Invalid undo memory size. Keeping default setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "size_frame") {
+      std::string str;
+      int value;
+
+      str = node->GetAttribute("x");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetWidth(value);
+      }
+
+      str = node->GetAttribute("y");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetHeight(value);
+      }
+
+      str = node->GetAttribute("is_maximized");
+      if (str == "0") {
+        config.is_maximized_frame = false;
+      } else if (str =="1") {
+        config.is_maximized_frame = true;
+      }
+    } else if (title == "units") {
+      if (content == "Metric") {
+        config.units = units::UnitSystem::kMetric;
+      } else if (content == "Imperial") {
+        config.units = units::UnitSystem::kImperial;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Unit system isn't recognized. Keeping default setting.";
+        wxLogWarning(message);
+      }
+    } else {
+      message = FileAndLineNumber(filepath, node)
+                + "XML node isn't recognized. Skipping.";
+      wxLogError(message);
+      status = false;
+    }
+
+    node = node->GetNext();
+  }
+
+  return status;
+}
+
+bool SpanAnalyzerConfigXmlHandler::ParseNodeV6(const wxXmlNode* root,
+                                               const std::string& filepath,
+                                               SpanAnalyzerConfig& config) {
+  bool status = true;
+  wxString message;
+
+  // evaluates each child node
+  const wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    const wxString title = node->GetName();
+    const wxString content = ParseElementNodeWithContent(node);
+
+    if ((title == "color") && (node->GetAttribute("name") == "background")) {
+      status = ColorXmlHandler::ParseNode(node, filepath,
+                                          config.color_background);
+    } else if (title == "filepath_data") {
+      if (content.empty() == false) {
+        config.filepath_data = content;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Application data file isn't defined. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "level_log") {
+      if (content == "Normal") {
+        config.level_log = wxLOG_Message;
+      } else if (content == "Verbose") {
+        config.level_log = wxLOG_Info;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Logging level isn't recognized. Keeping default "
+                  "setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "options_cache_results") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "is_spilling") {
+          if (sub_content == "0") {
+            config.options_cache_results.is_spilling = false;
+          } else if (sub_content == "1") {
+            config.options_cache_results.is_spilling = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid spilling indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "size_memory") {
+          if ((sub_content.ToLong(&value) == true) && (0 <= value)) {
+            config.options_cache_results.size_memory = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid memory size. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_cable") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "core") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_core);
+          } else if (sub_node->GetAttribute("name") == "markers") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_markers);
+          } else if (sub_node->GetAttribute("name") == "shell") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_shell);
+          } else if (sub_node->GetAttribute("name") == "total") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_cable.color_total);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_cable.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_plan") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_plan.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_plan.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_plot_profile") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "color") {
+          if (sub_node->GetAttribute("name") == "catenary") {
+            status = ColorXmlHandler::ParseNode(
+                sub_node, filepath,
+                config.options_plot_profile.color_catenary);
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "XML node isn't recognized. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_horizontal") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_horizontal = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid horizontal scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "scale_vertical") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.scale_vertical = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid vertical scale. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "thickness_line") {
+          if (sub_content.ToLong(&value) == true) {
+            config.options_plot_profile.thickness_line = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid line thickness. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_surrogate") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        double value = -9999;
+
+        if (sub_title == "is_enabled") {
+          if (sub_content == "0") {
+            config.options_surrogate.is_enabled = false;
+          } else if (sub_content == "1") {
+            config.options_surrogate.is_enabled = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid surrogate indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "tolerance") {
+          if ((sub_content.ToDouble(&value) == true) && (0 < value)) {
+            config.options_surrogate.tolerance = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid surrogate tolerance. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "options_threads") {
+      // gets sub-nodes
+      wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        wxString sub_title = sub_node->GetName();
+        wxString sub_content = ParseElementNodeWithContent(sub_node);
+        long value = -9999;
+
+        if (sub_title == "is_background") {
+          if (sub_content == "0") {
+            config.options_threads.is_background = false;
+          } else if (sub_content == "1") {
+            config.options_threads.is_background = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid background indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "is_pinned") {
+          if (sub_content == "0") {
+            config.options_threads.is_pinned = false;
+          } else if (sub_content == "1") {
+            config.options_threads.is_pinned = true;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid pinning indicator. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else if (sub_title == "max_threads") {
+          if ((sub_content.ToLong(&value) == true) && (0 <= value)) {
+            config.options_threads.max_threads = value;
+          } else {
+            message = FileAndLineNumber(filepath, node)
+                      + "Invalid maximum thread count. Skipping.";
+            wxLogError(message);
+            status = false;
+          }
+        } else {
+          message = FileAndLineNumber(filepath, node)
+                    + "XML node isn't recognized. Skipping.";
+          wxLogError(message);
+          status = false;
+        }
+
+        sub_node = sub_node->GetNext();
+      }
+    } else if (title == "perspective") {
+      config.perspective = content;
+    } else if (title == "size_memory_undo") {
+      long value = -9999;
+      if ((content.ToLong(&value) == true) && (0 <= value)) {
+        config.size_memory_undo = value;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Invalid undo memory size. Keeping default setting.";
+        wxLogWarning(message);
+      }
+    } else if (title == "size_frame") {
+      std::string str;
+      int value;
+
+      str = node->GetAttribute("x");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetWidth(value);
+      }
+
+      str = node->GetAttribute("y");
+      value = std::stoi(str);
+      if (400 < value) {
+        config.size_frame.SetHeight(value);
+      }
+
+      str = node->GetAttribute("is_maximized");
+      if (str == "0") {
+        config.is_maximized_frame = false;
+      } else if (str =="1") {
+        config.is_maximized_frame = true;
+      }
+    } else if (title == "units") {
+      if (content == "Metric") {
+        config.units = units::UnitSystem::kMetric;
+      } else if (content == "Imperial") {
+        config.units = units::UnitSystem::kImperial;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Unit system isn't recognized. Keeping default setting.";
+        wxLogWarning(message);
+      }
+    } else {
+      message = FileAndLineNumber(filepath, node)
+                + "XML node isn't recognized. Skipping.";
+      wxLogError(message);
+      status = false;
+    }
+
+    node = node->GetNext();
+  }
+
+  return status;
+}
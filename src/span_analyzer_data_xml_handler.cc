@@ -3,6 +3,7 @@
 
 #include "spananalyzer/span_analyzer_data_xml_handler.h"
 
+#include "appcommon/units/weather_load_case_unit_converter.h"
 #include "appcommon/xml/cable_constraint_xml_handler.h"
 #include "appcommon/xml/weather_load_case_xml_handler.h"
 #include "wx/filename.h"
@@ -10,102 +11,6 @@
 #include "spananalyzer/analysis_filter_xml_handler.h"
 #include "spananalyzer/file_handler.h"
 
-wxXmlNode* SpanAnalyzerDataXmlHandler::CreateNode(
-    const SpanAnalyzerData& data,
-    const units::UnitSystem& system_units,
-    const units::UnitStyle& style_units) {
-  // variables used to create XML node
-  wxXmlNode* node_root = nullptr;
-  wxXmlNode* node_element = nullptr;
-  std::string title;
-  std::string content;
-
-  // creates a node for the root
-  node_root = new wxXmlNode(wxXML_ELEMENT_NODE, "span_analyzer_data");
-  node_root->AddAttribute("version", "2");
-
-  if (system_units == units::UnitSystem::kImperial) {
-    node_root->AddAttribute("units", "Imperial");
-  } else if (system_units == units::UnitSystem::kMetric) {
-    node_root->AddAttribute("units", "Metric");
-  }
-
-  // adds child nodes for struct parameters
-
-  // creates cable directory node
-  title = "cables";
-  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
-
-  for (auto iter = data.cablefiles.cbegin(); iter != data.cablefiles.cend();
-       iter++) {
-    const CableFile* cablefile = *iter;
-    wxXmlNode* sub_node = CreateElementNodeWithContent("file",
-                                                       cablefile->filepath);
-    node_element->AddChild(sub_node);
-  }
-
-  node_root->AddChild(node_element);
-
-  // creates weathercase node
-  title = "weather_load_cases";
-  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
-
-  for (auto iter = data.weathercases.cbegin();
-       iter != data.weathercases.cend(); iter++) {
-    const WeatherLoadCase* weathercase = *iter;
-    wxXmlNode* sub_node =
-        WeatherLoadCaseXmlHandler::CreateNode(*weathercase, "", system_units,
-                                              style_units);
-    node_element->AddChild(sub_node);
-  }
-
-  node_root->AddChild(node_element);
-
-  // creates cable-constraints node
-  title = "cable_constraints";
-  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
-
-  for (auto iter = data.constraints.cbegin();
-       iter != data.constraints.cend(); iter++) {
-    const CableConstraint& constraint = *iter;
-    wxXmlNode* sub_node =
-        CableConstraintXmlHandler::CreateNode(constraint, "", system_units,
-                                              style_units);
-    node_element->AddChild(sub_node);
-  }
-
-  node_root->AddChild(node_element);
-
-  // creates analysis filter groups node
-  title = "analysis_filter_groups";
-  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
-
-  for (auto iter = data.groups_filters.cbegin();
-       iter != data.groups_filters.cend(); iter++ ) {
-    // gets filter group
-    const AnalysisFilterGroup& group = *iter;
-
-    // creates an analysis filter group node
-    wxXmlNode* sub_node = new wxXmlNode(wxXML_ELEMENT_NODE,
-                                        "analysis_filter_group");
-    sub_node->AddAttribute("name", group.name);
-
-    // adds analysis filter nodes to the group node
-    for (auto it = group.filters.cbegin();
-         it != group.filters.cend(); it++) {
-      const AnalysisFilter& filter = *it;
-      wxXmlNode* node_filter =
-          AnalysisFilterXmlHandler::CreateNode(filter, "");
-      sub_node->AddChild(node_filter);
-    }
-    node_element->AddChild(sub_node);
-  }
-  node_root->AddChild(node_element);
-
-  // returns node
-  return node_root;
-}
-
 bool SpanAnalyzerDataXmlHandler::ParseNode(const wxXmlNode* root,
                                            const std::string& filepath,
                                            const units::UnitSystem& units,
@@ -384,3 +289,88 @@ bool SpanAnalyzerDataXmlHandler::ParseNodeV2(const wxXmlNode* root,
 
   return status;
 }
+
+void SpanAnalyzerDataXmlHandler::WriteNode(
+    const SpanAnalyzerData& data,
+    const units::UnitSystem& system_units,
+    const units::UnitStyle& style_units,
+    XmlStreamWriter& writer) {
+  // writes the root
+  writer.StartElement("span_analyzer_data");
+  writer.AddAttribute("version", "2");
+
+  if (system_units == units::UnitSystem::kImperial) {
+    writer.AddAttribute("units", "Imperial");
+  } else if (system_units == units::UnitSystem::kMetric) {
+    writer.AddAttribute("units", "Metric");
+  }
+
+  // writes child nodes for struct parameters
+
+  // writes cable directory node
+  writer.StartElement("cables");
+  for (auto iter = data.cablefiles.cbegin(); iter != data.cablefiles.cend();
+       iter++) {
+    const CableFile* cablefile = *iter;
+    writer.WriteElement("file", cablefile->filepath);
+  }
+  writer.EndElement();
+
+  // writes weathercase node
+  // each weathercase node is generated by the common handler and released
+  // once written
+  writer.StartElement("weather_load_cases");
+  for (auto iter = data.weathercases.cbegin();
+       iter != data.weathercases.cend(); iter++) {
+    // copies and converts the weathercase to the requested unit style
+    WeatherLoadCase weathercase = **iter;
+    if (style_units == units::UnitStyle::kDifferent) {
+      WeatherLoadCaseUnitConverter::ConvertUnitStyleToDifferent(system_units,
+                                                                weathercase);
+    }
+
+    wxXmlNode* sub_node =
+        WeatherLoadCaseXmlHandler::CreateNode(weathercase, "", system_units,
+                                              style_units);
+    writer.WriteNode(sub_node);
+    delete sub_node;
+  }
+  writer.EndElement();
+
+  // writes cable-constraints node
+  writer.StartElement("cable_constraints");
+  for (auto iter = data.constraints.cbegin();
+       iter != data.constraints.cend(); iter++) {
+    const CableConstraint& constraint = *iter;
+    wxXmlNode* sub_node =
+        CableConstraintXmlHandler::CreateNode(constraint, "", system_units,
+                                              style_units);
+    writer.WriteNode(sub_node);
+    delete sub_node;
+  }
+  writer.EndElement();
+
+  // writes analysis filter groups node
+  writer.StartElement("analysis_filter_groups");
+  for (auto iter = data.groups_filters.cbegin();
+       iter != data.groups_filters.cend(); iter++) {
+    // gets filter group
+    const AnalysisFilterGroup& group = *iter;
+
+    // writes an analysis filter group node
+    writer.StartElement("analysis_filter_group");
+    writer.AddAttribute("name", group.name);
+
+    // writes analysis filter nodes to the group node
+    for (auto it = group.filters.cbegin();
+         it != group.filters.cend(); it++) {
+      const AnalysisFilter& filter = *it;
+      AnalysisFilterXmlHandler::WriteNode(filter, "", writer);
+    }
+    writer.EndElement();
+  }
+  writer.EndElement();
+
+  // ends the root
+  writer.EndElement();
+}
@@ -8,12 +8,21 @@
 #include "wx/xml/xml.h"
 
 #include "spananalyzer/span_analyzer_app.h"
+#include "spananalyzer/span_analyzer_doc_commands.h"
 #include "spananalyzer/span_analyzer_doc_xml_handler.h"
 #include "spananalyzer/span_unit_converter.h"
+#include "spananalyzer/xml_stream_writer.h"
 
 IMPLEMENT_DYNAMIC_CLASS(SpanAnalyzerDoc, wxDocument)
 
 SpanAnalyzerDoc::SpanAnalyzerDoc() {
+  count_batch_ = 0;
+  is_discarded_ = false;
+  is_pending_analysis_ = false;
+  is_silent_ = false;
+
+  // handles background save notifications
+  Bind(wxEVT_THREAD, &SpanAnalyzerDoc::OnSaveComplete, this);
 }
 
 SpanAnalyzerDoc::~SpanAnalyzerDoc() {
@@ -21,12 +30,17 @@ SpanAnalyzerDoc::~SpanAnalyzerDoc() {
 
 bool SpanAnalyzerDoc::AppendSpan(const Span& span) {
   spans_.push_back(span);
+  index_spans_.Add(span);
 
   Modify(true);
 
   return true;
 }
 
+void SpanAnalyzerDoc::BeginBatch() {
+  count_batch_++;
+}
+
 std::list<const CableConstraint*> SpanAnalyzerDoc::Constraints() const {
   std::list<const CableConstraint*> constraints_filtered;
 
@@ -108,10 +122,13 @@ bool SpanAnalyzerDoc::DeleteSpan(const int& index) {
 
   // deletes from span list
   auto iter = std::next(spans_.begin(), index);
+  const Span* span_deleted = &(*iter);
+  index_spans_.Remove(*iter);
   spans_.erase(iter);
 
-  // marks as modified
+  // marks as modified and records the edit
   Modify(true);
+  journal_.RecordDelete(index);
 
   // updates activated span index
   if (index == index_activated_) {
@@ -123,9 +140,53 @@ bool SpanAnalyzerDoc::DeleteSpan(const int& index) {
   // syncs controller
   SyncAnalysisController();
 
+  // invalidates any cached results for the deleted span
+  controller_analysis_.InvalidateResults(span_deleted);
+
   return true;
 }
 
+bool SpanAnalyzerDoc::DoSaveDocument(const wxString& file) {
+  FileSaveController* controller = wxGetApp().controller_save();
+  const units::UnitSystem units = wxGetApp().units_model();
+
+  // waits for any previous save, which may still remove a rotated journal
+  controller->Wait();
+  is_discarded_ = false;
+
+  // rotates the journal, and starts a new journal for the saved file
+  const std::string filepath_journal = journal_.Rotate();
+  journal_.Open(file.ToStdString(), units);
+
+  // captures the spans and writes them on a worker thread
+  // the file is replaced once it is completely written, so an interrupted save
+  // leaves the previous file intact
+  // the document is notified when the file is written
+  return controller->SaveDocument(file.ToStdString(), spans_, units,
+                                  filepath_journal, this);
+}
+
+void SpanAnalyzerDoc::EndBatch() {
+  if (count_batch_ == 0) {
+    return;
+  }
+
+  count_batch_--;
+  if ((IsBatching() == true) || (is_pending_analysis_ == false)) {
+    return;
+  }
+
+  // analyzes the activated span once for the entire batch
+  // cached results are restored if available
+  is_pending_analysis_ = false;
+  if (controller_analysis_.span() != nullptr) {
+    if (controller_analysis_.RestoreResults() == false) {
+      controller_analysis_.RunAnalysis();
+    }
+  }
+  UpdateFilterGroupConstraints();
+}
+
 const AnalysisFilterGroup* SpanAnalyzerDoc::FilterGroupConstraints() const {
   return &group_filters_constraint_;
 }
@@ -152,9 +213,11 @@ bool SpanAnalyzerDoc::InsertSpan(const int& index, const Span& span) {
   // inserts span
   auto iter = std::next(spans_.begin(), index);
   spans_.insert(iter, span);
+  index_spans_.Add(span);
 
-  // marks as modified
+  // marks as modified and records the edit
   Modify(true);
+  journal_.RecordInsert(index, span);
 
   // updates activated span index
   if (index < index_activated_) {
@@ -167,19 +230,20 @@ bool SpanAnalyzerDoc::InsertSpan(const int& index, const Span& span) {
   return true;
 }
 
-bool SpanAnalyzerDoc::IsUniqueName(const std::string& name) const {
-  // searches all spans for a match
-  for (auto iter = spans_.cbegin(); iter != spans_.cend(); iter++) {
-    const Span& span = *iter;
+bool SpanAnalyzerDoc::IsBatching() const {
+  return 0 < count_batch_;
+}
 
-    // compares and breaks if name is not unique
-    if (span.name == name) {
-      return false;
-    }
-  }
+bool SpanAnalyzerDoc::IsReferenced(const Cable* cable) const {
+  return 0 < index_spans_.CountReferences(cable);
+}
 
-  // if it makes it to this point, the name is unique
-  return true;
+bool SpanAnalyzerDoc::IsReferenced(const WeatherLoadCase* weathercase) const {
+  return 0 < index_spans_.CountReferences(weathercase);
+}
+
+bool SpanAnalyzerDoc::IsUniqueName(const std::string& name) const {
+  return index_spans_.ContainsName(name) == false;
 }
 
 bool SpanAnalyzerDoc::IsValidIndex(const int& index,
@@ -297,10 +361,10 @@ wxInputStream& SpanAnalyzerDoc::LoadObject(wxInputStream& stream) {
                    units::UnitStyle::kDifferent,
                    units::UnitStyle::kConsistent);
 
-  // converts unit systems if the file doesn't match applicaton config
-  units::UnitSystem units_config = wxGetApp().config()->units;
-  if (units_file != units_config) {
-    ConvertUnitSystem(units_file, units_config);
+  // converts unit systems if the file doesn't match the model
+  const units::UnitSystem units_model = wxGetApp().units_model();
+  if (units_file != units_model) {
+    ConvertUnitSystem(units_file, units_model);
   }
 
   // resets modified status to false because the xml parser uses functions
@@ -320,15 +384,25 @@ bool SpanAnalyzerDoc::ModifySpan(const int& index, const Span& span) {
 
   // modifies span in list
   auto iter = std::next(spans_.begin(), index);
+  index_spans_.Remove(*iter);
   *iter = Span(span);
+  index_spans_.Add(*iter);
 
-  // sets document flag as modified
+  // sets document flag as modified and records the edit
   Modify(true);
+  journal_.RecordModify(index, span);
 
-  // runs analysis if necessary
-  if (index == index_activated_) {
+  // runs analysis if necessary, otherwise invalidates any cached results
+  // in a batch, the stale results are cleared so they can't be cached, and the
+  // analysis is deferred until the batch ends
+  if ((index == index_activated_) && (IsBatching() == true)) {
+    controller_analysis_.ClearResults();
+    is_pending_analysis_ = true;
+  } else if (index == index_activated_) {
     controller_analysis_.RunAnalysis();
     UpdateFilterGroupConstraints();
+  } else {
+    controller_analysis_.InvalidateResults(&(*iter));
   }
 
   return true;
@@ -356,8 +430,9 @@ bool SpanAnalyzerDoc::MoveSpan(const int& index_from, const int& index_to) {
 
   spans_.splice(iter_to, spans_, iter_from);
 
-  // marks as modified
+  // marks as modified and records the edit
   Modify(true);
+  journal_.RecordMove(index_from, index_to);
 
   // updates activated index
   if (index_activated_ != -1) {
@@ -370,12 +445,36 @@ bool SpanAnalyzerDoc::MoveSpan(const int& index_from, const int& index_to) {
   return true;
 }
 
+bool SpanAnalyzerDoc::OnCloseDocument() {
+  // waits for any running save, so a rotated journal isn't left behind
+  wxGetApp().controller_save()->Wait();
+
+  // removes the journals if the changes were saved or discarded by the user
+  // a rotated journal is only left if a save failed, in which case the
+  // journals have the only copy of the edits
+  const bool is_removed = (is_discarded_ == true)
+                          || (journal_.IsRotated() == false);
+  journal_.Close(is_removed);
+
+  return wxDocument::OnCloseDocument();
+}
+
+wxCommandProcessor* SpanAnalyzerDoc::OnCreateCommandProcessor() {
+  return new SpanCommandProcessor(wxGetApp().config()->size_memory_undo);
+}
+
 bool SpanAnalyzerDoc::OnCreate(const wxString& path, long flags) {
   // initializes activated span
   index_activated_ = -1;
 
+  // a silently created document never shows dialogs
+  is_silent_ = (flags & wxDOC_SILENT) != 0;
+
   // initializes analysis controller
   controller_analysis_.set_weathercases(&wxGetApp().data()->weathercases);
+  set_options_cache_results(wxGetApp().config()->options_cache_results);
+  set_options_surrogate(wxGetApp().config()->options_surrogate);
+  set_options_threads(wxGetApp().OptionsThreads());
 
   // initializes base structure
   StructureAttachment attachment;
@@ -394,6 +493,18 @@ bool SpanAnalyzerDoc::OnCreate(const wxString& path, long flags) {
   hardware_.type = Hardware::HardwareType::kDeadEnd;
   hardware_.weight = 0;
 
+  // initializes suspension insulator in the model unit system
+  hardware_suspension_.name = "";
+  hardware_suspension_.area_cross_section = 0;
+  hardware_suspension_.type = Hardware::HardwareType::kSuspension;
+  if (wxGetApp().units_model() == units::UnitSystem::kMetric) {
+    hardware_suspension_.length = 1.5;
+    hardware_suspension_.weight = 450;
+  } else {
+    hardware_suspension_.length = 5;
+    hardware_suspension_.weight = 100;
+  }
+
   // initializes line structures
   LineStructure line_structure;
   line_structure.set_height_adjustment(0);
@@ -415,18 +526,84 @@ bool SpanAnalyzerDoc::OnCreate(const wxString& path, long flags) {
   return wxDocument::OnCreate(path, flags);
 }
 
-const SagTensionAnalysisResult* SpanAnalyzerDoc::Result(
-    const int& index_weathercase,
-    const CableConditionType& condition) const {
-  return controller_analysis_.Result(index_weathercase, condition);
+bool SpanAnalyzerDoc::OnOpenDocument(const wxString& filename) {
+  // loads the last saved file
+  if (wxDocument::OnOpenDocument(filename) == false) {
+    return false;
+  }
+
+  const std::string filepath = filename.ToStdString();
+  const units::UnitSystem units = wxGetApp().units_model();
+
+  // checks for edits that weren't saved
+  // a silent or headless open can't prompt the user, so the journal is left
+  // untouched for an interactive session and edits aren't recorded
+  if ((DocumentJournal::Exists(filepath) == true)
+      && ((is_silent_ == true) || (wxGetApp().IsHeadless() == true))) {
+    std::string message = filepath + "  --  "
+                          "Document has unsaved edits from a previous session, "
+                          "which weren't recovered.";
+    wxLogWarning(message.c_str());
+    return true;
+  } else if (DocumentJournal::Exists(filepath) == true) {
+    std::string message = filepath + "  --  "
+                          "This document has unsaved edits from a previous "
+                          "session. Recover the edits?";
+    const int status_dialog = wxMessageBox(message, "Recover Document",
+                                           wxYES_NO | wxICON_QUESTION);
+    if (status_dialog == wxYES) {
+      // replays the journal onto the saved file
+      // the journal isn't open, so the replayed edits aren't recorded again
+      const int count = DocumentJournal::Replay(filepath, units,
+                                                *wxGetApp().data(), *this);
+      if (count == -1) {
+        message = filepath + "  --  "
+                  "Not all edits could be recovered. Check logs.";
+        wxMessageBox(message);
+      } else {
+        message = "Recovered " + std::to_string(count) + " edit(s).";
+        wxLogVerbose(message.c_str());
+      }
+
+      // marks as modified, as the recovered edits aren't saved yet
+      Modify(true);
+      UpdateAllViews();
+    } else {
+      DocumentJournal::Remove(filepath);
+    }
+  }
+
+  // starts recording edits
+  // recovered edits are kept in the journal until the document is saved
+  journal_.Open(filepath, units);
+
+  return true;
+}
+
+bool SpanAnalyzerDoc::OnSaveModified() {
+  // the flag is cleared if the user saves instead of discarding
+  is_discarded_ = IsModified();
+  if (wxDocument::OnSaveModified() == false) {
+    is_discarded_ = false;
+    return false;
+  }
+
+  return true;
+}
+
+bool SpanAnalyzerDoc::Result(const int& index_weathercase,
+                             const CableConditionType& condition,
+                             SagTensionAnalysisResult& result) const {
+  return controller_analysis_.Result(index_weathercase, condition, result);
 }
 
-const std::vector<SagTensionAnalysisResult>* SpanAnalyzerDoc::Results(
-    const CableConditionType& condition) const {
-  return controller_analysis_.Results(condition);
+const SagTensionResultStore* SpanAnalyzerDoc::Results() const {
+  return controller_analysis_.results();
 }
 
 void SpanAnalyzerDoc::RunAnalysis() const {
+  // the application data may have changed, so cached results are discarded
+  controller_analysis_.ClearCache();
   controller_analysis_.RunAnalysis();
 }
 
@@ -438,42 +615,78 @@ wxOutputStream& SpanAnalyzerDoc::SaveObject(wxOutputStream& stream) {
   wxLogVerbose(message.c_str());
   status_bar_log::PushText(message, 0);
 
-  // gets the unit system from app config
-  units::UnitSystem units = wxGetApp().config()->units;
+  // gets the model unit system, which the document is kept in
+  units::UnitSystem units = wxGetApp().units_model();
 
-  // converts to a different unit style for saving
-  ConvertUnitStyle(units, units::UnitStyle::kConsistent,
-                   units::UnitStyle::kDifferent);
+  // streams the xml
+  // the spans are converted to a different unit style as they are written
+  XmlStreamWriter writer(stream);
+  writer.StartDocument();
+  SpanAnalyzerDocXmlHandler::WriteNode(spans_, units, writer);
+  if (writer.EndDocument() == false) {
+    wxLogError("File didn't save");
+  }
 
-  // disconnects activated line cable
-  DisconnectLineCableActivated();
+  status_bar_log::PopText(0);
 
-  // generates an xml node
-  wxXmlNode* root = SpanAnalyzerDocXmlHandler::CreateNode(*this, units);
+  return stream;
+}
 
-  // creates an XML document and saves to stream
-  wxXmlDocument doc_xml;
-  doc_xml.SetRoot(root);
-  doc_xml.Save(stream);
+const Span* SpanAnalyzerDoc::SpanActivated() const {
+  return controller_analysis_.span();
+}
 
-  // connects activated line cable
-  ConnectLineCableActivated();
+std::vector<const Span*> SpanAnalyzerDoc::SpansLineSection() const {
+  std::vector<const Span*> spans_section;
+  if (index_activated_ == -1) {
+    return spans_section;
+  }
 
-  // converts back to a consistent unit style
-  ConvertUnitStyle(units, units::UnitStyle::kDifferent,
-                   units::UnitStyle::kConsistent);
+  auto iter_activated = std::next(spans_.cbegin(), index_activated_);
+  const Span& span_activated = *iter_activated;
+  if (span_activated.type != Span::Type::kRulingSpan) {
+    spans_section.push_back(&span_activated);
+    return spans_section;
+  }
 
-  // clears commands in the processor
-  wxCommandProcessor* processor = GetCommandProcessor();
-  processor->ClearCommands();
+  // searches back and ahead for ruling spans with an identical line cable
+  const std::string fingerprint =
+      AnalysisController::Fingerprint(span_activated.linecable);
 
-  status_bar_log::PopText(0);
+  auto iter_begin = iter_activated;
+  while (iter_begin != spans_.cbegin()) {
+    const Span& span = *std::prev(iter_begin);
+    if ((span.type != Span::Type::kRulingSpan)
+        || (AnalysisController::Fingerprint(span.linecable) != fingerprint)) {
+      break;
+    }
+    iter_begin--;
+  }
 
-  return stream;
+  auto iter_end = std::next(iter_activated);
+  while (iter_end != spans_.cend()) {
+    const Span& span = *iter_end;
+    if ((span.type != Span::Type::kRulingSpan)
+        || (AnalysisController::Fingerprint(span.linecable) != fingerprint)) {
+      break;
+    }
+    iter_end++;
+  }
+
+  for (auto iter = iter_begin; iter != iter_end; iter++) {
+    spans_section.push_back(&(*iter));
+  }
+
+  return spans_section;
 }
 
-const Span* SpanAnalyzerDoc::SpanActivated() const {
-  return controller_analysis_.span();
+bool SpanAnalyzerDoc::SolveTemperatureSweep(
+    const WeatherLoadCase& weathercase,
+    const CableConditionType& condition,
+    const std::vector<double>& temperatures,
+    TemperatureSweepResult& result) const {
+  return controller_analysis_.SolveTemperatureSweep(weathercase, condition,
+                                                    temperatures, result);
 }
 
 const CableStretchState* SpanAnalyzerDoc::StretchState(
@@ -481,6 +694,14 @@ const CableStretchState* SpanAnalyzerDoc::StretchState(
   return controller_analysis_.StretchState(condition);
 }
 
+CableModelCache* SpanAnalyzerDoc::cache_models() const {
+  return controller_analysis_.cache_models();
+}
+
+const Hardware* SpanAnalyzerDoc::hardware_suspension() const {
+  return &hardware_suspension_;
+}
+
 int SpanAnalyzerDoc::index_activated() const {
   return index_activated_;
 }
@@ -513,6 +734,41 @@ bool SpanAnalyzerDoc::set_index_activated(const int& index) {
   return true;
 }
 
+int SpanAnalyzerDoc::max_threads_analysis() const {
+  return controller_analysis_.max_threads();
+}
+
+void SpanAnalyzerDoc::set_max_threads_analysis(const int& max_threads) {
+  controller_analysis_.set_max_threads(max_threads);
+}
+
+void SpanAnalyzerDoc::set_options_cache_results(
+    const ResultCacheOptions& options) {
+  controller_analysis_.set_is_spilling_cache(options.is_spilling);
+  controller_analysis_.set_size_budget_cache(
+      static_cast<long>(options.size_memory) * 1024 * 1024);
+}
+
+void SpanAnalyzerDoc::set_options_surrogate(
+    const SurrogateOptions& options) {
+  controller_analysis_.set_is_surrogate(options.is_enabled);
+  controller_analysis_.set_tolerance_surrogate(options.tolerance);
+}
+
+void SpanAnalyzerDoc::set_options_threads(const ThreadOptions& options) {
+  controller_analysis_.set_is_background(options.is_background);
+  controller_analysis_.set_is_pinned(options.is_pinned);
+  controller_analysis_.set_max_threads(options.max_threads);
+}
+
+void SpanAnalyzerDoc::set_size_memory_undo(const int& size_memory) {
+  SpanCommandProcessor* processor =
+      dynamic_cast<SpanCommandProcessor*>(GetCommandProcessor());
+  if (processor != nullptr) {
+    processor->set_size_memory(size_memory);
+  }
+}
+
 const std::list<Span>& SpanAnalyzerDoc::spans() const {
   return spans_;
 }
@@ -542,6 +798,24 @@ void SpanAnalyzerDoc::DisconnectLineCableActivated() {
   }
 }
 
+void SpanAnalyzerDoc::OnSaveComplete(wxThreadEvent& event) {
+  if (event.GetInt() != 0) {
+    return;
+  }
+
+  // marks as modified, as the file doesn't have the edits
+  // wxWidgets marked the document as saved when the save was started, so
+  // closing the document would otherwise lose the edits without a prompt
+  Modify(true);
+
+  // shows the error, which is already logged by the save thread
+  if (wxGetApp().IsHeadless() == false) {
+    std::string message = event.GetString().ToStdString() + "  --  "
+                          "Document couldn't be saved. Check logs.";
+    wxMessageBox(message, "Save Error", wxOK | wxICON_ERROR);
+  }
+}
+
 void SpanAnalyzerDoc::SyncAnalysisController() {
   // exits if no span is activated
   if (index_activated_ == -1) {
@@ -554,9 +828,21 @@ void SpanAnalyzerDoc::SyncAnalysisController() {
   const Span* span = &(*std::next(spans_.cbegin(), index_activated_));
 
   // forces controller to update if spans don't match
+  // cached results are restored if available
   if (span != controller_analysis_.span()) {
     controller_analysis_.set_span(span);
-    controller_analysis_.RunAnalysis();
+
+    // defers the analysis until the batch ends
+    // the previous results are cleared so they aren't cached for this span
+    if (IsBatching() == true) {
+      controller_analysis_.ClearResults();
+      is_pending_analysis_ = true;
+      return;
+    }
+
+    if (controller_analysis_.RestoreResults() == false) {
+      controller_analysis_.RunAnalysis();
+    }
     UpdateFilterGroupConstraints();
   }
 }
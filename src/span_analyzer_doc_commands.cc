@@ -3,11 +3,125 @@
 
 #include "spananalyzer/span_analyzer_doc_commands.h"
 
+#include <algorithm>
+
 #include "wx/wx.h"
 
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_doc.h"
-#include "spananalyzer/span_xml_handler.h"
+
+SpanState::SpanState() {
+}
+
+void SpanState::Capture(const Span& span) {
+  // copies span and removes connections
+  span_ = span;
+  span_.linecable.ClearConnections();
+
+  // captures reference names, which are used if a handle becomes invalid
+  const LineCable& linecable = span_.linecable;
+
+  name_cable_.clear();
+  if (linecable.cable() != nullptr) {
+    name_cable_ = linecable.cable()->name;
+  }
+
+  description_constraint_.clear();
+  if (linecable.constraint().case_weather != nullptr) {
+    description_constraint_ = linecable.constraint().case_weather->description;
+  }
+
+  description_creep_.clear();
+  if (linecable.weathercase_stretch_creep() != nullptr) {
+    description_creep_ = linecable.weathercase_stretch_creep()->description;
+  }
+
+  description_load_.clear();
+  if (linecable.weathercase_stretch_load() != nullptr) {
+    description_load_ = linecable.weathercase_stretch_load()->description;
+  }
+}
+
+bool SpanState::Restore(const DataIndex& index, Span& span) const {
+  bool status = true;
+
+  // copies span
+  span = span_;
+  LineCable& linecable = span.linecable;
+
+  // resolves cable
+  const Cable* cable = ResolveCable(index, linecable.cable(), name_cable_);
+  if ((cable == nullptr) && (linecable.cable() != nullptr)) {
+    status = false;
+  }
+  linecable.set_cable(cable);
+
+  // resolves weathercases
+  CableConstraint constraint = linecable.constraint();
+  const WeatherLoadCase* weathercase = ResolveWeathercase(
+      index, constraint.case_weather, description_constraint_);
+  if ((weathercase == nullptr) && (constraint.case_weather != nullptr)) {
+    status = false;
+  }
+  constraint.case_weather = weathercase;
+  linecable.set_constraint(constraint);
+
+  weathercase = ResolveWeathercase(index, linecable.weathercase_stretch_creep(),
+                                   description_creep_);
+  if ((weathercase == nullptr)
+      && (linecable.weathercase_stretch_creep() != nullptr)) {
+    status = false;
+  }
+  linecable.set_weathercase_stretch_creep(weathercase);
+
+  weathercase = ResolveWeathercase(index, linecable.weathercase_stretch_load(),
+                                   description_load_);
+  if ((weathercase == nullptr)
+      && (linecable.weathercase_stretch_load() != nullptr)) {
+    status = false;
+  }
+  linecable.set_weathercase_stretch_load(weathercase);
+
+  if (status == false) {
+    std::string message = span.name + "  --  "
+                          "Span references a cable or weathercase that no "
+                          "longer exists.";
+    wxLogError(message.c_str());
+  }
+
+  return status;
+}
+
+size_t SpanState::Size() const {
+  return sizeof(SpanState)
+      + description_constraint_.capacity()
+      + description_creep_.capacity()
+      + description_load_.capacity()
+      + name_cable_.capacity()
+      + span_.name.capacity()
+      + span_.profile.capacity() * sizeof(ProfilePoint);
+}
+
+const Cable* SpanState::ResolveCable(const DataIndex& index,
+                                     const Cable* cable,
+                                     const std::string& name) {
+  if (cable == nullptr) {
+    return nullptr;
+  }
+
+  return index.FindCable(name);
+}
+
+const WeatherLoadCase* SpanState::ResolveWeathercase(
+    const DataIndex& index,
+    const WeatherLoadCase* weathercase,
+    const std::string& description) {
+  if (weathercase == nullptr) {
+    return nullptr;
+  }
+
+  return index.FindWeathercase(description);
+}
 
 // These are the string definitions for the various command types.
 const std::string SpanCommand::kNameDelete = "Delete Span";
@@ -20,77 +134,44 @@ SpanCommand::SpanCommand(const std::string& name)
     : wxCommand(true, name) {
   doc_ = wxGetApp().GetDocument();
   index_ = -1;
-  node_do_ = nullptr;
-  node_undo_ = nullptr;
 }
 
 SpanCommand::~SpanCommand() {
-  delete node_do_;
-  delete node_undo_;
-}
-
-bool SpanCommand::CreateSpanFromXml(const wxXmlNode* node, Span& span) {
-  // clears span
-  span = Span();
-
-  // gets application data
-  const SpanAnalyzerData* data = wxGetApp().data();
-
-  // parses node into span
-  const bool status_node = SpanXmlHandler::ParseNode(node, "",
-                                                     units::UnitSystem::kNull,
-                                                     false,
-                                                     &data->cablefiles,
-                                                     &data->weathercases,
-                                                     span);
-  if (status_node == false) {
-    wxString message =
-        SpanXmlHandler::FileAndLineNumber("", node)
-        + "Invalid span. Skipping.";
-    wxLogError(message);
-  }
-
-  return status_node;
 }
 
 bool SpanCommand::Do() {
   bool status = false;
   UpdateHint hint(UpdateHint::Type::kSpansEdit);
 
-  // clears undo node so it's ready to cache the existing state
-  if (node_undo_ != nullptr) {
-    delete node_undo_;
-  }
-
   // selects based on command name
   const std::string name = GetName();
   if (name == kNameDelete) {
-    // caches span to xml and then does command
+    // caches span and then does command
     if (doc_->IsValidIndex(index_, false) == false) {
       wxLogError("Invalid span index. Aborting command.");
       return false;
     }
     const Span& span = *std::next(doc_->spans().cbegin(), index_);
-    node_undo_ = SaveSpanToXml(span);
+    state_undo_.Capture(span);
     status = DoDelete();
 
     // sets update hint
     hint.set_name_command(SpanCommand::kNameDelete);
   } else if (name == kNameInsert) {
     // does command
-    status = DoInsert(node_do_);
+    status = DoInsert(state_do_);
 
     // sets update hint
     hint.set_name_command(SpanCommand::kNameInsert);
   } else if (name == kNameModify) {
-    // caches span to xml and then does command
+    // caches span and then does command
     if (doc_->IsValidIndex(index_, false) == false) {
       wxLogError("Invalid span index. Aborting command.");
       return false;
     }
     const Span& span = *std::next(doc_->spans().cbegin(), index_);
-    node_undo_ = SaveSpanToXml(span);
-    status = DoModify(node_do_);
+    state_undo_.Capture(span);
+    status = DoModify(state_do_);
 
     // sets update hint
     hint.set_name_command(SpanCommand::kNameModify);
@@ -114,11 +195,12 @@ bool SpanCommand::Do() {
   }
 
   // checks if command succeeded
-  if (status == true) {
+  // a batch posts its own view update
+  if ((status == true) && (doc_->IsBatching() == false)) {
     // posts a view update
     hint.set_index_span(index_);
     doc_->UpdateAllViews(nullptr, &hint);
-  } else {
+  } else if (status == false) {
     // logs error
     wxLogError("Do command failed.");
   }
@@ -126,15 +208,8 @@ bool SpanCommand::Do() {
   return status;
 }
 
-wxXmlNode* SpanCommand::SaveSpanToXml(const Span& span) {
-  // copies span and removes connections
-  Span span_modified = span;
-  span_modified.linecable.ClearConnections();
-
-  // gets unit system and returns xml node
-  units::UnitSystem units = wxGetApp().config()->units;
-  return SpanXmlHandler::CreateNode(span_modified, "", units,
-                                    units::UnitStyle::kConsistent);;
+size_t SpanCommand::Size() const {
+  return sizeof(SpanCommand) + state_do_.Size() + state_undo_.Size();
 }
 
 bool SpanCommand::Undo() {
@@ -144,13 +219,13 @@ bool SpanCommand::Undo() {
   // selects based on command name
   const std::string name = GetName();
   if (name == kNameDelete) {
-    status = DoInsert(node_undo_);
+    status = DoInsert(state_undo_);
     hint.set_name_command(SpanCommand::kNameInsert);
   } else if (name == kNameInsert) {
     status = DoDelete();
     hint.set_name_command(SpanCommand::kNameDelete);
   } else if (name == kNameModify) {
-    status = DoModify(node_undo_);
+    status = DoModify(state_undo_);
     hint.set_name_command(SpanCommand::kNameModify);
   } else if (name == kNameMoveDown) {
     status = DoMoveUp();
@@ -166,11 +241,12 @@ bool SpanCommand::Undo() {
   }
 
   // checks if command succeeded
-  if (status == true) {
+  // a batch posts its own view update
+  if ((status == true) && (doc_->IsBatching() == false)) {
     // posts a view update
     hint.set_index_span(index_);
     doc_->UpdateAllViews(nullptr, &hint);
-  } else {
+  } else if (status == false) {
     // logs error
     wxLogError("Undo command failed.");
   }
@@ -182,16 +258,12 @@ int SpanCommand::index() const {
   return index_;
 }
 
-const wxXmlNode* SpanCommand::node_span() const {
-  return node_do_;
-}
-
 void SpanCommand::set_index(const int& index) {
   index_ = index;
 }
 
-void SpanCommand::set_node_span(const wxXmlNode* node_span) {
-  node_do_ = node_span;
+void SpanCommand::set_span(const Span& span) {
+  state_do_.Capture(span);
 }
 
 bool SpanCommand::DoDelete() {
@@ -210,16 +282,19 @@ bool SpanCommand::DoDelete() {
   return doc_->DeleteSpan(index_);
 }
 
-bool SpanCommand::DoInsert(const wxXmlNode* node) {
+bool SpanCommand::DoInsert(const SpanState& state) {
   // checks index
   if (doc_->IsValidIndex(index_, true) == false) {
     wxLogError("Invalid index. Aborting insert command.");
     return false;
   }
 
-  // builds span from xml node
+  // restores span with valid references to the application data
   Span span;
-  CreateSpanFromXml(node, span);
+  bool status = state.Restore(*wxGetApp().index_data(), span);
+  if (status == false) {
+    return false;
+  }
 
   // logs
   std::string message = "Inserting span at index " + std::to_string(index_)
@@ -230,16 +305,16 @@ bool SpanCommand::DoInsert(const wxXmlNode* node) {
   return doc_->InsertSpan(index_, span);
 }
 
-bool SpanCommand::DoModify(const wxXmlNode* node) {
+bool SpanCommand::DoModify(const SpanState& state) {
   // checks index
   if (doc_->IsValidIndex(index_, false) == false) {
     wxLogError("Invalid index. Aborting modify command.");
     return false;
   }
 
-  // builds span from xml node
+  // restores span with valid references to the application data
   Span span;
-  bool status = CreateSpanFromXml(node, span);
+  bool status = state.Restore(*wxGetApp().index_data(), span);
   if (status == false) {
     return false;
   }
@@ -297,3 +372,210 @@ bool SpanCommand::DoMoveUp() {
 
   return status;
 }
+
+SpanBatchCommand::SpanBatchCommand(const std::string& name)
+    : wxCommand(true, name) {
+  doc_ = wxGetApp().GetDocument();
+}
+
+SpanBatchCommand::~SpanBatchCommand() {
+  for (auto iter = commands_.begin(); iter != commands_.end(); iter++) {
+    delete *iter;
+  }
+}
+
+void SpanBatchCommand::Add(SpanCommand* command) {
+  commands_.push_back(command);
+}
+
+bool SpanBatchCommand::Do() {
+  if (commands_.empty() == true) {
+    return false;
+  }
+
+  doc_->BeginBatch();
+
+  // does commands in order
+  bool status = true;
+  auto iter = commands_.begin();
+  for (; iter != commands_.end(); iter++) {
+    SpanCommand* command = *iter;
+    if (command->Do() == false) {
+      status = false;
+      break;
+    }
+  }
+
+  // reverts any commands that were applied before the failure
+  if (status == false) {
+    while (iter != commands_.begin()) {
+      iter--;
+      SpanCommand* command = *iter;
+      command->Undo();
+    }
+  }
+
+  doc_->EndBatch();
+
+  if (status == true) {
+    UpdateViews();
+  } else {
+    wxLogError("Batch command failed. No spans were changed.");
+  }
+
+  return status;
+}
+
+bool SpanBatchCommand::IsEmpty() const {
+  return commands_.empty();
+}
+
+size_t SpanBatchCommand::Size() const {
+  size_t size = sizeof(SpanBatchCommand);
+  for (auto iter = commands_.cbegin(); iter != commands_.cend(); iter++) {
+    const SpanCommand* command = *iter;
+    size += command->Size();
+  }
+
+  return size;
+}
+
+bool SpanBatchCommand::Undo() {
+  if (commands_.empty() == true) {
+    return false;
+  }
+
+  doc_->BeginBatch();
+
+  // undoes commands in reverse order
+  bool status = true;
+  auto iter = commands_.rbegin();
+  for (; iter != commands_.rend(); iter++) {
+    SpanCommand* command = *iter;
+    if (command->Undo() == false) {
+      status = false;
+      break;
+    }
+  }
+
+  // re-applies any commands that were undone before the failure
+  if (status == false) {
+    while (iter != commands_.rbegin()) {
+      iter--;
+      SpanCommand* command = *iter;
+      command->Do();
+    }
+  }
+
+  doc_->EndBatch();
+
+  if (status == true) {
+    UpdateViews();
+  } else {
+    wxLogError("Batch undo command failed. No spans were changed.");
+  }
+
+  return status;
+}
+
+void SpanBatchCommand::UpdateViews() {
+  // an empty command name rebuilds the span list
+  UpdateHint hint(UpdateHint::Type::kSpansEdit);
+  doc_->UpdateAllViews(nullptr, &hint);
+}
+
+SpanCommandProcessor::SpanCommandProcessor(const int& size_memory) {
+  size_commands_ = 0;
+  set_size_memory(size_memory);
+}
+
+void SpanCommandProcessor::ClearCommands() {
+  wxCommandProcessor::ClearCommands();
+
+  size_commands_ = 0;
+  sizes_.clear();
+}
+
+size_t SpanCommandProcessor::SizeCommands() const {
+  return size_commands_;
+}
+
+void SpanCommandProcessor::Store(wxCommand* command) {
+  // discards the redo commands so their sizes are removed from the total
+  // if everything has been undone, the base class clears all commands
+  DiscardRedo();
+  wxCommandProcessor::Store(command);
+
+  // records the command size
+  const size_t size = SizeCommand(command);
+  sizes_[command] = size;
+  size_commands_ += size;
+
+  Trim();
+}
+
+void SpanCommandProcessor::set_size_memory(const int& size_memory) {
+  size_memory_ = static_cast<size_t>(std::max(size_memory, 0)) * 1024 * 1024;
+  Trim();
+}
+
+void SpanCommandProcessor::DiscardRedo() {
+  if (!m_currentCommand) {
+    return;
+  }
+
+  auto node = m_currentCommand->GetNext();
+  while (node) {
+    auto next = node->GetNext();
+
+    wxCommand* command = static_cast<wxCommand*>(node->GetData());
+    auto iter = sizes_.find(command);
+    if (iter != sizes_.end()) {
+      size_commands_ -= iter->second;
+      sizes_.erase(iter);
+    }
+
+    delete command;
+    m_commands.Erase(node);
+
+    node = next;
+  }
+}
+
+size_t SpanCommandProcessor::SizeCommand(const wxCommand* command) {
+  const SpanCommand* command_span = dynamic_cast<const SpanCommand*>(command);
+  if (command_span != nullptr) {
+    return command_span->Size();
+  }
+
+  const SpanBatchCommand* command_batch =
+      dynamic_cast<const SpanBatchCommand*>(command);
+  if (command_batch != nullptr) {
+    return command_batch->Size();
+  }
+
+  return sizeof(wxCommand);
+}
+
+void SpanCommandProcessor::Trim() {
+  while ((size_memory_ < size_commands_) && (1 < m_commands.GetCount())) {
+    // the current command can't be discarded
+    auto node = m_commands.GetFirst();
+    if (node == m_currentCommand) {
+      break;
+    }
+
+    // discards the oldest command
+    wxCommand* command = static_cast<wxCommand*>(node->GetData());
+    auto iter = sizes_.find(command);
+    if (iter != sizes_.end()) {
+      size_commands_ -= iter->second;
+      sizes_.erase(iter);
+    }
+
+    delete command;
+    m_commands.Erase(node);
+  }
+
+  SetMenuStrings();
+}
@@ -3,44 +3,38 @@
 
 #include "spananalyzer/span_analyzer_doc_xml_handler.h"
 
+#include "spananalyzer/span_unit_converter.h"
 #include "spananalyzer/span_xml_handler.h"
 
-wxXmlNode* SpanAnalyzerDocXmlHandler::CreateNode(
-    const SpanAnalyzerDoc& doc,
-    const units::UnitSystem& units) {
-  // initializes variables used to create XML node
-  wxXmlNode* node_root = nullptr;
-  wxXmlNode* node_element = nullptr;
-  std::string title;
-  std::string content;
-
-  // creates a node for the root
-  node_root = new wxXmlNode(wxXML_ELEMENT_NODE, "span_analyzer_doc");
-  node_root->AddAttribute("version", "2");
-
-  if (units == units::UnitSystem::kImperial) {
-    node_root->AddAttribute("units", "Imperial");
-  } else if (units == units::UnitSystem::kMetric) {
-    node_root->AddAttribute("units", "Metric");
+int SpanAnalyzerDocXmlHandler::CountSpans(const wxXmlNode* root) {
+  // checks for valid root node and version
+  if (root->GetName() != "span_analyzer_doc") {
+    return -1;
   }
 
-  // adds child nodes for parameters
+  const int kVersion = Version(root);
+  if ((kVersion != 1) && (kVersion != 2)) {
+    return -1;
+  }
 
-  // creates spans node
-  title = "spans";
-  node_element = new wxXmlNode(wxXML_ELEMENT_NODE, title);
-  const std::list<Span>& spans = doc.spans();
-  for (auto iter = spans.cbegin(); iter != spans.cend(); iter++) {
-    const Span& span = *iter;
+  // counts the span nodes
+  int count = 0;
+  const wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    if (node->GetName() == "spans") {
+      const wxXmlNode* sub_node = node->GetChildren();
+      while (sub_node != nullptr) {
+        if (sub_node->GetName() == "span") {
+          count++;
+        }
+        sub_node = sub_node->GetNext();
+      }
+    }
 
-    // creates span node and adds to root
-    node_element->AddChild(SpanXmlHandler::CreateNode(
-        span, "", units, units::UnitStyle::kDifferent));
+    node = node->GetNext();
   }
-  node_root->AddChild(node_element);
 
-  // returns node
-  return node_root;
+  return count;
 }
 
 bool SpanAnalyzerDocXmlHandler::ParseNode(
@@ -152,3 +146,91 @@ bool SpanAnalyzerDocXmlHandler::ParseNodeV2(
   return ParseNodeV1(root, filepath, units, convert, cablefiles, weathercases,
                      doc);
 }
+
+bool SpanAnalyzerDocXmlHandler::ParseSpans(
+    const wxXmlNode* root,
+    const std::string& filepath,
+    const units::UnitSystem& units,
+    const bool& convert,
+    const std::list<CableFile*>* cablefiles,
+    const std::list<WeatherLoadCase*>* weathercases,
+    const int& index_begin,
+    const int& index_end,
+    std::list<Span>& spans) {
+  wxString message;
+
+  // checks for valid root node and version
+  // all versions have the same span nodes
+  if (CountSpans(root) == -1) {
+    message = FileAndLineNumber(filepath, root) +
+              " Invalid root node or version. Aborting node parse.";
+    wxLogError(message);
+    return false;
+  }
+
+  // parses the span xml nodes within the range
+  bool status = true;
+  int index = 0;
+  const wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    if (node->GetName() == "spans") {
+      const wxXmlNode* sub_node = node->GetChildren();
+      while ((sub_node != nullptr) && (index < index_end)) {
+        if (sub_node->GetName() == "span") {
+          if (index_begin <= index) {
+            Span span;
+            const bool status_node = SpanXmlHandler::ParseNode(
+                sub_node, filepath, units, convert, cablefiles, weathercases,
+                span);
+            if (status_node == false) {
+              status = false;
+            }
+
+            spans.push_back(span);
+          }
+
+          index++;
+        }
+        sub_node = sub_node->GetNext();
+      }
+    }
+
+    node = node->GetNext();
+  }
+
+  return status;
+}
+
+void SpanAnalyzerDocXmlHandler::WriteNode(const std::list<Span>& spans,
+                                          const units::UnitSystem& units,
+                                          XmlStreamWriter& writer) {
+  // writes the root
+  writer.StartElement("span_analyzer_doc");
+  writer.AddAttribute("version", "2");
+
+  if (units == units::UnitSystem::kImperial) {
+    writer.AddAttribute("units", "Imperial");
+  } else if (units == units::UnitSystem::kMetric) {
+    writer.AddAttribute("units", "Metric");
+  }
+
+  // writes child nodes for parameters
+
+  // writes spans node
+  writer.StartElement("spans");
+  for (auto iter = spans.cbegin(); iter != spans.cend(); iter++) {
+    // copies the span, removes connections, and converts to a 'different'
+    // unit style
+    Span span = *iter;
+    span.linecable.ClearConnections();
+    SpanUnitConverter::ConvertUnitStyleToDifferent(units, true, span);
+
+    // writes span node
+    SpanXmlHandler::WriteNode(span, "", units, units::UnitStyle::kDifferent,
+                              writer);
+  }
+  writer.EndElement();
+
+  // ends the root
+  writer.EndElement();
+}
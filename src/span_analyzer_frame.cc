@@ -3,8 +3,6 @@
 
 #include "spananalyzer/span_analyzer_frame.h"
 
-#include "appcommon/units/cable_unit_converter.h"
-#include "appcommon/units/weather_load_case_unit_converter.h"
 #include "wx/aboutdlg.h"
 #include "wx/printdlg.h"
 #include "wx/xrc/xmlres.h"
@@ -12,7 +10,6 @@
 #include "spananalyzer/analysis_filter_manager_dialog.h"
 #include "spananalyzer/cable_constraint_manager_dialog.h"
 #include "spananalyzer/cable_file_manager_dialog.h"
-#include "spananalyzer/file_handler.h"
 #include "spananalyzer/preferences_dialog.h"
 #include "spananalyzer/span_analyzer_app.h"
 #include "spananalyzer/span_analyzer_doc.h"
@@ -56,6 +53,7 @@ bool DocumentFileDropTarget::OnDropFiles(wxCoord x, wxCoord y,
 }
 
 BEGIN_EVENT_TABLE(SpanAnalyzerFrame, wxDocParentFrame)
+  EVT_IDLE(SpanAnalyzerFrame::OnIdle)
   EVT_MENU(XRCID("menuitem_edit_analysisfilters"), SpanAnalyzerFrame::OnMenuEditAnalysisFilters)
   EVT_MENU(XRCID("menuitem_edit_cables"), SpanAnalyzerFrame::OnMenuEditCables)
   EVT_MENU(XRCID("menuitem_edit_constraints"), SpanAnalyzerFrame::OnMenuEditConstraints)
@@ -111,6 +109,20 @@ SpanAnalyzerFrame::~SpanAnalyzerFrame() {
   manager_.UnInit();
 }
 
+void SpanAnalyzerFrame::OnIdle(wxIdleEvent& event) {
+  // flushes any view updates that are pending
+  SpanAnalyzerDoc* doc = wxGetApp().GetDocument();
+  if (doc != nullptr) {
+    SpanAnalyzerView* view =
+        dynamic_cast<SpanAnalyzerView*>(doc->GetFirstView());
+    if (view != nullptr) {
+      view->FlushUpdates(false);
+    }
+  }
+
+  event.Skip();
+}
+
 void SpanAnalyzerFrame::OnMenuEditAnalysisFilters(wxCommandEvent& event) {
   // gets application config and data
   const SpanAnalyzerConfig* config = wxGetApp().config();
@@ -124,8 +136,9 @@ void SpanAnalyzerFrame::OnMenuEditAnalysisFilters(wxCommandEvent& event) {
 
     wxLogVerbose("Updating analysis filters.");
 
-    // saves application data
-    FileHandler::SaveAppData(config->filepath_data, *data, config->units);
+    // saves application data in the background
+    wxGetApp().controller_save()->SaveAppData(config->filepath_data, *data,
+                                              wxGetApp().units_model());
 
     // updates document/views
     SpanAnalyzerDoc* doc = wxGetApp().GetDocument();
@@ -148,10 +161,14 @@ void SpanAnalyzerFrame::OnMenuEditCables(wxCommandEvent& event) {
 
     wxLogVerbose("Updating cables.");
 
-    // saves application data
-    FileHandler::SaveAppData(config->filepath_data, *data, config->units);
+    // saves application data in the background
+    wxGetApp().controller_save()->SaveAppData(config->filepath_data, *data,
+                                              wxGetApp().units_model());
   }
 
+  // rebuilds the data index, as cables may be added, deleted, or renamed
+  wxGetApp().index_data()->Build(*data);
+
   wxBusyCursor cursor;
 
   // updates document/views
@@ -180,9 +197,9 @@ void SpanAnalyzerFrame::OnMenuEditConstraints(wxCommandEvent& event) {
 
     wxLogVerbose("Updating constraints.");
 
-    // saves application data
-    FileHandler::SaveAppData(wxGetApp().config()->filepath_data, *data,
-                             wxGetApp().config()->units);
+    // saves application data in the background
+    wxGetApp().controller_save()->SaveAppData(
+        wxGetApp().config()->filepath_data, *data, wxGetApp().units_model());
   }
 
   // updates document/views
@@ -210,11 +227,15 @@ void SpanAnalyzerFrame::OnMenuEditWeathercases(
 
     wxLogVerbose("Updating weathercases.");
 
-    // saves application data
-    FileHandler::SaveAppData(wxGetApp().config()->filepath_data, *data,
-                             wxGetApp().config()->units);
+    // saves application data in the background
+    wxGetApp().controller_save()->SaveAppData(
+        wxGetApp().config()->filepath_data, *data, wxGetApp().units_model());
   }
 
+  // rebuilds the data index, as weathercases may be added, deleted, or
+  // renamed
+  wxGetApp().index_data()->Build(*data);
+
   // updates document/views
   SpanAnalyzerDoc* doc = wxGetApp().GetDocument();
   if (doc != nullptr) {
@@ -243,9 +264,6 @@ void SpanAnalyzerFrame::OnMenuFilePreferences(wxCommandEvent& event) {
   // gets the application config
   SpanAnalyzerConfig* config = wxGetApp().config();
 
-  // stores a copy of the unit system before letting user edit
-  units::UnitSystem units_before = config->units;
-
   // creates preferences editor dialog and shows
   // exits if user closes/cancels
   PreferencesDialog preferences(this, config);
@@ -265,40 +283,18 @@ void SpanAnalyzerFrame::OnMenuFilePreferences(wxCommandEvent& event) {
     wxLog::SetVerbose(true);
   }
 
-  // converts unit system if it changed
-  SpanAnalyzerData* data = wxGetApp().data();
+  // updates the analysis and undo history options
   SpanAnalyzerDoc* doc = wxGetApp().GetDocument();
-  if (units_before != config->units) {
-    wxLogVerbose("Converting unit system.");
-
-    // converts app data
-    for (auto iter = data->weathercases.begin();
-         iter != data->weathercases.end(); iter++) {
-      WeatherLoadCase* weathercase = *iter;
-      WeatherLoadCaseUnitConverter::ConvertUnitSystem(
-          units_before,
-          config->units,
-          *weathercase);
-    }
-
-    for (auto iter = data->cablefiles.begin(); iter != data->cablefiles.end();
-         iter++) {
-      CableFile* cablefile = *iter;
-      CableUnitConverter::ConvertUnitSystem(
-          units_before,
-          config->units,
-          true,
-          cablefile->cable);
-    }
-
-    // updates document
-    if (doc != nullptr) {
-      doc->ConvertUnitSystem(units_before, config->units);
-      doc->RunAnalysis();
-    }
+  if (doc != nullptr) {
+    doc->set_options_cache_results(config->options_cache_results);
+    doc->set_options_surrogate(config->options_surrogate);
+    doc->set_options_threads(wxGetApp().OptionsThreads());
+    doc->set_size_memory_undo(config->size_memory_undo);
   }
 
   // updates views
+  // a unit system change only affects the display, so the data is not
+  // converted and the analysis doesn't need to be rerun
   if (doc != nullptr) {
     UpdateHint hint(UpdateHint::Type::kPreferencesEdit);
     doc->UpdateAllViews(nullptr, &hint);
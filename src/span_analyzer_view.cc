@@ -3,6 +3,8 @@
 
 #include "spananalyzer/span_analyzer_view.h"
 
+#include <utility>
+
 #include "appcommon/widgets/status_bar_log.h"
 #include "wx/cmdproc.h"
 
@@ -40,6 +42,36 @@ const AnalysisFilter* SpanAnalyzerView::AnalysisFilterActive() const {
   }
 }
 
+void SpanAnalyzerView::FlushUpdates(const bool& is_forced) {
+  // exits if no updates are pending
+  if ((pending_cable_.count == 0) && (pending_plan_.count == 0)
+      && (pending_profile_.count == 0) && (pending_results_.count == 0)) {
+    return;
+  }
+
+  // updates statusbar
+  status_bar_log::PushText("Updating view", 0);
+
+  // updates the panes
+  int count_avoided = 0;
+  count_avoided += FlushPane(pane_results_, pending_results_, is_forced);
+  count_avoided += FlushPane(pane_profile_, pending_profile_, is_forced);
+  count_avoided += FlushPane(pane_plan_, pending_plan_, is_forced);
+  count_avoided += FlushPane(pane_cable_, pending_cable_, is_forced);
+
+  if (0 < count_avoided) {
+    count_updates_avoided_ += count_avoided;
+
+    std::string message = "Coalesced view updates. "
+                          + std::to_string(count_avoided)
+                          + " redundant pane updates were avoided.";
+    wxLogVerbose(message.c_str());
+  }
+
+  // resets status bar
+  status_bar_log::PopText(0);
+}
+
 wxRect SpanAnalyzerView::GraphicsPlotRect() const {
   // gets active plot pane rect
   if (notebook_plot_->GetSelection() == 0) {
@@ -54,22 +86,13 @@ wxRect SpanAnalyzerView::GraphicsPlotRect() const {
 }
 
 int SpanAnalyzerView::IndexWeathercase(const AnalysisFilter& filter) const {
-  const std::list<WeatherLoadCase*>* weathercases =
-      &wxGetApp().data()->weathercases;
-
-  int index = 0;
-  for (auto iter = weathercases->cbegin(); iter != weathercases->cend();
-       iter++) {
-    const WeatherLoadCase* weathercase = *iter;
-    if (filter.weathercase == weathercase) {
-      return index;
-    } else {
-      index++;
-    }
+  auto iter = indexes_weathercases_.find(filter.weathercase);
+  if (iter == indexes_weathercases_.cend()) {
+    // match wasn't found
+    return -1;
   }
 
-  // match wasn't found
-  return -1;
+  return iter->second;
 }
 
 bool SpanAnalyzerView::OnClose(bool WXUNUSED(deleteWindow)) {
@@ -83,6 +106,12 @@ bool SpanAnalyzerView::OnClose(bool WXUNUSED(deleteWindow)) {
   // saves AUI perspective
   wxGetApp().config()->perspective = manager->SavePerspective();
 
+  // discards pending updates, as the panes are destroyed
+  pending_cable_ = PendingUpdates();
+  pending_plan_ = PendingUpdates();
+  pending_profile_ = PendingUpdates();
+  pending_results_ = PendingUpdates();
+
   // detaches panes
   manager->DetachPane(notebook_plot_);
   manager->DetachPane(pane_edit_);
@@ -127,9 +156,17 @@ bool SpanAnalyzerView::OnCreate(wxDocument *doc, long flags) {
   }
 
   // initializes cached references
+  count_updates_avoided_ = 0;
   group_filters_ = nullptr;
   index_filter_ = -1;
   target_render_ = RenderTarget::kScreen;
+  UpdateIndexesWeathercases();
+
+  // initializes pending updates
+  pending_cable_.count = 0;
+  pending_plan_.count = 0;
+  pending_profile_.count = 0;
+  pending_results_.count = 0;
 
   // gets main application frame
   wxFrame* frame = dynamic_cast<wxFrame*>(wxGetApp().GetTopWindow());
@@ -244,20 +281,35 @@ void SpanAnalyzerView::OnNotebookPageChange(wxBookCtrlEvent& event) {
   // creates an update hint for the plot pane
   UpdateHint hint(UpdateHint::Type::kViewSelect);
 
-  // gets page index and sends update to corresponding pane
+  // gets page index and the corresponding pane
+  wxWindow* pane = nullptr;
+  PendingUpdates* pending = nullptr;
   const int index_page = event.GetSelection();
   if (index_page == 0) {
-    pane_profile_->Update(&hint);
+    pane = pane_profile_;
+    pending = &pending_profile_;
   } else if (index_page == 1) {
-    pane_plan_->Update(&hint);
+    pane = pane_plan_;
+    pending = &pending_plan_;
   } else if (index_page == 2) {
-    pane_cable_->Update(&hint);
+    pane = pane_cable_;
+    pending = &pending_cable_;
   } else {
     wxLogError("Invalid page selection");
+    return;
   }
+
+  // updates the pane immediately, which covers any pending updates
+  count_updates_avoided_ += pending->count;
+  *pending = PendingUpdates();
+
+  UpdatePane(pane, &hint);
 }
 
 void SpanAnalyzerView::OnPrint(wxCommandEvent& event) {
+  // updates the plot before it is rendered to the printer
+  FlushUpdates(false);
+
   // gets printout
   wxPrintout* printout = OnCreatePrintout();
 
@@ -274,6 +326,9 @@ void SpanAnalyzerView::OnPrint(wxCommandEvent& event) {
 }
 
 void SpanAnalyzerView::OnPrintPreview(wxCommandEvent& event) {
+  // updates the plot before it is rendered to the preview
+  FlushUpdates(false);
+
   // gets printouts
   // one is for previewing, the other is for printing
   wxPrintout* printout_view = OnCreatePrintout();
@@ -308,24 +363,42 @@ void SpanAnalyzerView::OnUpdate(wxView* sender, wxObject* hint) {
   // updates statusbar
   status_bar_log::PushText("Updating view", 0);
 
+  // updates the weathercase indexes before any pane looks up results
+  // the constraint filter group is modified along with the document, so the
+  // filter indexes are updated for every edit
+  UpdateHint::Type type = UpdateHint::Type::kNull;
+  const UpdateHint* hint_update = dynamic_cast<const UpdateHint*>(hint);
+  if (hint_update != nullptr) {
+    type = hint_update->type();
+  }
+
+  if ((type == UpdateHint::Type::kNull)
+      || (type == UpdateHint::Type::kWeathercasesEdit)) {
+    UpdateIndexesWeathercases();
+  } else if ((type != UpdateHint::Type::kAnalysisFilterSelect)
+             && (type != UpdateHint::Type::kViewSelect)) {
+    UpdateIndexesFilters();
+  }
+
   // don't need to distinguish sender - all frames are grouped under one view
+  // the edit pane is updated immediately so edit actions can select the
+  // updated span items
   pane_edit_->Update(hint);
-  pane_results_->Update(hint);
 
-  // determines which pane is displayed in the notebook
-  const int index_page = notebook_plot_->GetSelection();
-  if (index_page == 0) {
-    pane_profile_->Update(hint);
-  } else if (index_page == 1) {
-    pane_plan_->Update(hint);
-  } else if (index_page == 2) {
-    pane_cable_->Update(hint);
-  }
+  // posts updates to the other panes, which are flushed when idle
+  PostUpdate(hint, pending_results_);
+  PostUpdate(hint, pending_profile_);
+  PostUpdate(hint, pending_plan_);
+  PostUpdate(hint, pending_cable_);
 
   // resets status bar
   status_bar_log::PopText(0);
 }
 
+int SpanAnalyzerView::count_updates_avoided() const {
+  return count_updates_avoided_;
+}
+
 const AnalysisFilterGroup* SpanAnalyzerView::group_filters() const {
   return group_filters_;
 }
@@ -334,6 +407,11 @@ const int SpanAnalyzerView::index_filter() const {
   return index_filter_;
 }
 
+const std::vector<int>& SpanAnalyzerView::indexes_weathercases_filters()
+    const {
+  return indexes_weathercases_filters_;
+}
+
 CablePlotPane* SpanAnalyzerView::pane_cable() {
   return pane_cable_;
 }
@@ -352,6 +430,7 @@ ResultsPane* SpanAnalyzerView::pane_results() {
 
 void SpanAnalyzerView::set_group_filters(const AnalysisFilterGroup* group) {
   group_filters_ = group;
+  UpdateIndexesFilters();
 }
 
 void SpanAnalyzerView::set_index_filter(const int& index_filter) {
@@ -366,3 +445,115 @@ void SpanAnalyzerView::set_target_render(
 SpanAnalyzerView::RenderTarget SpanAnalyzerView::target_render() const {
   return target_render_;
 }
+
+UpdateHint::Type SpanAnalyzerView::CoalesceUpdates(
+    const std::set<UpdateHint::Type>& types) {
+  // a filter group edit also updates the filter group choices, so it covers
+  // every other type
+  if (types.count(UpdateHint::Type::kAnalysisFilterGroupEdit) == 1) {
+    return UpdateHint::Type::kAnalysisFilterGroupEdit;
+  }
+
+  // data edits and filter group selections rebuild the pane datasets
+  for (auto iter = types.cbegin(); iter != types.cend(); iter++) {
+    const UpdateHint::Type& type = *iter;
+    if ((type != UpdateHint::Type::kNull)
+        && (type != UpdateHint::Type::kAnalysisFilterSelect)
+        && (type != UpdateHint::Type::kViewSelect)) {
+      return type;
+    }
+  }
+
+  // a null hint initializes the pane
+  if (types.count(UpdateHint::Type::kNull) == 1) {
+    return UpdateHint::Type::kNull;
+  }
+
+  // only selection changes are left
+  return *types.cbegin();
+}
+
+int SpanAnalyzerView::FlushPane(wxWindow* pane, PendingUpdates& pending,
+                                const bool& is_forced) {
+  // checks if any updates are pending
+  if (pending.count == 0) {
+    return 0;
+  }
+
+  // skips panes that aren't visible, such as hidden notebook pages
+  if ((is_forced == false) && (pane->IsShownOnScreen() == false)) {
+    return 0;
+  }
+
+  // updates the pane once with the coalesced hint
+  const UpdateHint::Type type = CoalesceUpdates(pending.types);
+  const int count_avoided = pending.count - 1;
+  pending = PendingUpdates();
+
+  UpdateHint hint(type);
+  if (type == UpdateHint::Type::kNull) {
+    UpdatePane(pane, nullptr);
+  } else {
+    UpdatePane(pane, &hint);
+  }
+
+  return count_avoided;
+}
+
+void SpanAnalyzerView::PostUpdate(const wxObject* hint,
+                                  PendingUpdates& pending) {
+  UpdateHint::Type type = UpdateHint::Type::kNull;
+  const UpdateHint* hint_update = dynamic_cast<const UpdateHint*>(hint);
+  if (hint_update != nullptr) {
+    type = hint_update->type();
+  }
+
+  pending.count++;
+  pending.types.insert(type);
+}
+
+void SpanAnalyzerView::UpdatePane(wxWindow* pane, wxObject* hint) {
+  if (pane == pane_results_) {
+    pane_results_->Update(hint);
+  } else if (pane == pane_profile_) {
+    pane_profile_->Update(hint);
+  } else if (pane == pane_plan_) {
+    pane_plan_->Update(hint);
+  } else if (pane == pane_cable_) {
+    pane_cable_->Update(hint);
+  }
+}
+
+void SpanAnalyzerView::UpdateIndexesFilters() {
+  indexes_weathercases_filters_.clear();
+  if (group_filters_ == nullptr) {
+    return;
+  }
+
+  // resolves each filter to a weathercase index
+  const std::list<AnalysisFilter>& filters = group_filters_->filters;
+  indexes_weathercases_filters_.reserve(filters.size());
+  for (auto iter = filters.cbegin(); iter != filters.cend(); iter++) {
+    const AnalysisFilter& filter = *iter;
+    indexes_weathercases_filters_.push_back(IndexWeathercase(filter));
+  }
+}
+
+void SpanAnalyzerView::UpdateIndexesWeathercases() {
+  const std::list<WeatherLoadCase*>& weathercases =
+      wxGetApp().data()->weathercases;
+
+  // maps each weathercase to its position in the application data
+  indexes_weathercases_.clear();
+  indexes_weathercases_.reserve(weathercases.size());
+
+  int index = 0;
+  for (auto iter = weathercases.cbegin(); iter != weathercases.cend();
+       iter++) {
+    const WeatherLoadCase* weathercase = *iter;
+    indexes_weathercases_.insert(std::make_pair(weathercase, index));
+    index++;
+  }
+
+  UpdateIndexesFilters();
+}
@@ -0,0 +1,93 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/span_index.h"
+
+SpanIndex::SpanIndex() {
+}
+
+void SpanIndex::Add(const Span& span) {
+  names_[span.name]++;
+
+  const LineCable& linecable = span.linecable;
+  if (linecable.cable() != nullptr) {
+    references_cables_[linecable.cable()]++;
+  }
+
+  if (linecable.constraint().case_weather != nullptr) {
+    references_weathercases_[linecable.constraint().case_weather]++;
+  }
+
+  if (linecable.weathercase_stretch_creep() != nullptr) {
+    references_weathercases_[linecable.weathercase_stretch_creep()]++;
+  }
+
+  if (linecable.weathercase_stretch_load() != nullptr) {
+    references_weathercases_[linecable.weathercase_stretch_load()]++;
+  }
+}
+
+void SpanIndex::Clear() {
+  names_.clear();
+  references_cables_.clear();
+  references_weathercases_.clear();
+}
+
+bool SpanIndex::ContainsName(const std::string& name) const {
+  return names_.count(name) == 1;
+}
+
+int SpanIndex::CountReferences(const Cable* cable) const {
+  auto iter = references_cables_.find(cable);
+  if (iter == references_cables_.cend()) {
+    return 0;
+  }
+
+  return iter->second;
+}
+
+int SpanIndex::CountReferences(const WeatherLoadCase* weathercase) const {
+  auto iter = references_weathercases_.find(weathercase);
+  if (iter == references_weathercases_.cend()) {
+    return 0;
+  }
+
+  return iter->second;
+}
+
+void SpanIndex::Remove(const Span& span) {
+  Decrement(span.name, names_);
+
+  const LineCable& linecable = span.linecable;
+  if (linecable.cable() != nullptr) {
+    Decrement(linecable.cable(), references_cables_);
+  }
+
+  if (linecable.constraint().case_weather != nullptr) {
+    Decrement(linecable.constraint().case_weather, references_weathercases_);
+  }
+
+  if (linecable.weathercase_stretch_creep() != nullptr) {
+    Decrement(linecable.weathercase_stretch_creep(),
+              references_weathercases_);
+  }
+
+  if (linecable.weathercase_stretch_load() != nullptr) {
+    Decrement(linecable.weathercase_stretch_load(), references_weathercases_);
+  }
+}
+
+template<typename T>
+void SpanIndex::Decrement(
+    const typename std::unordered_map<T, int>::key_type& key,
+    std::unordered_map<T, int>& counts) {
+  auto iter = counts.find(key);
+  if (iter == counts.end()) {
+    return;
+  }
+
+  iter->second--;
+  if (iter->second <= 0) {
+    counts.erase(iter);
+  }
+}
@@ -0,0 +1,177 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/span_list_ctrl.h"
+
+#include <iterator>
+#include <utility>
+
+BEGIN_EVENT_TABLE(SpanListCtrl, wxListCtrl)
+  EVT_SIZE(SpanListCtrl::OnSize)
+END_EVENT_TABLE()
+
+SpanListCtrl::SpanListCtrl(wxWindow* parent)
+    : wxListCtrl(parent, wxID_ANY, wxDefaultPosition, wxDefaultSize,
+                 wxLC_REPORT | wxLC_VIRTUAL | wxLC_SINGLE_SEL
+                 | wxLC_NO_HEADER) {
+  index_bold_ = -1;
+
+  // adds a single column, which is sized to the control
+  InsertColumn(0, "Spans");
+
+  // creates the bold row style
+  attr_bold_.SetFont(GetFont().Bold());
+}
+
+SpanListCtrl::~SpanListCtrl() {
+}
+
+void SpanListCtrl::DeleteRow(const int& index) {
+  if (IsValidRow(index) == false) {
+    return;
+  }
+
+  rows_.erase(rows_.begin() + index);
+
+  // adjusts the bold row
+  if (index == index_bold_) {
+    index_bold_ = -1;
+  } else if (index < index_bold_) {
+    index_bold_--;
+  }
+
+  SetItemCount(rows_.size());
+  Refresh();
+}
+
+void SpanListCtrl::InsertRow(const int& index,
+                             const std::list<Span>& spans) {
+  const int kSizeRows = rows_.size();
+  if ((index < 0) || (kSizeRows < index)) {
+    return;
+  }
+
+  // the inserted span is directly before the span that previously had the
+  // index, so the document list doesn't need to be searched
+  std::list<Span>::const_iterator iter;
+  if (index < kSizeRows) {
+    iter = std::prev(rows_.at(index));
+  } else {
+    iter = std::prev(spans.cend());
+  }
+
+  rows_.insert(rows_.begin() + index, iter);
+
+  // adjusts the bold row
+  if (index <= index_bold_) {
+    index_bold_++;
+  }
+
+  SetItemCount(rows_.size());
+  Refresh();
+}
+
+bool SpanListCtrl::IsValidRow(const int& index) const {
+  const int kSizeRows = rows_.size();
+  return (0 <= index) && (index < kSizeRows);
+}
+
+void SpanListCtrl::RebuildRows(const std::list<Span>& spans) {
+  rows_.clear();
+  rows_.reserve(spans.size());
+  for (auto iter = spans.cbegin(); iter != spans.cend(); iter++) {
+    rows_.push_back(iter);
+  }
+
+  index_bold_ = -1;
+
+  SetItemCount(rows_.size());
+  Refresh();
+}
+
+void SpanListCtrl::RefreshRow(const int& index) {
+  if (IsValidRow(index) == false) {
+    return;
+  }
+
+  RefreshItem(index);
+}
+
+int SpanListCtrl::RowSelected() const {
+  return GetNextItem(-1, wxLIST_NEXT_ALL, wxLIST_STATE_SELECTED);
+}
+
+void SpanListCtrl::SelectRow(const int& index) {
+  if (IsValidRow(index) == false) {
+    return;
+  }
+
+  SetItemState(index, wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED,
+               wxLIST_STATE_SELECTED | wxLIST_STATE_FOCUSED);
+  EnsureVisible(index);
+}
+
+const Span* SpanListCtrl::SpanRow(const int& index) const {
+  if (IsValidRow(index) == false) {
+    return nullptr;
+  }
+
+  return &(*rows_.at(index));
+}
+
+void SpanListCtrl::SwapRows(const int& index_a, const int& index_b) {
+  if ((IsValidRow(index_a) == false) || (IsValidRow(index_b) == false)) {
+    return;
+  }
+
+  std::swap(rows_.at(index_a), rows_.at(index_b));
+
+  // adjusts the bold row
+  if (index_bold_ == index_a) {
+    index_bold_ = index_b;
+  } else if (index_bold_ == index_b) {
+    index_bold_ = index_a;
+  }
+
+  RefreshItem(index_a);
+  RefreshItem(index_b);
+}
+
+int SpanListCtrl::index_bold() const {
+  return index_bold_;
+}
+
+void SpanListCtrl::set_index_bold(const int& index) {
+  if (index == index_bold_) {
+    return;
+  }
+
+  // redraws the previous and new bold rows
+  const int index_previous = index_bold_;
+  index_bold_ = index;
+
+  RefreshRow(index_previous);
+  RefreshRow(index_bold_);
+}
+
+wxListItemAttr* SpanListCtrl::OnGetItemAttr(long item) const {
+  if (item == index_bold_) {
+    return &attr_bold_;
+  } else {
+    return nullptr;
+  }
+}
+
+wxString SpanListCtrl::OnGetItemText(long item, long column) const {
+  const Span* span = SpanRow(item);
+  if (span == nullptr) {
+    return wxEmptyString;
+  }
+
+  return span->name;
+}
+
+void SpanListCtrl::OnSize(wxSizeEvent& event) {
+  SetColumnWidth(0, GetClientSize().GetWidth());
+  event.Skip();
+}
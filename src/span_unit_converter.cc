@@ -19,6 +19,9 @@ bool SpanUnitConverter::ConvertUnitStyleToConsistent(
     ConvertUnitStyleToConsistentV1(system, is_recursive, span);
   } else if (version == 1) {
     ConvertUnitStyleToConsistentV1(system, is_recursive, span);
+  } else if (version == 2) {
+    // the profile points don't have any style-dependent units
+    ConvertUnitStyleToConsistentV1(system, is_recursive, span);
   } else {
     wxString message = " Invalid version number. Aborting conversion.";
     wxLogError(message);
@@ -60,6 +63,21 @@ void SpanUnitConverter::ConvertUnitSystem(
         spacing_attachments.z(),
         units::LengthConversionType::kFeetToMeters));
 
+    // converts profile points
+    for (auto iter = span.profile.begin(); iter != span.profile.end();
+         iter++) {
+      ProfilePoint& point = *iter;
+      point.clearance = units::ConvertLength(
+          point.clearance,
+          units::LengthConversionType::kFeetToMeters);
+      point.elevation = units::ConvertLength(
+          point.elevation,
+          units::LengthConversionType::kFeetToMeters);
+      point.station = units::ConvertLength(
+          point.station,
+          units::LengthConversionType::kFeetToMeters);
+    }
+
   } else if (system_to == units::UnitSystem::kImperial) {
     // converts spacing-attachments
     Vector3d& spacing_attachments =  span.spacing_attachments;
@@ -72,6 +90,21 @@ void SpanUnitConverter::ConvertUnitSystem(
     spacing_attachments.set_z(units::ConvertLength(
         spacing_attachments.z(),
         units::LengthConversionType::kMetersToFeet));
+
+    // converts profile points
+    for (auto iter = span.profile.begin(); iter != span.profile.end();
+         iter++) {
+      ProfilePoint& point = *iter;
+      point.clearance = units::ConvertLength(
+          point.clearance,
+          units::LengthConversionType::kMetersToFeet);
+      point.elevation = units::ConvertLength(
+          point.elevation,
+          units::LengthConversionType::kMetersToFeet);
+      point.station = units::ConvertLength(
+          point.station,
+          units::LengthConversionType::kMetersToFeet);
+    }
   }
 
   // triggers member variable converters
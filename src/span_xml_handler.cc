@@ -22,7 +22,7 @@ wxXmlNode* SpanXmlHandler::CreateNode(
 
   // creates a node for the span root
   node_root = new wxXmlNode(wxXML_ELEMENT_NODE, "span");
-  node_root->AddAttribute("version", "1");
+  node_root->AddAttribute("version", "2");
 
   if (name != "") {
     node_root->AddAttribute("name", name);
@@ -63,6 +63,37 @@ wxXmlNode* SpanXmlHandler::CreateNode(
                                                 true);
   node_root->AddChild(node_element);
 
+  // creates profile node and adds to parent node
+  if (span.profile.empty() == false) {
+    node_element = new wxXmlNode(wxXML_ELEMENT_NODE, "profile");
+    if (attribute.GetName() != "") {
+      node_element->AddAttribute(attribute.GetName(), attribute.GetValue());
+    }
+
+    // points are inserted after the previous point, as appending searches
+    // the entire child list
+    wxXmlNode* node_previous = nullptr;
+    for (auto iter = span.profile.cbegin(); iter != span.profile.cend();
+         iter++) {
+      const ProfilePoint& point = *iter;
+      wxXmlNode* node_point = new wxXmlNode(wxXML_ELEMENT_NODE, "point");
+      node_point->AddAttribute(
+          "station", XmlStreamWriter::FormatNumber(point.station, 3));
+      node_point->AddAttribute(
+          "elevation", XmlStreamWriter::FormatNumber(point.elevation, 3));
+      node_point->AddAttribute(
+          "clearance", XmlStreamWriter::FormatNumber(point.clearance, 3));
+      if (node_previous == nullptr) {
+        node_element->AddChild(node_point);
+      } else {
+        node_element->InsertChildAfter(node_point, node_previous);
+      }
+      node_previous = node_point;
+    }
+
+    node_root->AddChild(node_element);
+  }
+
   // returns node
   return node_root;
 }
@@ -98,6 +129,9 @@ bool SpanXmlHandler::ParseNode(
   if (kVersion == 1) {
     return ParseNodeV1(root, filepath, units, convert, cablefiles, weathercases,
                        span);
+  } else if (kVersion == 2) {
+    return ParseNodeV2(root, filepath, units, convert, cablefiles, weathercases,
+                       span);
   } else {
     message = FileAndLineNumber(filepath, root) +
               " Invalid version number. Aborting node parse.";
@@ -106,6 +140,64 @@ bool SpanXmlHandler::ParseNode(
   }
 }
 
+bool SpanXmlHandler::ParseNodeProfile(
+    const wxXmlNode* root,
+    const std::string& filepath,
+    std::vector<ProfilePoint>& profile) {
+  bool status = true;
+  wxString message;
+
+  // counts the points so the profile is only allocated once
+  int num_points = 0;
+  wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    num_points++;
+    node = node->GetNext();
+  }
+
+  profile.clear();
+  profile.reserve(num_points);
+
+  // evaluates each child node
+  node = root->GetChildren();
+  while (node != nullptr) {
+    if (node->GetName() == "point") {
+      // the point values are stored as attributes to keep dense profiles
+      // compact
+      ProfilePoint point;
+      double* values[] = {&point.station, &point.elevation, &point.clearance};
+      const char* names[] = {"station", "elevation", "clearance"};
+
+      bool is_valid = true;
+      for (int i = 0; i < 3; i++) {
+        wxString content;
+        if ((node->GetAttribute(names[i], &content) == false)
+            || (content.ToDouble(values[i]) == false)) {
+          is_valid = false;
+        }
+      }
+
+      if (is_valid == true) {
+        profile.push_back(point);
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Invalid profile point.";
+        wxLogError(message);
+        status = false;
+      }
+    } else {
+      message = FileAndLineNumber(filepath, node)
+                + "XML node isn't recognized.";
+      wxLogError(message);
+      status = false;
+    }
+
+    node = node->GetNext();
+  }
+
+  return status;
+}
+
 bool SpanXmlHandler::ParseNodeV1(
     const wxXmlNode* root,
     const std::string& filepath,
@@ -187,3 +279,164 @@ bool SpanXmlHandler::ParseNodeV1(
 
   return status;
 }
+
+bool SpanXmlHandler::ParseNodeV2(
+    const wxXmlNode* root,
+    const std::string& filepath,
+    const units::UnitSystem& units,
+    const bool& convert,
+    const std::list<CableFile*>* cablefiles,
+    const std::list<WeatherLoadCase*>* weathercases,
+    Span& span) {
+  // variables used to parse XML node
+  bool status = true;
+  wxString title;
+  wxString content;
+  wxString message;
+
+  // creates a compatible list of weathercases
+  std::list<const WeatherLoadCase*> weathercases_const;
+  for (auto iter = weathercases->cbegin(); iter != weathercases->cend();
+       iter++) {
+    const WeatherLoadCase* weathercase = *iter;
+    weathercases_const.push_back(weathercase);
+  }
+
+  // evaluates each child node
+  wxXmlNode* node = root->GetChildren();
+  while (node != nullptr) {
+    title = node->GetName();
+    content = ParseElementNodeWithContent(node);
+
+    if (title == "name") {
+      span.name = content;
+    } else if (title == "type") {
+      if (content == "Deadend") {
+        span.type = Span::Type::kDeadendSpan;
+      } else if (content == "RulingSpan") {
+        span.type = Span::Type::kRulingSpan;
+      } else {
+        message = FileAndLineNumber(filepath, node)
+                  + "Invalid span type.";
+        wxLogError(message);
+        status = false;
+      }
+    } else if (title == "line_cable") {
+      // line cable is not intended to be application-specific
+      // creates a list of cable pointers from the cable files
+      std::list<const Cable*> cables;
+
+      for (auto iter = cablefiles->begin(); iter != cablefiles->end(); iter++) {
+        const CableFile* cablefile = *iter;
+        const Cable* cable = &cablefile->cable;
+        cables.push_back(cable);
+      }
+
+      const bool status_node = LineCableXmlHandler::ParseNode(
+          node, filepath, units, convert, &cables, nullptr, &weathercases_const,
+          span.linecable);
+      if (status_node == false) {
+        status = false;
+      }
+    } else if (title == "profile") {
+      const bool status_node = ParseNodeProfile(node, filepath, span.profile);
+      if (status_node == false) {
+        status = false;
+      }
+    } else if (title == "vector_3d") {
+      const bool status_node = Vector3dXmlHandler::ParseNode(
+          node, filepath, span.spacing_attachments);
+      if (status_node == false) {
+        status = false;
+      }
+    } else {
+      message = FileAndLineNumber(filepath, node)
+                + "XML node isn't recognized.";
+      wxLogError(message);
+      status = false;
+    }
+
+    node = node->GetNext();
+  }
+
+  // converts unit style to 'consistent' if needed
+  if (convert == true) {
+    SpanUnitConverter::ConvertUnitStyleToConsistent(2, units, false, span);
+  }
+
+  return status;
+}
+
+void SpanXmlHandler::WriteNode(
+    const Span& span,
+    const std::string& name,
+    const units::UnitSystem& system_units,
+    const units::UnitStyle& style_units,
+    XmlStreamWriter& writer) {
+  // writes the span root
+  writer.StartElement("span");
+  writer.AddAttribute("version", "2");
+
+  if (name != "") {
+    writer.AddAttribute("name", name);
+  }
+
+  // writes name node
+  writer.WriteElement("name", span.name);
+
+  // writes type node
+  std::string content;
+  if (span.type == Span::Type::kDeadendSpan) {
+    content = "Deadend";
+  } else if (span.type == Span::Type::kRulingSpan) {
+    content = "RulingSpan";
+  }
+  writer.WriteElement("type", content);
+
+  // writes linecable node
+  // the node is generated by the common handler and released once written
+  wxXmlNode* node_linecable = LineCableXmlHandler::CreateNode(
+      span.linecable, "", system_units, style_units, nullptr);
+  writer.WriteNode(node_linecable);
+  delete node_linecable;
+
+  // writes spacing-attachments geometry node
+  std::string units;
+  if (system_units == units::UnitSystem::kImperial) {
+    units = "ft";
+  } else if (system_units == units::UnitSystem::kMetric) {
+    units = "m";
+  }
+
+  writer.StartElement("vector_3d");
+  writer.AddAttribute("version", "1");
+  writer.AddAttribute("name", "spacing_attachments");
+  writer.WriteElementNumber("x", span.spacing_attachments.x(), 3, units);
+  writer.WriteElementNumber("y", span.spacing_attachments.y(), 3, units);
+  writer.WriteElementNumber("z", span.spacing_attachments.z(), 3, units);
+  writer.EndElement();
+
+  // writes profile node
+  if (span.profile.empty() == false) {
+    writer.StartElement("profile");
+    writer.AddAttribute("units", units);
+
+    for (auto iter = span.profile.cbegin(); iter != span.profile.cend();
+         iter++) {
+      const ProfilePoint& point = *iter;
+      writer.StartElement("point");
+      writer.AddAttribute("station",
+                          XmlStreamWriter::FormatNumber(point.station, 3));
+      writer.AddAttribute("elevation",
+                          XmlStreamWriter::FormatNumber(point.elevation, 3));
+      writer.AddAttribute("clearance",
+                          XmlStreamWriter::FormatNumber(point.clearance, 3));
+      writer.EndElement();
+    }
+
+    writer.EndElement();
+  }
+
+  // ends the span root
+  writer.EndElement();
+}
@@ -0,0 +1,289 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/tension_surrogate.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "models/transmissionline/catenary.h"
+
+namespace {
+
+/// \var kNumKnotsInitial
+///   The number of evenly spaced knots that the refinement starts with.
+const int kNumKnotsInitial = 5;
+
+/// \var kNumKnotsMax
+///   The maximum number of knots.
+const int kNumKnotsMax = 257;
+
+}  // namespace
+
+TensionSurrogate::TensionSurrogate() {
+  condition_ = CableConditionType::kNull;
+  error_ = 0;
+  line_cable_ = nullptr;
+  num_solves_ = 0;
+  temperature_max_ = 0;
+  temperature_min_ = 0;
+  tolerance_ = 0.001;
+}
+
+TensionSurrogate::~TensionSurrogate() {
+}
+
+bool TensionSurrogate::Build() {
+  error_ = 0;
+  num_solves_ = 0;
+  slopes_.clear();
+  temperatures_.clear();
+  tensions_.clear();
+
+  if (line_cable_ == nullptr) {
+    return false;
+  }
+
+  reloader_.set_line_cable(line_cable_);
+  reloader_.set_condition_reloaded(condition_);
+
+  // solves the initial knots
+  // a zero-width range only needs a single knot
+  int num_knots = kNumKnotsInitial;
+  if (temperature_max_ <= temperature_min_) {
+    num_knots = 1;
+  }
+
+  for (int i = 0; i < num_knots; i++) {
+    double temperature = temperature_min_;
+    if (1 < num_knots) {
+      temperature += (temperature_max_ - temperature_min_) * i
+                     / (num_knots - 1);
+    }
+
+    double tension = 0;
+    if (SolveExact(temperature, tension) == false) {
+      return false;
+    }
+
+    temperatures_.push_back(temperature);
+    tensions_.push_back(tension);
+  }
+
+  if (num_knots == 1) {
+    return true;
+  }
+
+  // checks the interval midpoints against the spline, and splits intervals
+  // that exceed the tolerance
+  // the slopes of a knot depend on both adjacent intervals, so the neighbors
+  // of a split interval are checked again
+  std::vector<double> errors(num_knots - 1, 0);
+  std::vector<bool> is_checked(num_knots - 1, false);
+  while (true) {
+    UpdateSlopes();
+
+    // solves the unchecked midpoints
+    const int kSizeIntervals = errors.size();
+    std::vector<bool> is_split(kSizeIntervals, false);
+    std::vector<double> tensions_mid(kSizeIntervals, 0);
+    int num_split = 0;
+    for (int i = 0; i < kSizeIntervals; i++) {
+      if (is_checked[i] == true) {
+        continue;
+      }
+
+      const double temperature = 0.5 * (temperatures_[i]
+                                        + temperatures_[i + 1]);
+      double tension = 0;
+      if (SolveExact(temperature, tension) == false) {
+        return false;
+      }
+
+      errors[i] = std::abs(tension - Interpolate(temperature))
+                  / std::abs(tension);
+      is_checked[i] = true;
+      if (tolerance_ < errors[i]) {
+        is_split[i] = true;
+        tensions_mid[i] = tension;
+        num_split++;
+      }
+    }
+
+    // stops if all intervals are within tolerance, or if splitting would
+    // exceed the knot limit
+    // the unsplit intervals keep their error, so it is reported
+    if ((num_split == 0)
+        || (kNumKnotsMax < kSizeIntervals + 1 + num_split)) {
+      break;
+    }
+
+    // inserts the midpoints of the split intervals as knots
+    std::vector<double> temperatures;
+    std::vector<double> tensions;
+    std::vector<double> errors_next;
+    std::vector<bool> is_checked_next;
+    for (int i = 0; i < kSizeIntervals; i++) {
+      temperatures.push_back(temperatures_[i]);
+      tensions.push_back(tensions_[i]);
+
+      const bool is_changed = (is_split[i] == true)
+          || ((0 < i) && (is_split[i - 1] == true))
+          || ((i < kSizeIntervals - 1) && (is_split[i + 1] == true));
+      if (is_split[i] == true) {
+        temperatures.push_back(0.5 * (temperatures_[i]
+                                      + temperatures_[i + 1]));
+        tensions.push_back(tensions_mid[i]);
+        errors_next.push_back(0);
+        is_checked_next.push_back(false);
+      }
+
+      errors_next.push_back(errors[i]);
+      is_checked_next.push_back(is_changed == false);
+    }
+    temperatures.push_back(temperatures_.back());
+    tensions.push_back(tensions_.back());
+
+    temperatures_.swap(temperatures);
+    tensions_.swap(tensions);
+    errors.swap(errors_next);
+    is_checked.swap(is_checked_next);
+  }
+
+  error_ = *std::max_element(errors.cbegin(), errors.cend());
+  return true;
+}
+
+double TensionSurrogate::TensionHorizontal(const double& temperature) const {
+  if (temperatures_.empty() == true) {
+    return 0;
+  }
+
+  const double temperature_clamped = std::min(
+      std::max(temperature, temperatures_.front()), temperatures_.back());
+  return Interpolate(temperature_clamped);
+}
+
+double TensionSurrogate::error() const {
+  return error_;
+}
+
+int TensionSurrogate::num_knots() const {
+  return temperatures_.size();
+}
+
+int TensionSurrogate::num_solves() const {
+  return num_solves_;
+}
+
+void TensionSurrogate::set_condition(const CableConditionType& condition) {
+  condition_ = condition;
+}
+
+void TensionSurrogate::set_line_cable(const LineCable* line_cable) {
+  line_cable_ = line_cable;
+}
+
+void TensionSurrogate::set_temperatures(const double& temperature_min,
+                                        const double& temperature_max) {
+  temperature_min_ = temperature_min;
+  temperature_max_ = temperature_max;
+}
+
+void TensionSurrogate::set_tolerance(const double& tolerance) {
+  tolerance_ = tolerance;
+}
+
+void TensionSurrogate::set_weathercase(const WeatherLoadCase& weathercase) {
+  weathercase_ = weathercase;
+}
+
+Vector3d TensionSurrogate::weight_unit() const {
+  return weight_unit_;
+}
+
+double TensionSurrogate::Interpolate(const double& temperature) const {
+  const int kSizeKnots = temperatures_.size();
+  if (kSizeKnots == 1) {
+    return tensions_.front();
+  }
+
+  // finds the interval
+  auto iter = std::upper_bound(temperatures_.cbegin(), temperatures_.cend(),
+                               temperature);
+  int index = std::distance(temperatures_.cbegin(), iter) - 1;
+  index = std::max(index, 0);
+  index = std::min(index, kSizeKnots - 2);
+
+  // evaluates the cubic hermite basis
+  const double h = temperatures_[index + 1] - temperatures_[index];
+  const double t = (temperature - temperatures_[index]) / h;
+  const double t2 = t * t;
+  const double t3 = t2 * t;
+
+  return (2 * t3 - 3 * t2 + 1) * tensions_[index]
+         + (t3 - 2 * t2 + t) * h * slopes_[index]
+         + (-2 * t3 + 3 * t2) * tensions_[index + 1]
+         + (t3 - t2) * h * slopes_[index + 1];
+}
+
+bool TensionSurrogate::SolveExact(const double& temperature,
+                                  double& tension) {
+  weathercase_.temperature_cable = temperature;
+  reloader_.set_weathercase_reloaded(&weathercase_);
+
+  num_solves_++;
+  if (reloader_.Validate(false, nullptr) == false) {
+    return false;
+  }
+
+  const Catenary3d catenary = reloader_.CatenaryReloaded();
+  tension = catenary.tension_horizontal();
+  weight_unit_ = catenary.weight_unit();
+  return true;
+}
+
+void TensionSurrogate::UpdateSlopes() {
+  const int kSizeKnots = temperatures_.size();
+  slopes_.assign(kSizeKnots, 0);
+  if (kSizeKnots < 2) {
+    return;
+  }
+
+  // gets the secant slopes of the intervals
+  std::vector<double> secants(kSizeKnots - 1);
+  for (int i = 0; i < kSizeKnots - 1; i++) {
+    secants[i] = (tensions_[i + 1] - tensions_[i])
+                 / (temperatures_[i + 1] - temperatures_[i]);
+  }
+
+  // averages the secants at interior knots, and uses the end secants at the
+  // end knots
+  slopes_.front() = secants.front();
+  slopes_.back() = secants.back();
+  for (int i = 1; i < kSizeKnots - 1; i++) {
+    if (secants[i - 1] * secants[i] <= 0) {
+      slopes_[i] = 0;
+    } else {
+      slopes_[i] = 0.5 * (secants[i - 1] + secants[i]);
+    }
+  }
+
+  // limits the slopes so each interval stays monotone
+  for (int i = 0; i < kSizeKnots - 1; i++) {
+    if (secants[i] == 0) {
+      slopes_[i] = 0;
+      slopes_[i + 1] = 0;
+      continue;
+    }
+
+    const double alpha = slopes_[i] / secants[i];
+    const double beta = slopes_[i + 1] / secants[i];
+    const double sum = alpha * alpha + beta * beta;
+    if (9 < sum) {
+      const double tau = 3 / std::sqrt(sum);
+      slopes_[i] = tau * alpha * secants[i];
+      slopes_[i + 1] = tau * beta * secants[i];
+    }
+  }
+}
@@ -38,10 +38,22 @@ WeatherLoadCaseManagerDialog::WeatherLoadCaseManagerDialog(
   weathercases_ = weathercases;
   weathercases_original_ = *weathercases;
   units_ = &units;
+  units_model_ = wxGetApp().units_model();
 
   // makes copies so user can modify
   weathercases_modified_ = *weathercases_;
 
+  // indexes the weathercases referenced by analysis filters
+  const SpanAnalyzerData* data = wxGetApp().data();
+  for (auto iter = data->groups_filters.cbegin();
+       iter != data->groups_filters.cend(); iter++) {
+    const AnalysisFilterGroup& group = *iter;
+    for (auto it = group.filters.cbegin(); it != group.filters.cend(); it++) {
+      const AnalysisFilter& filter = *it;
+      references_filters_.insert(filter.weathercase);
+    }
+  }
+
   // fills the listbox with the set descriptions
   for (auto iter = weathercases_modified_.cbegin();
        iter != weathercases_modified_.cend(); iter++) {
@@ -89,52 +101,19 @@ void WeatherLoadCaseManagerDialog::DeleteExtraWeathercases(
 }
 
 bool WeatherLoadCaseManagerDialog::IsReferencedByAnalysisFilters(
-    const std::string& name) const {
-  // gets document
-  const SpanAnalyzerData* data = wxGetApp().data();
-
-  // scans all analysis filters to see if weathercase is referenced
-  for (auto iter = data->groups_filters.cbegin();
-       iter != data->groups_filters.cend(); iter++) {
-    const AnalysisFilterGroup& group = *iter;
-
-    for (auto it = group.filters.cbegin(); it != group.filters.cend(); it++) {
-      const AnalysisFilter& filter = *it;
-      if (filter.weathercase->description == name) {
-        return true;
-      }
-    }
-  }
-
-  return false;
+    const WeatherLoadCase* weathercase) const {
+  return references_filters_.count(weathercase) == 1;
 }
 
 bool WeatherLoadCaseManagerDialog::IsReferencedByDocument(
-    const std::string& name) const {
+    const WeatherLoadCase* weathercase) const {
   // gets document
   const SpanAnalyzerDoc* doc = wxGetApp().GetDocument();
   if (doc == nullptr) {
     return false;
   }
 
-  // scans all spans to see if weathercase is referenced
-  for (auto iter = doc->spans().cbegin(); iter != doc->spans().cend(); iter++) {
-    const Span& span = *iter;
-
-    if (span.linecable.constraint().case_weather->description == name) {
-      return true;
-    }
-
-    if (span.linecable.weathercase_stretch_creep()->description == name) {
-      return true;
-    }
-
-    if (span.linecable.weathercase_stretch_load()->description == name) {
-      return true;
-    }
-  }
-
-  return false;
+  return doc->IsReferenced(weathercase);
 }
 
 bool WeatherLoadCaseManagerDialog::IsUniqueName(const std::string& name,
@@ -187,11 +166,13 @@ void WeatherLoadCaseManagerDialog::OnButtonAdd(wxCommandEvent& event) {
 
   wxBusyCursor cursor;
 
-  // converts weathercase to consistent unit style
+  // converts weathercase to consistent unit style and the model unit system
   WeatherLoadCaseUnitConverter::ConvertUnitStyleToConsistent(
       0,
       *units_,
       weathercase);
+  WeatherLoadCaseUnitConverter::ConvertUnitSystem(*units_, units_model_,
+                                                  weathercase);
 
   // adds weathercase to set
   WeatherLoadCase* weathercase_new = new WeatherLoadCase(weathercase);
@@ -230,7 +211,7 @@ void WeatherLoadCaseManagerDialog::OnButtonDelete(wxCommandEvent& event) {
   WeatherLoadCase* weathercase = *iter;
 
   // checks if weathercase is referenced by analysis filters
-  bool is_referenced = IsReferencedByAnalysisFilters(weathercase->description);
+  bool is_referenced = IsReferencedByAnalysisFilters(weathercase);
   if (is_referenced == true) {
     std::string message = weathercase->description + "  --  "
                           "Weathercase is currently referenced by analysis "
@@ -241,7 +222,7 @@ void WeatherLoadCaseManagerDialog::OnButtonDelete(wxCommandEvent& event) {
   }
 
   // checks if the weathercase is referenced by the document
-  is_referenced = IsReferencedByDocument(weathercase->description);
+  is_referenced = IsReferencedByDocument(weathercase);
   if (is_referenced == true) {
     std::string message = weathercase->description + "  --  "
                           "Weathercase is currently referenced by the open "
@@ -294,10 +275,14 @@ void WeatherLoadCaseManagerDialog::OnListBoxDoubleClick(wxCommandEvent& event) {
     return;
   }
 
-  // gets the weathercase, copies, and converts to different unit style
+  // gets the weathercase, copies, and converts to the display unit system and
+  // different unit style
   auto iter_weathercase = std::next(weathercases_modified_.begin(),
                                     index_selected_);
-  WeatherLoadCase* weathercase = *iter_weathercase;
+  WeatherLoadCase weathercase_edit = **iter_weathercase;
+  WeatherLoadCase* weathercase = &weathercase_edit;
+  WeatherLoadCaseUnitConverter::ConvertUnitSystem(units_model_, *units_,
+                                                  *weathercase);
   WeatherLoadCaseUnitConverter::ConvertUnitStyleToDifferent(
       *units_,
       *weathercase);
@@ -323,14 +308,16 @@ void WeatherLoadCaseManagerDialog::OnListBoxDoubleClick(wxCommandEvent& event) {
 
   wxBusyCursor cursor;
 
-  // converts weathercase to consistent unit style
+  // converts weathercase to consistent unit style and the model unit system
   WeatherLoadCaseUnitConverter::ConvertUnitStyleToConsistent(
       0,
       *units_,
       *weathercase);
+  WeatherLoadCaseUnitConverter::ConvertUnitSystem(*units_, units_model_,
+                                                  *weathercase);
 
   // saves weathercase to modified cases
-  *iter_weathercase = weathercase;
+  **iter_weathercase = *weathercase;
 
   // updates listbox of description change
   listbox_weathercases_->SetString(index_selected_,
@@ -0,0 +1,157 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/worker_pool.h"
+
+WorkerThread::WorkerThread() : wxThread(wxTHREAD_JOINABLE) {
+  pool_ = nullptr;
+}
+
+WorkerThread::~WorkerThread() {
+}
+
+void WorkerThread::set_pool(WorkerPool* pool) {
+  pool_ = pool;
+}
+
+wxThread::ExitCode WorkerThread::Entry() {
+  // processes passes until the pool stops
+  int pass = 0;
+  while (pool_->WaitPass(pass) == true) {
+    Process();
+    pool_->CompletePass();
+  }
+
+  // exits
+  return (wxThread::ExitCode)0;
+}
+
+WorkerPool::WorkerPool()
+    : condition_complete_(mutex_), condition_pass_(mutex_) {
+  is_stopped_ = false;
+  num_pending_ = 0;
+  pass_ = 0;
+}
+
+WorkerPool::~WorkerPool() {
+  Stop();
+
+  // deletes threads
+  for (auto iter = threads_.begin(); iter != threads_.end(); iter++) {
+    WorkerThread* thread = *iter;
+    delete thread;
+  }
+}
+
+void WorkerPool::Add(WorkerThread* thread) {
+  thread->set_pool(this);
+  threads_.push_back(thread);
+  threads_running_.push_back(false);
+}
+
+int WorkerPool::NumThreads(const int& max_threads) {
+  if (1 <= max_threads) {
+    return max_threads;
+  }
+
+  const int num_cpus = wxThread::GetCPUCount();
+  if (num_cpus < 1) {
+    return 1;
+  } else {
+    return num_cpus;
+  }
+}
+
+void WorkerPool::RunPass() {
+  // signals the running threads
+  int num_running = 0;
+  {
+    wxMutexLocker lock(mutex_);
+    for (unsigned int i = 0; i < threads_running_.size(); i++) {
+      if (threads_running_[i] == true) {
+        num_running++;
+      }
+    }
+
+    num_pending_ = num_running;
+    pass_++;
+    condition_pass_.Broadcast();
+  }
+
+  // processes the threads that aren't running on this thread
+  for (unsigned int i = 0; i < threads_.size(); i++) {
+    if (threads_running_[i] == false) {
+      threads_[i]->Process();
+    }
+  }
+
+  // waits for the running threads to complete the pass
+  wxMutexLocker lock(mutex_);
+  while (0 < num_pending_) {
+    condition_complete_.Wait();
+  }
+}
+
+int WorkerPool::Start() {
+  // a single thread is processed on the calling thread
+  if (threads_.size() <= 1) {
+    return 0;
+  }
+
+  int num_running = 0;
+  for (unsigned int i = 0; i < threads_.size(); i++) {
+    if (threads_running_[i] == true) {
+      num_running++;
+    } else if (threads_[i]->Run() == wxTHREAD_NO_ERROR) {
+      threads_running_[i] = true;
+      num_running++;
+    } else {
+      wxLogError("Couldn't start worker thread");
+    }
+  }
+
+  return num_running;
+}
+
+const std::vector<WorkerThread*>& WorkerPool::threads() const {
+  return threads_;
+}
+
+void WorkerPool::CompletePass() {
+  wxMutexLocker lock(mutex_);
+  num_pending_--;
+  if (num_pending_ == 0) {
+    condition_complete_.Signal();
+  }
+}
+
+void WorkerPool::Stop() {
+  // signals the running threads to exit
+  {
+    wxMutexLocker lock(mutex_);
+    is_stopped_ = true;
+    condition_pass_.Broadcast();
+  }
+
+  // waits for threads to exit
+  for (unsigned int i = 0; i < threads_.size(); i++) {
+    if (threads_running_[i] == true) {
+      threads_[i]->Wait();
+      threads_running_[i] = false;
+    }
+  }
+}
+
+bool WorkerPool::WaitPass(int& pass) {
+  wxMutexLocker lock(mutex_);
+  while ((pass_ == pass) && (is_stopped_ == false)) {
+    condition_pass_.Wait();
+  }
+
+  if (is_stopped_ == true) {
+    return false;
+  }
+
+  pass = pass_;
+  return true;
+}
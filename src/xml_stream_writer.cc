@@ -0,0 +1,261 @@
+// This is free and unencumbered software released into the public domain.
+// For more information, please refer to <http://unlicense.org/>
+
+#include "spananalyzer/xml_stream_writer.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace {
+
+/// \var kSizeBuffer
+///   The buffer size that triggers a write to the stream.
+const size_t kSizeBuffer = 64 * 1024;
+
+}  // namespace
+
+XmlStreamWriter::XmlStreamWriter(wxOutputStream& stream, const int& indent)
+    : stream_(stream) {
+  buffer_.reserve(kSizeBuffer + 1024);
+  indent_ = indent;
+  is_ok_ = stream_.IsOk();
+  is_start_tag_open_ = false;
+}
+
+XmlStreamWriter::~XmlStreamWriter() {
+  Flush();
+}
+
+void XmlStreamWriter::AddAttribute(const std::string& name,
+                                   const std::string& value) {
+  if (is_start_tag_open_ == false) {
+    return;
+  }
+
+  buffer_ += ' ';
+  buffer_ += name;
+  buffer_ += "=\"";
+  AppendEscaped(value, true);
+  buffer_ += '"';
+}
+
+bool XmlStreamWriter::EndDocument() {
+  while (elements_.empty() == false) {
+    EndElement();
+  }
+
+  buffer_ += '\n';
+  Flush();
+
+  return is_ok_;
+}
+
+void XmlStreamWriter::EndElement() {
+  if (elements_.empty() == true) {
+    return;
+  }
+
+  const Element element = elements_.back();
+  elements_.pop_back();
+
+  // closes with a short tag if the element doesn't have any content
+  if (is_start_tag_open_ == true) {
+    buffer_ += "/>";
+    is_start_tag_open_ = false;
+  } else {
+    if (element.is_last_child_element == true) {
+      AppendIndentation(static_cast<int>(elements_.size()));
+    }
+    buffer_ += "</";
+    buffer_ += element.name;
+    buffer_ += '>';
+  }
+
+  if (kSizeBuffer <= buffer_.size()) {
+    Flush();
+  }
+}
+
+std::string XmlStreamWriter::FormatNumber(const double& value,
+                                          const int& precision) {
+  static const double kScales[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                   1e8, 1e9};
+
+  // falls back to printf for values that can't be scaled to an integer
+  if ((precision < 0) || (9 < precision) || (std::isfinite(value) == false)
+      || (9e17 < std::fabs(value) * kScales[precision])) {
+    char buffer[512];
+    std::snprintf(buffer, sizeof(buffer), "%.*f", precision, value);
+    return std::string(buffer);
+  }
+
+  // rounds the scaled value to an integer
+  const bool is_negative = value < 0;
+  unsigned long long scaled = static_cast<unsigned long long>(
+      std::llround(std::fabs(value) * kScales[precision]));
+
+  // writes digits from the end, inserting the decimal point
+  char digits[32];
+  char* end = digits + sizeof(digits);
+  char* pos = end;
+  for (int i = 0; i < precision; i++) {
+    *--pos = static_cast<char>('0' + (scaled % 10));
+    scaled /= 10;
+  }
+  if (0 < precision) {
+    *--pos = '.';
+  }
+  do {
+    *--pos = static_cast<char>('0' + (scaled % 10));
+    scaled /= 10;
+  } while (scaled != 0);
+
+  // adds a sign, unless the value rounds to zero
+  bool is_zero = true;
+  for (const char* c = pos; c != end; c++) {
+    if ((*c != '0') && (*c != '.')) {
+      is_zero = false;
+      break;
+    }
+  }
+  if ((is_negative == true) && (is_zero == false)) {
+    *--pos = '-';
+  }
+
+  return std::string(pos, end);
+}
+
+void XmlStreamWriter::StartDocument() {
+  buffer_ += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+}
+
+void XmlStreamWriter::StartElement(const std::string& name) {
+  // updates the parent element
+  if (elements_.empty() == false) {
+    CloseStartTag();
+    elements_.back().is_last_child_element = true;
+    AppendIndentation(static_cast<int>(elements_.size()));
+  }
+
+  buffer_ += '<';
+  buffer_ += name;
+  is_start_tag_open_ = true;
+
+  Element element;
+  element.name = name;
+  element.is_last_child_element = false;
+  elements_.push_back(element);
+}
+
+void XmlStreamWriter::WriteElement(const std::string& name,
+                                   const std::string& content) {
+  StartElement(name);
+  WriteText(content);
+  EndElement();
+}
+
+void XmlStreamWriter::WriteElementNumber(const std::string& name,
+                                         const double& value,
+                                         const int& precision,
+                                         const std::string& units) {
+  StartElement(name);
+  if (units.empty() == false) {
+    AddAttribute("units", units);
+  }
+  WriteText(FormatNumber(value, precision));
+  EndElement();
+}
+
+void XmlStreamWriter::WriteNode(const wxXmlNode* node) {
+  if (node == nullptr) {
+    return;
+  }
+
+  if ((node->GetType() == wxXML_TEXT_NODE)
+      || (node->GetType() == wxXML_CDATA_SECTION_NODE)) {
+    WriteText(std::string(node->GetContent().ToUTF8()));
+    return;
+  } else if (node->GetType() != wxXML_ELEMENT_NODE) {
+    return;
+  }
+
+  // writes the element and attributes
+  StartElement(std::string(node->GetName().ToUTF8()));
+
+  const wxXmlAttribute* attribute = node->GetAttributes();
+  while (attribute != nullptr) {
+    AddAttribute(std::string(attribute->GetName().ToUTF8()),
+                 std::string(attribute->GetValue().ToUTF8()));
+    attribute = attribute->GetNext();
+  }
+
+  // writes the children
+  const wxXmlNode* child = node->GetChildren();
+  while (child != nullptr) {
+    WriteNode(child);
+    child = child->GetNext();
+  }
+
+  EndElement();
+}
+
+void XmlStreamWriter::WriteText(const std::string& text) {
+  if (elements_.empty() == true) {
+    return;
+  }
+
+  CloseStartTag();
+  elements_.back().is_last_child_element = false;
+  AppendEscaped(text, false);
+}
+
+void XmlStreamWriter::AppendEscaped(const std::string& text,
+                                    const bool& is_attribute) {
+  for (auto iter = text.cbegin(); iter != text.cend(); iter++) {
+    const char c = *iter;
+    if (c == '<') {
+      buffer_ += "&lt;";
+    } else if (c == '>') {
+      buffer_ += "&gt;";
+    } else if (c == '&') {
+      buffer_ += "&amp;";
+    } else if ((is_attribute == true) && (c == '"')) {
+      buffer_ += "&quot;";
+    } else if ((is_attribute == true) && (c == '\t')) {
+      buffer_ += "&#x9;";
+    } else if ((is_attribute == true) && (c == '\n')) {
+      buffer_ += "&#xA;";
+    } else if ((is_attribute == true) && (c == '\r')) {
+      buffer_ += "&#xD;";
+    } else {
+      buffer_ += c;
+    }
+  }
+}
+
+void XmlStreamWriter::AppendIndentation(const int& depth) {
+  buffer_ += '\n';
+  buffer_.append(static_cast<size_t>(depth * indent_), ' ');
+}
+
+void XmlStreamWriter::CloseStartTag() {
+  if (is_start_tag_open_ == true) {
+    buffer_ += '>';
+    is_start_tag_open_ = false;
+  }
+}
+
+void XmlStreamWriter::Flush() {
+  if (buffer_.empty() == true) {
+    return;
+  }
+
+  if (is_ok_ == true) {
+    stream_.Write(buffer_.data(), buffer_.size());
+    if (stream_.LastWrite() != buffer_.size()) {
+      is_ok_ = false;
+    }
+  }
+
+  buffer_.clear();
+}